@@ -184,7 +184,8 @@ HResult Application::Initialize()
 	bufferSize = stride*effectiveHeight;
 
 	void *mapped;
-	device->CreateBitmap(effectiveWidth, effectiveHeight, &image);
+	// Scaled down in the image view, so minification reads the mip chain
+	device->CreateBitmap(effectiveWidth, effectiveHeight, &image, true);
 	image->MapMemory(&mapped);
 	hr1 = convertedSource->CopyPixels(
 		nullptr,
@@ -10,14 +10,28 @@ namespace gpu
 	Bitmap::Bitmap(
 		GpuDevice *device,
 		uint32 width,
-		uint32 height)
+		uint32 height,
+		bool mipmaps)
 	{
 		device->AddRef();
 		this->device = device;
 		this->width = width;
 		this->height = height;
 		MatrixSetIdentity(&transform);
-		memOffset = device->AllocateMemory(width*height * sizeof(Color));
+		lastFrame = 0;
+		waitForFrames = true;
+		MipLevel level = { 0, width, height };
+		levels.push_back(level);
+		memSize = width*height * sizeof(Color);
+		while (mipmaps && (level.width > 1 || level.height > 1))
+		{
+			level.offset = memSize;
+			level.width = Max(level.width >> 1, 1u);
+			level.height = Max(level.height >> 1, 1u);
+			levels.push_back(level);
+			memSize += level.width*level.height * sizeof(Color);
+		}
+		memOffset = device->AllocateMemory(memSize);
 	}
 	Bitmap::~Bitmap()
 	{
@@ -32,6 +46,10 @@ namespace gpu
 	{
 		return height;
 	}
+	uint32 Bitmap::GetLevelCount()
+	{
+		return (uint32)levels.size();
+	}
 	void Bitmap::SetTransform(Matrix3x2f &transform)
 	{
 		this->transform = transform;
@@ -40,12 +58,56 @@ namespace gpu
 	{
 		return transform;
 	}
+	void Bitmap::GenerateMipmaps(uint8 *data)
+	{
+		// 2x2 box filter, edge texels repeat for odd sizes
+		for (uint32 i = 1; i < levels.size(); i++)
+		{
+			MipLevel &src = levels[i - 1], &dst = levels[i];
+			Color *srcData = (Color *)(data + src.offset),
+				*dstData = (Color *)(data + dst.offset);
+			for (uint32 y = 0; y < dst.height; y++)
+			{
+				Color *row0 = srcData + Min(y << 1, src.height - 1) * src.width,
+					*row1 = srcData + Min((y << 1) + 1, src.height - 1) * src.width;
+				for (uint32 x = 0; x < dst.width; x++)
+				{
+					uint32 x0 = Min(x << 1, src.width - 1),
+						x1 = Min((x << 1) + 1, src.width - 1);
+					Color &out = dstData[y*dst.width + x];
+					out.r = (uint8)((row0[x0].r + row0[x1].r + row1[x0].r + row1[x1].r + 2) >> 2);
+					out.g = (uint8)((row0[x0].g + row0[x1].g + row1[x0].g + row1[x1].g + 2) >> 2);
+					out.b = (uint8)((row0[x0].b + row0[x1].b + row1[x0].b + row1[x1].b + 2) >> 2);
+					out.a = (uint8)((row0[x0].a + row0[x1].a + row1[x0].a + row1[x1].a + 2) >> 2);
+				}
+			}
+		}
+	}
+	void Bitmap::WaitForFrames()
+	{
+		// Writes to a device local heap are copied after the frames submitted
+		// before them, see GpuDevice::SubmitStorageUploads
+		if (waitForFrames && !device->options.deviceLocalStorage)
+			device->WaitForFrames(lastFrame);
+	}
 	void Bitmap::MapMemory(void **ppData)
 	{
-		device->MapMemory(memOffset, width*height * sizeof(Color), ppData);
+		WaitForFrames();
+		device->MapMemory(memOffset, memSize, &mapped);
+		*ppData = mapped;
+	}
+	void Bitmap::MapRows(uint32 firstRow, uint32 rowCount, void **ppData)
+	{
+		WaitForFrames();
+		device->MapMemory(
+			memOffset + firstRow * width * sizeof(Color),
+			rowCount * width * sizeof(Color),
+			ppData);
+		mapped = nullptr;
 	}
 	void Bitmap::UnmapMempory()
 	{
+		if (levels.size() > 1 && mapped != nullptr) GenerateMipmaps((uint8 *)mapped);
 		device->UnmapMemory();
 	}
 }
@@ -5,6 +5,9 @@
 #include "kernel\kernel.h"
 #include "kernel\SharedObject.h"
 #include "math\VectorMath.h"
+#include "graphics\Color.h"
+#include <vector>
+#include <atomic>
 
 namespace gpu
 {
@@ -18,17 +21,40 @@ namespace gpu
 		uint32 height;
 		Matrix3x2f transform;
 		uint32 memOffset;
+		struct MipLevel
+		{
+			uint32 offset;
+			uint32 width;
+			uint32 height;
+		};
+		// Level 0 is the bitmap itself; smaller levels follow it in the same
+		// allocation and are regenerated on unmap
+		std::vector<MipLevel> levels;
+		uint32 memSize;
+		void *mapped;
+		// Device serial of the last frame that sampled the bitmap; frames read
+		// a host visible heap in place, so mapping waits for that frame
+		std::atomic<uint64> lastFrame;
+		// Cleared when the owner tracks the texels in use itself
+		bool waitForFrames;
 		Bitmap(
 			GpuDevice *device,
 			uint32 width,
-			uint32 height);
+			uint32 height,
+			bool mipmaps);
 		~Bitmap();
+		void GenerateMipmaps(uint8 *data);
+		void WaitForFrames();
 	public:
 		uint32 GetWidth();
 		uint32 GetHeight();
+		uint32 GetLevelCount();
 		void SetTransform(Matrix3x2f &transform);
 		Matrix3x2f GetTransform();
+		// Mapping waits for frames still in flight that sample the bitmap
 		void MapMemory(void **ppData);
+		// Maps whole rows of level 0 only; mip levels are not regenerated on unmap
+		void MapRows(uint32 firstRow, uint32 rowCount, void **ppData);
 		void UnmapMempory();
 	};
 }
@@ -27,11 +27,13 @@ namespace gpu
 	}
 	CommandBuffer::~CommandBuffer()
 	{
+		device->queueSection.lock();
 		vkFreeCommandBuffers(
 			device->vkDevice,
 			device->vkCmdPool,
 			1,
 			&vkCmdBuffer);
+		device->queueSection.unlock();
 		device->Unref();
 	}
 	void CommandBuffer::Begin()
@@ -59,8 +61,18 @@ namespace gpu
 		renderPassBegin.renderArea.offset.x = 0;
 		renderPassBegin.renderArea.offset.y = 0;
 		renderPassBegin.renderArea.extent = swapChain->vkSwapChainCreateInfo.imageExtent;
-		renderPassBegin.pClearValues = clearValues;
-		renderPassBegin.clearValueCount = 2;
+		// Multisampled passes clear the resolve target and multisampled depth too
+		VkClearValue attachmentClearValues[3] = { clearValues[0], clearValues[0], clearValues[1] };
+		if (swapChain->msaaColorImage != VK_NULL_HANDLE)
+		{
+			renderPassBegin.pClearValues = attachmentClearValues;
+			renderPassBegin.clearValueCount = 3;
+		}
+		else
+		{
+			renderPassBegin.pClearValues = clearValues;
+			renderPassBegin.clearValueCount = 2;
+		}
 
 		vkCmdBeginRenderPass(
 			vkCmdBuffer,
@@ -78,6 +90,7 @@ namespace gpu
 	}
 	void CommandBuffer::BindPipeline(Pipeline *pipeline)
 	{
+		if (currentPipeline == pipeline) return;
 		currentPipeline = pipeline;
 		vkCmdBindPipeline(
 			vkCmdBuffer,
@@ -172,7 +185,109 @@ namespace gpu
 			firstVertex,
 			firstInstance);
 	}
-	void CommandBuffer::Submit(SwapChain *swapChain)
+	void CommandBuffer::CopyBuffer(
+		Buffer *source,
+		Buffer *destination,
+		uint32 size)
+	{
+		VkBufferCopy region;
+		region.srcOffset = 0;
+		region.dstOffset = 0;
+		region.size = (VkDeviceSize)size;
+		vkCmdCopyBuffer(
+			vkCmdBuffer,
+			source->vkBuffer,
+			destination->vkBuffer,
+			1,
+			&region);
+	}
+	void CommandBuffer::CopyBuffer(
+		Buffer *source,
+		Buffer *destination,
+		VkBufferCopy *regions,
+		uint32 count)
+	{
+		vkCmdCopyBuffer(
+			vkCmdBuffer,
+			source->vkBuffer,
+			destination->vkBuffer,
+			count,
+			regions);
+	}
+	void CommandBuffer::CopyImageToBuffer(
+		SwapChain *source,
+		Buffer *destination)
+	{
+		VkBufferImageCopy region;
+		region.bufferOffset = 0;
+		region.bufferRowLength = 0;
+		region.bufferImageHeight = 0;
+		region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		region.imageSubresource.mipLevel = 0;
+		region.imageSubresource.baseArrayLayer = 0;
+		region.imageSubresource.layerCount = 1;
+		region.imageOffset = { 0, 0, 0 };
+		region.imageExtent.width = source->GetWidth();
+		region.imageExtent.height = source->GetHeight();
+		region.imageExtent.depth = 1;
+		vkCmdCopyImageToBuffer(
+			vkCmdBuffer,
+			source->vkImages[source->currentBuffer],
+			VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			destination->vkBuffer,
+			1,
+			&region);
+	}
+	void CommandBuffer::ResetQueryPool(
+		VkQueryPool queryPool,
+		uint32 firstQuery,
+		uint32 queryCount)
+	{
+		vkCmdResetQueryPool(
+			vkCmdBuffer,
+			queryPool,
+			firstQuery,
+			queryCount);
+	}
+	void CommandBuffer::WriteTimestamp(
+		VkPipelineStageFlagBits stage,
+		VkQueryPool queryPool,
+		uint32 query)
+	{
+		vkCmdWriteTimestamp(
+			vkCmdBuffer,
+			stage,
+			queryPool,
+			query);
+	}
+	void CommandBuffer::PipelineBarrier(
+		VkPipelineStageFlags srcStageMask,
+		VkAccessFlags srcAccessMask,
+		VkPipelineStageFlags dstStageMask,
+		VkAccessFlags dstAccessMask)
+	{
+		VkMemoryBarrier barrier;
+		barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		barrier.pNext = nullptr;
+		barrier.srcAccessMask = srcAccessMask;
+		barrier.dstAccessMask = dstAccessMask;
+		vkCmdPipelineBarrier(
+			vkCmdBuffer,
+			srcStageMask,
+			dstStageMask,
+			0,
+			1,
+			&barrier,
+			0,
+			nullptr,
+			0,
+			nullptr);
+	}
+	void CommandBuffer::Submit(
+		SwapChain *swapChain,
+		VkSemaphore waitSemaphore,
+		VkSemaphore signalSemaphore,
+		VkFence fence)
 	{
 		VkPipelineStageFlags pipelineStageFlags =
 			VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
@@ -182,15 +297,16 @@ namespace gpu
 		submitInfo.pWaitDstStageMask = &pipelineStageFlags;
 		submitInfo.commandBufferCount = 1;
 		submitInfo.pCommandBuffers = &vkCmdBuffer;
-		submitInfo.waitSemaphoreCount = 0;
-		submitInfo.pWaitSemaphores = nullptr;
-		submitInfo.signalSemaphoreCount = 0;
-		submitInfo.pSignalSemaphores = nullptr;
+		submitInfo.waitSemaphoreCount = waitSemaphore != VK_NULL_HANDLE ? 1 : 0;
+		submitInfo.pWaitSemaphores = &waitSemaphore;
+		submitInfo.signalSemaphoreCount = signalSemaphore != VK_NULL_HANDLE ? 1 : 0;
+		submitInfo.pSignalSemaphores = &signalSemaphore;
+		device->queueSection.lock();
 		vkQueueSubmit(
 			swapChain->vkGraphicsQueue,
 			1,
 			&submitInfo,
-			VK_NULL_HANDLE);
-		vkQueueWaitIdle(swapChain->vkGraphicsQueue);
+			fence);
+		device->queueSection.unlock();
 	}
 }
@@ -60,6 +60,38 @@ namespace gpu
 			uint32 instanceCount,
 			uint32 firstVertex,
 			uint32 firstInstance);
-		void Submit(SwapChain *swapChain);
+		void CopyBuffer(
+			Buffer *source,
+			Buffer *destination,
+			uint32 size);
+		void CopyBuffer(
+			Buffer *source,
+			Buffer *destination,
+			VkBufferCopy *regions,
+			uint32 count);
+		// Copies the current image of an offscreen swap chain, which the
+		// render pass leaves in transfer source layout
+		void CopyImageToBuffer(
+			SwapChain *source,
+			Buffer *destination);
+		void ResetQueryPool(
+			VkQueryPool queryPool,
+			uint32 firstQuery,
+			uint32 queryCount);
+		void WriteTimestamp(
+			VkPipelineStageFlagBits stage,
+			VkQueryPool queryPool,
+			uint32 query);
+		void PipelineBarrier(
+			VkPipelineStageFlags srcStageMask,
+			VkAccessFlags srcAccessMask,
+			VkPipelineStageFlags dstStageMask,
+			VkAccessFlags dstAccessMask);
+		// Null semaphores are left out of the submission
+		void Submit(
+			SwapChain *swapChain,
+			VkSemaphore waitSemaphore,
+			VkSemaphore signalSemaphore,
+			VkFence fence);
 	};
 }
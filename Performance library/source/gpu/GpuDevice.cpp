@@ -15,6 +15,8 @@
 #include "gpu\ShaderData.h"
 #include "math\VectorMath.h"
 #include <vector>
+#include <algorithm>
+#include <iterator>
 
 namespace gpu
 {
@@ -30,7 +32,9 @@ namespace gpu
 		VkDescriptorSet vkDescSet,
 		VkPipelineLayout vkPipelineLayout,
 		uint32 graphicsQueueFamilyIndex,
-		VkQueue vkGraphicsQueue)
+		VkQueue vkGraphicsQueue,
+		bool presentationSupported,
+		GpuDeviceOptions &options)
 	{
 		this->vkInstance = vkInstance;
 		this->vkPhysicalDevice = vkPhysicalDevice;
@@ -44,18 +48,63 @@ namespace gpu
 		this->vkPipelineLayout = vkPipelineLayout;
 		this->graphicsQueueFamilyIndex = graphicsQueueFamilyIndex;
 		this->vkGraphicsQueue = vkGraphicsQueue;
+		this->presentationSupported = presentationSupported;
+		this->options = options;
+		pipelineCachePath = options.pipelineCachePath != nullptr
+			? options.pipelineCachePath : "PipelineCache.bin";
+		LoadPipelineCache();
+		VkSampleCountFlagBits sampleCount = VK_SAMPLE_COUNT_8_BIT;
+		if (options.sampleCount == 1) sampleCount = VK_SAMPLE_COUNT_1_BIT;
+		else if (options.sampleCount == 2) sampleCount = VK_SAMPLE_COUNT_2_BIT;
+		else if (options.sampleCount == 4) sampleCount = VK_SAMPLE_COUNT_4_BIT;
+		GetAvailableSampleCount(vkDeviceProp, sampleCount, &msaa);
+		frameSerial = 0;
+		stagingBuffer = nullptr;
+		stagingData = nullptr;
+		stagingHead = 0;
+		stagingTail = 0;
+		storageBytesUploaded = 0;
+		uint32 timestampBits = familyProp[graphicsQueueFamilyIndex].timestampValidBits;
+		if (!vkDeviceProp.limits.timestampComputeAndGraphics || timestampBits == 0)
+			timestampMask = 0;
+		else if (timestampBits >= 64) timestampMask = UINT64_MAX;
+		else timestampMask = (1ull << timestampBits) - 1;
 		CreateBuffer(
-			VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
-			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+			VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+			| VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+			| VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+			options.deviceLocalStorage ? VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+			: VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
 			GpuMemoryManager::InitialHeapSize,
 			&storageBuffer);
 		UpdateStorageBuffer();
-		memManager = new GpuMemoryManager(this, storageBuffer);
+		if (options.deviceLocalStorage)
+			heapData = new uint8[GpuMemoryManager::InitialHeapSize];
+		else storageBuffer->MapMemory(0, storageBuffer->GetSize(), (void **)&heapData);
+		memManager = new GpuMemoryManager(this);
 	}
 	GpuDevice::~GpuDevice()
 	{
+		if (options.deviceLocalStorage) delete[] heapData;
+		else storageBuffer->UnmapMemory();
 		storageBuffer->Unref();
+		if (stagingBuffer != nullptr)
+		{
+			stagingBuffer->UnmapMemory();
+			stagingBuffer->Unref();
+		}
+		RetireStagingBlocks((uint32)stagingBlocks.size());
+		for (VkFence fence : stagingFences)
+		{
+			vkWaitForFences(vkDevice, 1, &fence, VK_TRUE, UINT64_MAX);
+			vkDestroyFence(vkDevice, fence, nullptr);
+		}
 		delete memManager;
+		if (vkPipelineCache != VK_NULL_HANDLE)
+		{
+			SavePipelineCache();
+			vkDestroyPipelineCache(vkDevice, vkPipelineCache, nullptr);
+		}
 		vkDestroyPipelineLayout(
 			vkDevice,
 			vkPipelineLayout,
@@ -82,22 +131,289 @@ namespace gpu
 	}
 	uint32 GpuDevice::AllocateMemory(uint32 size)
 	{
-		return memManager->Allocate(size);
+		memorySection.lock();
+		uint32 offset = memManager->Allocate(size);
+		memorySection.unlock();
+		return offset;
 	}
 	void GpuDevice::DeallocateMemory(uint32 offset)
 	{
-		memManager->Deallocate(offset);
+		memorySection.lock();
+		if (pendingFrames.empty()) memManager->Deallocate(offset);
+		else deferredDeallocations.push_back({ offset, frameSerial });
+		memorySection.unlock();
 	}
-	void GpuDevice::MapMemory(uint32 offset, uint32 size, void **ppData)
+	uint64 GpuDevice::BeginFrame(VkFence fence)
 	{
 		memorySection.lock();
-		vkMapMemory(vkDevice, storageBuffer->vkBufferMemory, offset, size, 0, ppData);
+		uint64 serial = ++frameSerial;
+		pendingFrames.push_back({ serial, fence });
+		memorySection.unlock();
+		return serial;
 	}
-	void GpuDevice::UnmapMemory()
+	void GpuDevice::CompleteFrame(uint64 serial)
 	{
-		vkUnmapMemory(vkDevice, storageBuffer->vkBufferMemory);
+		memorySection.lock();
+		auto iter = std::find_if(
+			pendingFrames.begin(),
+			pendingFrames.end(),
+			[serial](const PendingFrame &frame) { return frame.serial == serial; });
+		if (iter != pendingFrames.end())
+		{
+			pendingFrames.erase(iter);
+			uint64 oldestPending = frameSerial + 1;
+			for (PendingFrame &pending : pendingFrames)
+				oldestPending = Min(oldestPending, pending.serial);
+			uint32 count = 0;
+			for (DeferredDeallocation &deallocation : deferredDeallocations)
+			{
+				if (deallocation.serial < oldestPending)
+					memManager->Deallocate(deallocation.offset);
+				else deferredDeallocations[count++] = deallocation;
+			}
+			deferredDeallocations.resize(count);
+
+			stagingSection.lock();
+			count = 0;
+			while (count < stagingBlocks.size()
+				&& stagingBlocks[count].serial < oldestPending)
+				count++;
+			RetireStagingBlocks(count);
+			stagingSection.unlock();
+		}
 		memorySection.unlock();
 	}
+	void GpuDevice::WaitForFrames(uint64 serial)
+	{
+		// A frame still recording has the signaled fence of its slot's previous
+		// frame; a fence reset for a later frame only makes the wait longer
+		std::vector<VkFence> fences;
+		memorySection.lock();
+		for (PendingFrame &pending : pendingFrames)
+		{
+			if (pending.serial <= serial) fences.push_back(pending.fence);
+		}
+		memorySection.unlock();
+		if (!fences.empty())
+			vkWaitForFences(vkDevice, (uint32)fences.size(), fences.data(), VK_TRUE, UINT64_MAX);
+	}
+	HResult GpuDevice::ResizeStorageHeap(uint32 oldSize, uint32 newSize)
+	{
+		heapLock.lock();
+		Buffer *newBuffer;
+		if (CreateBuffer(
+			storageBuffer->vkBufferInfo.usage,
+			storageBuffer->vkMemoryTypeBits,
+			newSize,
+			&newBuffer) != HResultSuccess)
+		{
+			heapLock.unlock();
+			return HResultFail;
+		}
+		// Existing contents are copied on the GPU; the copy is submitted
+		// after all pending frames, so its fence also retires them before
+		// the old heap is released. On failure the old heap stays in place
+		if (CopyBuffer(storageBuffer, newBuffer, oldSize) != HResultSuccess)
+		{
+			newBuffer->Unref();
+			heapLock.unlock();
+			return HResultFail;
+		}
+		if (options.deviceLocalStorage)
+		{
+			uint8 *data = new uint8[newSize];
+			memcpy(data, heapData, oldSize);
+			delete[] heapData;
+			heapData = data;
+		}
+		else storageBuffer->UnmapMemory();
+		storageBuffer->Unref();
+		storageBuffer = newBuffer;
+		UpdateStorageBuffer();
+		if (!options.deviceLocalStorage)
+			storageBuffer->MapMemory(0, storageBuffer->GetSize(), (void **)&heapData);
+		heapLock.unlock();
+		return HResultSuccess;
+	}
+	HResult GpuDevice::AcquireStagingFence(VkFence *fence)
+	{
+		if (stagingFences.empty())
+		{
+			VkFenceCreateInfo fenceInfo;
+			fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+			fenceInfo.pNext = nullptr;
+			fenceInfo.flags = 0;
+			CheckReturnFail(vkCreateFence(vkDevice, &fenceInfo, nullptr, fence));
+			return HResultSuccess;
+		}
+		// Blocks retired with their frame may not have waited on the fence
+		*fence = stagingFences.back();
+		stagingFences.pop_back();
+		vkWaitForFences(vkDevice, 1, fence, VK_TRUE, UINT64_MAX);
+		vkResetFences(vkDevice, 1, fence);
+		return HResultSuccess;
+	}
+	void GpuDevice::RetireStagingBlocks(uint32 count)
+	{
+		for (uint32 i = 0; i < count; i++)
+		{
+			stagingTail = stagingBlocks[i].end;
+			stagingFences.push_back(stagingBlocks[i].fence);
+		}
+		stagingBlocks.erase(stagingBlocks.begin(), stagingBlocks.begin() + count);
+	}
+	HResult GpuDevice::AllocateStaging(uint32 size, uint32 *offset)
+	{
+		uint32 stagingSize = stagingBuffer == nullptr ? 0 : stagingBuffer->GetSize();
+		while (true)
+		{
+			if (stagingBlocks.empty()) stagingHead = stagingTail = 0;
+			if (stagingHead >= stagingTail)
+			{
+				if (stagingSize - stagingHead >= size)
+				{
+					*offset = stagingHead;
+					return HResultSuccess;
+				}
+				if (size < stagingTail)
+				{
+					*offset = 0;
+					return HResultSuccess;
+				}
+			}
+			else if (stagingTail - stagingHead > size)
+			{
+				*offset = stagingHead;
+				return HResultSuccess;
+			}
+			if (stagingBlocks.empty() || stagingSize < size) break;
+			// The ring is full: only the oldest copy is waited for
+			vkWaitForFences(vkDevice, 1, &stagingBlocks.front().fence, VK_TRUE, UINT64_MAX);
+			RetireStagingBlocks(1);
+		}
+
+		// A single upload does not fit: the ring grows once its copies are done
+		for (StagingBlock &block : stagingBlocks)
+			vkWaitForFences(vkDevice, 1, &block.fence, VK_TRUE, UINT64_MAX);
+		RetireStagingBlocks((uint32)stagingBlocks.size());
+		stagingHead = stagingTail = 0;
+		uint32 newSize = Max(stagingSize, 1u << 20);
+		while (newSize < size) newSize <<= 1;
+		if (stagingBuffer != nullptr)
+		{
+			stagingBuffer->UnmapMemory();
+			stagingBuffer->Unref();
+			stagingBuffer = nullptr;
+		}
+		CheckReturn(CreateBuffer(
+			VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+			newSize,
+			&stagingBuffer));
+		CheckReturn(stagingBuffer->MapMemory(0, newSize, (void **)&stagingData));
+		*offset = 0;
+		return HResultSuccess;
+	}
+	void GpuDevice::SubmitStorageUploads(CommandBuffer *cmdBuffer, uint64 serial)
+	{
+		if (!options.deviceLocalStorage) return;
+		heapLock.lock();
+		if (dirtyRanges.empty())
+		{
+			heapLock.unlock();
+			return;
+		}
+		std::sort(
+			dirtyRanges.begin(),
+			dirtyRanges.end(),
+			[](const DirtyRange &a, const DirtyRange &b) { return a.offset < b.offset; });
+		uint32 count = 0;
+		for (DirtyRange &range : dirtyRanges)
+		{
+			if (count != 0 && range.offset <= dirtyRanges[count - 1].offset + dirtyRanges[count - 1].size)
+			{
+				DirtyRange &last = dirtyRanges[count - 1];
+				last.size = Max(last.size, range.offset + range.size - last.offset);
+			}
+			else dirtyRanges[count++] = range;
+		}
+		dirtyRanges.resize(count);
+		uint32 totalSize = 0;
+		for (DirtyRange &range : dirtyRanges)
+			totalSize += range.size;
+
+		stagingSection.lock();
+		uint32 stagingOffset;
+		VkFence fence;
+		if (AllocateStaging(totalSize, &stagingOffset) != HResultSuccess
+			|| AcquireStagingFence(&fence) != HResultSuccess)
+		{
+			stagingSection.unlock();
+			heapLock.unlock();
+			return;
+		}
+		std::vector<VkBufferCopy> regions(dirtyRanges.size());
+		uint32 position = stagingOffset;
+		for (uint32 i = 0; i < dirtyRanges.size(); i++)
+		{
+			memcpy(stagingData + position, heapData + dirtyRanges[i].offset, dirtyRanges[i].size);
+			regions[i].srcOffset = position;
+			regions[i].dstOffset = dirtyRanges[i].offset;
+			regions[i].size = dirtyRanges[i].size;
+			position += dirtyRanges[i].size;
+		}
+		stagingBlocks.push_back({ stagingOffset, position, serial, fence });
+		stagingHead = position;
+		stagingSection.unlock();
+		dirtyRanges.clear();
+		storageBytesUploaded += totalSize;
+
+		// Frames still in flight may read the ranges being overwritten, and
+		// the frame submitted next reads them
+		queueSection.lock();
+		cmdBuffer->Begin();
+		cmdBuffer->PipelineBarrier(
+			VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+			0,
+			VK_PIPELINE_STAGE_TRANSFER_BIT,
+			0);
+		cmdBuffer->CopyBuffer(stagingBuffer, storageBuffer, regions.data(), (uint32)regions.size());
+		cmdBuffer->PipelineBarrier(
+			VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VK_ACCESS_TRANSFER_WRITE_BIT,
+			VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+			VK_ACCESS_SHADER_READ_BIT);
+		cmdBuffer->End();
+		VkSubmitInfo submitInfo;
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submitInfo.pNext = nullptr;
+		submitInfo.waitSemaphoreCount = 0;
+		submitInfo.pWaitSemaphores = nullptr;
+		submitInfo.pWaitDstStageMask = nullptr;
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &cmdBuffer->vkCmdBuffer;
+		submitInfo.signalSemaphoreCount = 0;
+		submitInfo.pSignalSemaphores = nullptr;
+		vkQueueSubmit(vkGraphicsQueue, 1, &submitInfo, fence);
+		queueSection.unlock();
+		heapLock.unlock();
+	}
+	void GpuDevice::MapMemory(uint32 offset, uint32 size, void **ppData)
+	{
+		heapLock.lock_read();
+		if (options.deviceLocalStorage)
+		{
+			dirtySection.lock();
+			dirtyRanges.push_back({ offset, size });
+			dirtySection.unlock();
+		}
+		else storageBytesUploaded += size;
+		*ppData = heapData + offset;
+	}
+	void GpuDevice::UnmapMemory()
+	{
+		heapLock.unlock();
+	}
 	void GpuDevice::UpdateStorageBuffer()
 	{
 		VkDescriptorBufferInfo descBufferInfo;
@@ -115,6 +431,80 @@ namespace gpu
 		descWrite.dstBinding = 0;
 		vkUpdateDescriptorSets(vkDevice, 1, &descWrite, 0, nullptr);
 	}
+	void GpuDevice::ReadPipelineCacheFile(
+		const std::string &path,
+		uint32 driverVersion,
+		const uint8 *uuid,
+		std::vector<uint8> *data)
+	{
+		data->clear();
+		std::ifstream file(path, std::ios::binary);
+		if (!file.is_open()) return;
+		uint32 fileDriverVersion;
+		uint8 fileUuid[VK_UUID_SIZE];
+		file.read((char *)&fileDriverVersion, sizeof(fileDriverVersion));
+		file.read((char *)fileUuid, VK_UUID_SIZE);
+		if (file.good()
+			&& fileDriverVersion == driverVersion
+			&& memcmp(fileUuid, uuid, VK_UUID_SIZE) == 0)
+			data->assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+	void GpuDevice::WritePipelineCacheFile(
+		const std::string &path,
+		uint32 driverVersion,
+		const uint8 *uuid,
+		std::vector<uint8> &data)
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		if (!file.is_open()) return;
+		file.write((const char *)&driverVersion, sizeof(driverVersion));
+		file.write((const char *)uuid, VK_UUID_SIZE);
+		file.write((const char *)data.data(), data.size());
+	}
+	void GpuDevice::LoadPipelineCache()
+	{
+		// A cache written for another driver starts from an empty one
+		std::vector<uint8> data;
+		ReadPipelineCacheFile(
+			pipelineCachePath,
+			vkDeviceProp.driverVersion,
+			vkDeviceProp.pipelineCacheUUID,
+			&data);
+
+		VkPipelineCacheCreateInfo cacheInfo;
+		cacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+		cacheInfo.pNext = nullptr;
+		cacheInfo.flags = 0;
+		cacheInfo.initialDataSize = data.size();
+		cacheInfo.pInitialData = data.empty() ? nullptr : data.data();
+		if (vkCreatePipelineCache(vkDevice, &cacheInfo, nullptr, &vkPipelineCache) != VK_SUCCESS)
+		{
+			cacheInfo.initialDataSize = 0;
+			cacheInfo.pInitialData = nullptr;
+			if (vkCreatePipelineCache(vkDevice, &cacheInfo, nullptr, &vkPipelineCache) != VK_SUCCESS)
+				vkPipelineCache = VK_NULL_HANDLE;
+		}
+		// The file is only written again at teardown if the cache has grown
+		pipelineCacheSize = 0;
+		if (vkPipelineCache != VK_NULL_HANDLE)
+			vkGetPipelineCacheData(vkDevice, vkPipelineCache, &pipelineCacheSize, nullptr);
+	}
+	void GpuDevice::SavePipelineCache()
+	{
+		size_t size;
+		if (vkGetPipelineCacheData(vkDevice, vkPipelineCache, &size, nullptr) != VK_SUCCESS
+			|| size == pipelineCacheSize)
+			return;
+		std::vector<uint8> data(size);
+		if (vkGetPipelineCacheData(vkDevice, vkPipelineCache, &size, data.data()) != VK_SUCCESS)
+			return;
+		data.resize(size);
+		WritePipelineCacheFile(
+			pipelineCachePath,
+			vkDeviceProp.driverVersion,
+			vkDeviceProp.pipelineCacheUUID,
+			data);
+	}
 	bool GpuDevice::GetMemoryTypeFromRequirements(
 		VkPhysicalDevice vkPhysicalDevice,
 		uint32 typeBits,
@@ -142,12 +532,12 @@ namespace gpu
 		VkSampleCountFlagBits desiredSampleCount,
 		VkSampleCountFlagBits *availableSampleCount)
 	{
-		VkSampleCountFlagBits maxSamples = min(
-			(VkSampleCountFlagBits)vkDeviceProp.limits.framebufferColorSampleCounts,
-			(VkSampleCountFlagBits)vkDeviceProp.limits.framebufferDepthSampleCounts);
-		if (desiredSampleCount <= maxSamples)
-			*availableSampleCount = desiredSampleCount;
-		else *availableSampleCount = (VkSampleCountFlagBits)(maxSamples ^ (maxSamples >> 1));
+		VkSampleCountFlags supported = vkDeviceProp.limits.framebufferColorSampleCounts
+			& vkDeviceProp.limits.framebufferDepthSampleCounts;
+		uint32 count = desiredSampleCount;
+		while (count > VK_SAMPLE_COUNT_1_BIT && (supported & count) == 0)
+			count >>= 1;
+		*availableSampleCount = (VkSampleCountFlagBits)count;
 	}
 	HResult GpuDevice::CreateShader(
 		uint32 *code,
@@ -177,6 +567,7 @@ namespace gpu
 		Surface *surface,
 		SwapChain **ppSwapChain)
 	{
+		if (!presentationSupported) return HResultFail;
 		uint32 graphicsQueueFamilyIndex = UINT32_MAX,
 			presentQueueFamilyIndex = UINT32_MAX;
 		VkBool32 presentSupport;
@@ -337,402 +728,65 @@ namespace gpu
 			&vkImageCount,
 			nullptr));
 		std::vector<VkImage> vkImages(vkImageCount);
-		std::vector<VkImageView> vkViews(vkImageCount);
 		CheckReturnFail(vkGetSwapchainImagesKHR(
 			vkDevice,
 			vkSwapChain,
 			&vkImageCount,
 			vkImages.data()));
 
-		for (uint32 i = 0; i < vkImageCount; i++)
+		SwapChain *swapChain = new SwapChain(
+			this,
+			surface,
+			vkSwapChainCreateInfo,
+			vkSwapChain,
+			vkGraphicsQueue,
+			vkPresentQueue,
+			vkFormat,
+			vkImages);
+		if (swapChain->CreateAttachments() != HResultSuccess)
 		{
-			VkImageViewCreateInfo viewCreateInfo;
-			viewCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
-			viewCreateInfo.pNext = nullptr;
-			viewCreateInfo.flags = 0;
-			viewCreateInfo.image = vkImages[i];
-			viewCreateInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
-			viewCreateInfo.format = vkFormat;
-			viewCreateInfo.components.r = VK_COMPONENT_SWIZZLE_R;
-			viewCreateInfo.components.g = VK_COMPONENT_SWIZZLE_G;
-			viewCreateInfo.components.b = VK_COMPONENT_SWIZZLE_B;
-			viewCreateInfo.components.a = VK_COMPONENT_SWIZZLE_A;
-			viewCreateInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-			viewCreateInfo.subresourceRange.baseMipLevel = 0;
-			viewCreateInfo.subresourceRange.levelCount = 1;
-			viewCreateInfo.subresourceRange.baseArrayLayer = 0;
-			viewCreateInfo.subresourceRange.layerCount = 1;
-			CheckReturnFail(vkCreateImageView(
-				vkDevice,
-				&viewCreateInfo,
-				nullptr,
-				&vkViews[i]));
-		}
-
-		VkFormat vkDepthFormat = VK_FORMAT_D16_UNORM;
-		VkImageCreateInfo imageCreateInfo;
-		VkFormatProperties formatProps;
-		vkGetPhysicalDeviceFormatProperties(
-			vkPhysicalDevice,
-			vkDepthFormat,
-			&formatProps);
-		if (formatProps.linearTilingFeatures & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT)
-			imageCreateInfo.tiling = VK_IMAGE_TILING_LINEAR;
-		else imageCreateInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
-
-		imageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-		imageCreateInfo.pNext = nullptr;
-		imageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
-		imageCreateInfo.format = vkDepthFormat;
-		imageCreateInfo.extent.width = swapChainExtent.width;
-		imageCreateInfo.extent.height = swapChainExtent.height;
-		imageCreateInfo.extent.depth = 1;
-		imageCreateInfo.mipLevels = 1;
-		imageCreateInfo.arrayLayers = 1;
-		imageCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
-		imageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-		imageCreateInfo.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
-		imageCreateInfo.queueFamilyIndexCount = 0;
-		imageCreateInfo.pQueueFamilyIndices = nullptr;
-		imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-		imageCreateInfo.flags = 0;
-		VkImage vkDepthImage;
-		CheckReturnFail(vkCreateImage(
-			vkDevice,
-			&imageCreateInfo,
-			nullptr,
-			&vkDepthImage));
-
-		VkMemoryRequirements memReqs;
-		vkGetImageMemoryRequirements(vkDevice, vkDepthImage, &memReqs);
-
-		VkMemoryAllocateInfo memAlloc;
-		memAlloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-		memAlloc.pNext = nullptr;
-		if (!GetMemoryTypeFromRequirements(
-			vkPhysicalDevice,
-			memReqs.memoryTypeBits,
-			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-			&memAlloc.memoryTypeIndex))
-			return HResultFail;
-		memAlloc.allocationSize = memReqs.size;
-		VkDeviceMemory vkDepthMemory;
-		CheckReturnFail(vkAllocateMemory(
-			vkDevice,
-			&memAlloc,
-			nullptr,
-			&vkDepthMemory));
-		CheckReturnFail(vkBindImageMemory(
-			vkDevice,
-			vkDepthImage,
-			vkDepthMemory,
-			0));
-
-		VkImageViewCreateInfo viewCreateInfo;
-		viewCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
-		viewCreateInfo.pNext = nullptr;
-		viewCreateInfo.flags = 0;
-		viewCreateInfo.image = vkDepthImage;
-		viewCreateInfo.format = vkDepthFormat;
-		viewCreateInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
-		viewCreateInfo.components.r = VK_COMPONENT_SWIZZLE_R;
-		viewCreateInfo.components.g = VK_COMPONENT_SWIZZLE_G;
-		viewCreateInfo.components.b = VK_COMPONENT_SWIZZLE_B;
-		viewCreateInfo.components.a = VK_COMPONENT_SWIZZLE_A;
-		viewCreateInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
-		viewCreateInfo.subresourceRange.baseMipLevel = 0;
-		viewCreateInfo.subresourceRange.levelCount = 1;
-		viewCreateInfo.subresourceRange.baseArrayLayer = 0;
-		viewCreateInfo.subresourceRange.layerCount = 1;
-		VkImageView vkDepthView;
-		CheckReturnFail(vkCreateImageView(
-			vkDevice,
-			&viewCreateInfo,
-			nullptr,
-			&vkDepthView));
-
-		VkImage msaaColorImage;
-		VkDeviceMemory msaaColorMemory;
-		VkImageView msaaImageView;
-		VkImage msaaDepthImage;
-		VkDeviceMemory msaaDepthMemory;
-		VkImageView msaaDepthView;
-		GetAvailableSampleCount(vkDeviceProp, VK_SAMPLE_COUNT_8_BIT, &msaa);
-		if (msaa != VK_SAMPLE_COUNT_8_BIT) return HResultFail;
-
-		imageCreateInfo = {};
-		imageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-		imageCreateInfo.pNext = nullptr;
-		imageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
-		imageCreateInfo.format = vkSwapChainCreateInfo.imageFormat;
-		imageCreateInfo.extent.width = width;
-		imageCreateInfo.extent.height = height;
-		imageCreateInfo.extent.depth = 1;
-		imageCreateInfo.mipLevels = 1;
-		imageCreateInfo.arrayLayers = 1;
-		imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-		imageCreateInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
-		imageCreateInfo.samples = msaa;
-		imageCreateInfo.usage = VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
-		imageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-
-		CheckReturnFail(vkCreateImage(
-			vkDevice,
-			&imageCreateInfo,
-			nullptr,
-			&msaaColorImage));
-
-		vkGetImageMemoryRequirements(vkDevice, msaaColorImage, &memReqs);
-		if (!GetMemoryTypeFromRequirements(
-			vkPhysicalDevice,
-			memReqs.memoryTypeBits,
-			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-			&memAlloc.memoryTypeIndex))
+			swapChain->Unref();
 			return HResultFail;
-		memAlloc.allocationSize = memReqs.size;
-
-		CheckReturnFail(vkAllocateMemory(
-			vkDevice,
-			&memAlloc,
-			nullptr,
-			&msaaColorMemory));
-		CheckReturnFail(vkBindImageMemory(
-			vkDevice,
-			msaaColorImage,
-			msaaColorMemory,
-			0));
-
-		viewCreateInfo.image = msaaColorImage;
-		viewCreateInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
-		viewCreateInfo.format = vkSwapChainCreateInfo.imageFormat;
-		viewCreateInfo.components.r = VK_COMPONENT_SWIZZLE_R;
-		viewCreateInfo.components.g = VK_COMPONENT_SWIZZLE_G;
-		viewCreateInfo.components.b = VK_COMPONENT_SWIZZLE_B;
-		viewCreateInfo.components.a = VK_COMPONENT_SWIZZLE_A;
-		viewCreateInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-		viewCreateInfo.subresourceRange.levelCount = 1;
-		viewCreateInfo.subresourceRange.layerCount = 1;
-		CheckReturnFail(vkCreateImageView(
-			vkDevice,
-			&viewCreateInfo,
-			nullptr,
-			&msaaImageView));
-
-		imageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
-		imageCreateInfo.format = vkDepthFormat;
-		imageCreateInfo.extent.width = width;
-		imageCreateInfo.extent.height = height;
-		imageCreateInfo.extent.depth = 1;
-		imageCreateInfo.mipLevels = 1;
-		imageCreateInfo.arrayLayers = 1;
-		imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-		imageCreateInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
-		imageCreateInfo.samples = msaa;
-		imageCreateInfo.usage = VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
-		imageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-		CheckReturnFail(vkCreateImage(
-			vkDevice,
-			&imageCreateInfo,
-			nullptr,
-			&msaaDepthImage));
-
-		vkGetImageMemoryRequirements(
-			vkDevice,
-			msaaDepthImage,
-			&memReqs);
-		if (!GetMemoryTypeFromRequirements(
-			vkPhysicalDevice,
-			memReqs.memoryTypeBits,
-			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-			&memAlloc.memoryTypeIndex))
-			return HResultFail;
-		memAlloc.allocationSize = memReqs.size;
-
-		CheckReturnFail(vkAllocateMemory(
-			vkDevice,
-			&memAlloc,
-			nullptr,
-			&msaaDepthMemory));
-		CheckReturnFail(vkBindImageMemory(
-			vkDevice,
-			msaaDepthImage,
-			msaaDepthMemory,
-			0));
-
-		viewCreateInfo.image = msaaDepthImage;
-		viewCreateInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
-		viewCreateInfo.format = vkDepthFormat;
-		viewCreateInfo.components.r = VK_COMPONENT_SWIZZLE_R;
-		viewCreateInfo.components.g = VK_COMPONENT_SWIZZLE_G;
-		viewCreateInfo.components.b = VK_COMPONENT_SWIZZLE_B;
-		viewCreateInfo.components.a = VK_COMPONENT_SWIZZLE_A;
-		viewCreateInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
-		viewCreateInfo.subresourceRange.levelCount = 1;
-		viewCreateInfo.subresourceRange.layerCount = 1;
-		CheckReturnFail(vkCreateImageView(
-			vkDevice,
-			&viewCreateInfo,
-			nullptr,
-			&msaaDepthView));
-
-		VkAttachmentDescription attachments[4];
-		attachments[0].format = vkFormat;
-		attachments[0].samples = msaa;
-		attachments[0].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-		attachments[0].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-		attachments[0].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-		attachments[0].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-		attachments[0].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-		attachments[0].finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-		attachments[0].flags = 0;
-
-		attachments[1].format = vkDepthFormat;
-		attachments[1].samples = VK_SAMPLE_COUNT_1_BIT;
-		attachments[1].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-		attachments[1].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-		attachments[1].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-		attachments[1].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-		attachments[1].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-		attachments[1].finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
-		attachments[1].flags = 0;
-
-		attachments[2].format = vkDepthFormat;
-		attachments[2].samples = msaa;
-		attachments[2].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-		attachments[2].storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-		attachments[2].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-		attachments[2].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-		attachments[2].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-		attachments[2].finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-		attachments[2].flags = 0;
-
-		attachments[3].format = vkDepthFormat;
-		attachments[3].samples = VK_SAMPLE_COUNT_1_BIT;
-		attachments[3].loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-		attachments[3].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-		attachments[3].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-		attachments[3].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-		attachments[3].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-		attachments[3].finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-		attachments[3].flags = 0;
-
-		VkAttachmentReference colorReference;
-		colorReference.attachment = 0;
-		colorReference.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-		VkAttachmentReference depthReference;
-		depthReference.attachment = 2;
-		depthReference.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-		VkAttachmentReference resolveReference;
-		resolveReference.attachment = 1;
-		resolveReference.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-
-		VkSubpassDescription subpass;
-		subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
-		subpass.flags = 0;
-		subpass.inputAttachmentCount = 0;
-		subpass.pInputAttachments = nullptr;
-		subpass.colorAttachmentCount = 1;
-		subpass.pColorAttachments = &colorReference;
-		subpass.pResolveAttachments = &resolveReference;
-		subpass.pDepthStencilAttachment = &depthReference;
-		subpass.preserveAttachmentCount = 0;
-		subpass.pPreserveAttachments = nullptr;
-
-		VkSubpassDependency dependencies[2];
-		dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
-		dependencies[0].dstSubpass = 0;
-		dependencies[0].srcStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-		dependencies[0].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-		dependencies[0].srcAccessMask = VK_ACCESS_MEMORY_READ_BIT;
-		dependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-		dependencies[0].dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
-
-		dependencies[1].srcSubpass = 0;
-		dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
-		dependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-		dependencies[1].dstStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-		dependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-		dependencies[1].dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
-		dependencies[1].dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
-
-		VkRenderPassCreateInfo renderPassCreateInfo;
-		renderPassCreateInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-		renderPassCreateInfo.pNext = nullptr;
-		renderPassCreateInfo.attachmentCount = 4;
-		renderPassCreateInfo.pAttachments = attachments;
-		renderPassCreateInfo.subpassCount = 1;
-		renderPassCreateInfo.pSubpasses = &subpass;
-		renderPassCreateInfo.dependencyCount = 2;
-		renderPassCreateInfo.pDependencies = dependencies;
-		renderPassCreateInfo.flags = 0;
-		VkRenderPass vkRenderPass;
-		CheckReturnFail(vkCreateRenderPass(
-			vkDevice,
-			&renderPassCreateInfo,
-			nullptr,
-			&vkRenderPass));
-
-		VkImageView imageViewAttachments[4];
-		imageViewAttachments[0] = msaaImageView;
-		imageViewAttachments[2] = msaaDepthView;
-		imageViewAttachments[3] = vkDepthView;
-
-		VkFramebufferCreateInfo fbCreateInfo;
-		fbCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-		fbCreateInfo.pNext = nullptr;
-		fbCreateInfo.renderPass = vkRenderPass;
-		fbCreateInfo.attachmentCount = 4;
-		fbCreateInfo.pAttachments = imageViewAttachments;
-		fbCreateInfo.width = vkSwapChainCreateInfo.imageExtent.width;
-		fbCreateInfo.height = vkSwapChainCreateInfo.imageExtent.height;
-		fbCreateInfo.layers = 1;
-		fbCreateInfo.flags = 0;
-
-		std::vector<VkFramebuffer> vkFramebuffers(vkImageCount);
-		for (uint32 i = 0; i <vkImageCount; i++)
-		{
-			imageViewAttachments[1] = vkViews[i];
-			vkCreateFramebuffer(
-				vkDevice,
-				&fbCreateInfo,
-				nullptr,
-				&vkFramebuffers[i]);
 		}
+		*ppSwapChain = swapChain;
 
-		uint32 currentBuffer = 0;
-		CheckReturnFail(vkAcquireNextImageKHR(
-			vkDevice,
-			vkSwapChain,
-			UINT64_MAX,
-			VK_NULL_HANDLE,
-			VK_NULL_HANDLE,
-			&currentBuffer));
-		vkDeviceWaitIdle(vkDevice);
+		return HResultSuccess;
+	}
+	HResult GpuDevice::CreateOffscreenSwapChain(
+		uint32 width,
+		uint32 height,
+		uint32 imageCount,
+		SwapChain **ppSwapChain)
+	{
+		if (width == 0 || height == 0 || imageCount == 0) return HResultInvalidArgument;
+
+		// Only the format and extent of the create info are used offscreen;
+		// RGBA keeps read back pixels in Color byte order
+		VkSwapchainCreateInfoKHR vkSwapChainCreateInfo = {};
+		vkSwapChainCreateInfo.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
+		vkSwapChainCreateInfo.imageFormat = VK_FORMAT_R8G8B8A8_UNORM;
+		vkSwapChainCreateInfo.imageExtent.width = width;
+		vkSwapChainCreateInfo.imageExtent.height = height;
+		vkSwapChainCreateInfo.imageArrayLayers = 1;
+		vkSwapChainCreateInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+		std::vector<VkImage> vkImages(imageCount, VK_NULL_HANDLE);
 
-		*ppSwapChain = new SwapChain(
+		SwapChain *swapChain = new SwapChain(
 			this,
-			surface,
+			nullptr,
 			vkSwapChainCreateInfo,
-			vkSwapChain,
+			VK_NULL_HANDLE,
 			vkGraphicsQueue,
-			vkPresentQueue,
-			vkFormat,
-			vkImageCount,
-			vkImages,
-			vkViews,
-			vkDepthFormat,
-			vkDepthImage,
-			vkDepthView,
-			vkDepthMemory,
-			msaaColorImage,
-			msaaColorMemory,
-			msaaImageView,
-			msaaDepthImage,
-			msaaDepthMemory,
-			msaaDepthView,
-			vkRenderPass,
-			vkFramebuffers,
-			currentBuffer);
+			vkGraphicsQueue,
+			vkSwapChainCreateInfo.imageFormat,
+			vkImages);
+		if (swapChain->CreateOffscreenImages() != HResultSuccess
+			|| swapChain->CreateAttachments() != HResultSuccess)
+		{
+			swapChain->Unref();
+			return HResultFail;
+		}
+		*ppSwapChain = swapChain;
 
 		return HResultSuccess;
 	}
@@ -740,7 +794,8 @@ namespace gpu
 		SwapChain *swapChain,
 		Shader *vertexShader,
 		Shader *fragmentShader,
-		Pipeline **ppPipeline)
+		Pipeline **ppPipeline,
+		VkSpecializationInfo *fragmentSpecialization)
 	{
 		VkDynamicState dynamicStateEnables[VK_DYNAMIC_STATE_RANGE_SIZE];
 		VkPipelineDynamicStateCreateInfo dynamicState;
@@ -750,16 +805,22 @@ namespace gpu
 		dynamicState.dynamicStateCount = 0;
 		dynamicState.flags = 0;
 
+		// One RenderTarget::QuadInstance per instance: the four corners as two
+		// vec4 at locations 0 and 1, then the fragment constants as uvec4
 		VkVertexInputBindingDescription viBindDesc;
 		viBindDesc.binding = 0;
-		viBindDesc.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-		viBindDesc.stride = sizeof(Vector2f);
+		viBindDesc.inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+		viBindDesc.stride = sizeof(RenderTarget::QuadInstance);
 
-		VkVertexInputAttributeDescription viAttrDesc[2];
-		viAttrDesc[0].binding = 0;
-		viAttrDesc[0].location = 0;
-		viAttrDesc[0].format = VK_FORMAT_R32G32_SFLOAT;
-		viAttrDesc[0].offset = 0;
+		const uint32 attributeCount = 2 + sizeof(RenderTarget::FragmentConstants) / 16;
+		VkVertexInputAttributeDescription viAttrDesc[attributeCount];
+		for (uint32 i = 0; i < attributeCount; i++)
+		{
+			viAttrDesc[i].binding = 0;
+			viAttrDesc[i].location = i;
+			viAttrDesc[i].format = i < 2 ? VK_FORMAT_R32G32B32A32_SFLOAT : VK_FORMAT_R32G32B32A32_UINT;
+			viAttrDesc[i].offset = i * 16;
+		}
 
 		VkPipelineVertexInputStateCreateInfo vi;
 		vi.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
@@ -767,7 +828,7 @@ namespace gpu
 		vi.flags = 0;
 		vi.vertexBindingDescriptionCount = 1;
 		vi.pVertexBindingDescriptions = &viBindDesc;
-		vi.vertexAttributeDescriptionCount = 1;
+		vi.vertexAttributeDescriptionCount = attributeCount;
 		vi.pVertexAttributeDescriptions = viAttrDesc;
 
 		VkPipelineInputAssemblyStateCreateInfo ia;
@@ -886,7 +947,7 @@ namespace gpu
 		shaderStages[0].pName = "main";
 		shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
 		shaderStages[1].pNext = nullptr;
-		shaderStages[1].pSpecializationInfo = nullptr;
+		shaderStages[1].pSpecializationInfo = fragmentSpecialization;
 		shaderStages[1].flags = 0;
 		shaderStages[1].module = fragmentShader->vkShader;
 		shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
@@ -899,7 +960,7 @@ namespace gpu
 		VkPipeline vkPipeline;
 		CheckReturnFail(vkCreateGraphicsPipelines(
 			vkDevice,
-			VK_NULL_HANDLE,
+			vkPipelineCache,
 			1,
 			&pipelineCreateInfo,
 			nullptr,
@@ -922,15 +983,73 @@ namespace gpu
 		cmd.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
 		cmd.commandBufferCount = 1;
 		VkCommandBuffer vkCmdBuffer;
-		CheckReturnFail(vkAllocateCommandBuffers(
+		queueSection.lock();
+		VkResult result = vkAllocateCommandBuffers(
 			vkDevice,
 			&cmd,
-			&vkCmdBuffer));
+			&vkCmdBuffer);
+		queueSection.unlock();
+		CheckReturnFail(result);
 
 		*ppCommandBuffer = new CommandBuffer(this, vkCmdBuffer);
 
 		return HResultSuccess;
 	}
+	HResult GpuDevice::CopyBuffer(
+		Buffer *source,
+		Buffer *destination,
+		uint32 size)
+	{
+		CommandBuffer *cmdBuffer;
+		CheckReturn(CreateCommandBuffer(&cmdBuffer));
+
+		VkFenceCreateInfo fenceInfo;
+		fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		fenceInfo.pNext = nullptr;
+		fenceInfo.flags = 0;
+		VkFence fence;
+		if (vkCreateFence(vkDevice, &fenceInfo, nullptr, &fence) != VK_SUCCESS)
+		{
+			cmdBuffer->Unref();
+			return HResultFail;
+		}
+		VkSubmitInfo submitInfo;
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submitInfo.pNext = nullptr;
+		submitInfo.waitSemaphoreCount = 0;
+		submitInfo.pWaitSemaphores = nullptr;
+		submitInfo.pWaitDstStageMask = nullptr;
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &cmdBuffer->vkCmdBuffer;
+		submitInfo.signalSemaphoreCount = 0;
+		submitInfo.pSignalSemaphores = nullptr;
+		// Recording shares the command pool with other threads
+		queueSection.lock();
+		cmdBuffer->Begin();
+		// A device local source was last written by staging copies
+		if (options.deviceLocalStorage)
+			cmdBuffer->PipelineBarrier(
+				VK_PIPELINE_STAGE_TRANSFER_BIT,
+				VK_ACCESS_TRANSFER_WRITE_BIT,
+				VK_PIPELINE_STAGE_TRANSFER_BIT,
+				VK_ACCESS_TRANSFER_READ_BIT);
+		cmdBuffer->CopyBuffer(source, destination, size);
+		cmdBuffer->PipelineBarrier(
+			VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VK_ACCESS_TRANSFER_WRITE_BIT,
+			VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+			VK_ACCESS_SHADER_READ_BIT);
+		cmdBuffer->End();
+		VkResult result = vkQueueSubmit(vkGraphicsQueue, 1, &submitInfo, fence);
+		queueSection.unlock();
+		if (result == VK_SUCCESS)
+			result = vkWaitForFences(vkDevice, 1, &fence, VK_TRUE, UINT64_MAX);
+		vkDestroyFence(vkDevice, fence, nullptr);
+		cmdBuffer->Unref();
+		CheckReturnFail(result);
+
+		return HResultSuccess;
+	}
 	HResult GpuDevice::CreateBuffer(
 		VkBufferUsageFlags vkBufferType,
 		uint32 memoryTypeBits,
@@ -991,6 +1110,16 @@ namespace gpu
 	{
 		return vkInstance;
 	}
+	bool GpuDevice::IsPresentationSupported()
+	{
+		return presentationSupported;
+	}
+	void GpuDevice::GetMemoryStatistics(GpuMemoryStatistics *statistics)
+	{
+		memorySection.lock();
+		memManager->GetStatistics(statistics);
+		memorySection.unlock();
+	}
 	HResult GpuDevice::CreateRenderTarget(
 		uint32 width,
 		uint32 height,
@@ -1003,9 +1132,75 @@ namespace gpu
 			height,
 			surface,
 			&swapChain));
-
-		CommandBuffer *cmdBuffer;
-		CheckReturn(CreateCommandBuffer(&cmdBuffer));
+		HResult result = CreateRenderTarget(swapChain, ppRenderTarget);
+		swapChain->Unref();
+		return result;
+	}
+	HResult GpuDevice::CreateOffscreenRenderTarget(
+		uint32 width,
+		uint32 height,
+		RenderTarget **ppRenderTarget)
+	{
+		SwapChain *swapChain;
+		CheckReturn(CreateOffscreenSwapChain(
+			width,
+			height,
+			RenderTarget::framesInFlight,
+			&swapChain));
+		HResult result = CreateRenderTarget(swapChain, ppRenderTarget);
+		swapChain->Unref();
+		if (result != HResultSuccess) return result;
+		if ((*ppRenderTarget)->CreateReadbackBuffers() != HResultSuccess)
+		{
+			(*ppRenderTarget)->Unref();
+			return HResultFail;
+		}
+		return HResultSuccess;
+	}
+	HResult GpuDevice::CreateRenderTarget(
+		SwapChain *swapChain,
+		RenderTarget **ppRenderTarget)
+	{
+		CommandBuffer *cmdBuffers[RenderTarget::framesInFlight];
+		CommandBuffer *uploadCmdBuffers[RenderTarget::framesInFlight];
+		VkFence fences[RenderTarget::framesInFlight];
+		VkSemaphore imageAcquiredSemaphores[RenderTarget::framesInFlight];
+		VkSemaphore renderFinishedSemaphores[RenderTarget::framesInFlight];
+		VkQueryPool queryPools[RenderTarget::framesInFlight];
+		VkFenceCreateInfo fenceInfo;
+		fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		fenceInfo.pNext = nullptr;
+		fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+		VkSemaphoreCreateInfo semaphoreInfo;
+		semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+		semaphoreInfo.pNext = nullptr;
+		semaphoreInfo.flags = 0;
+		VkQueryPoolCreateInfo queryPoolInfo;
+		queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+		queryPoolInfo.pNext = nullptr;
+		queryPoolInfo.flags = 0;
+		queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+		queryPoolInfo.queryCount = RenderTarget::maxTimestamps;
+		queryPoolInfo.pipelineStatistics = 0;
+		for (uint32 i = 0; i < RenderTarget::framesInFlight; i++)
+		{
+			queryPools[i] = VK_NULL_HANDLE;
+			if (timestampMask != 0)
+				CheckReturnFail(vkCreateQueryPool(vkDevice, &queryPoolInfo, nullptr, &queryPools[i]));
+			CheckReturn(CreateCommandBuffer(&cmdBuffers[i]));
+			CheckReturn(CreateCommandBuffer(&uploadCmdBuffers[i]));
+			CheckReturnFail(vkCreateFence(vkDevice, &fenceInfo, nullptr, &fences[i]));
+			CheckReturnFail(vkCreateSemaphore(
+				vkDevice,
+				&semaphoreInfo,
+				nullptr,
+				&imageAcquiredSemaphores[i]));
+			CheckReturnFail(vkCreateSemaphore(
+				vkDevice,
+				&semaphoreInfo,
+				nullptr,
+				&renderFinishedSemaphores[i]));
+		}
 
 		Buffer *vertexBuffer;
 		CreateBuffer(
@@ -1035,17 +1230,33 @@ namespace gpu
 			this,
 			swapChain,
 			vertexBuffer,
-			cmdBuffer,
+			cmdBuffers,
+			uploadCmdBuffers,
+			fences,
+			imageAcquiredSemaphores,
+			renderFinishedSemaphores,
+			queryPools,
+			vertexShader,
+			fragmentShader,
 			pipeline);
+		vertexShader->Unref();
+		fragmentShader->Unref();
 
 		return HResultSuccess;
 	}
 	HResult GpuDevice::CreateBitmap(
 		uint32 width,
 		uint32 height,
-		Bitmap **ppBitmap)
+		Bitmap **ppBitmap,
+		bool mipmaps)
 	{
-		*ppBitmap = new Bitmap(this, width, height);
+		Bitmap *bitmap = new Bitmap(this, width, height, mipmaps);
+		if (bitmap->memOffset == UINT32_MAX)
+		{
+			bitmap->Unref();
+			return HResultFail;
+		}
+		*ppBitmap = bitmap;
 
 		return HResultSuccess;
 	}
@@ -1056,6 +1267,7 @@ namespace gpu
 	{
 		if (count == 0) return HResultInvalidArgument;
 		uint32 memOffset = AllocateMemory(count * sizeof(GradientStop));
+		if (memOffset == UINT32_MAX) return HResultFail;
 		void *mapped;
 		MapMemory(memOffset, count * sizeof(GradientStop), &mapped);
 		memcpy(mapped, stops, count * sizeof(GradientStop));
@@ -11,12 +11,26 @@
 #include "graphics\Color.h"
 #include "gpu\GradientCollection.h"
 #include <vector>
+#include <string>
 #include <concrt.h>
+#include <atomic>
 
 #include <fstream>
 
 namespace gpu
 {
+	struct GpuMemoryStatistics
+	{
+		uint32 heapSize;
+		uint32 allocatedSize;
+		uint32 allocationCount;
+		uint32 largestFreeBlock;
+		// Percentage of free space outside the largest free block
+		float32 fragmentation;
+		// Live allocations by power of two block count
+		uint32 sizeClassCounts[32];
+	};
+
 	class GpuDevice : public SharedObject
 	{
 		friend class GpuMemoryManager;
@@ -46,9 +60,71 @@ namespace gpu
 		VkPipelineLayout vkPipelineLayout;
 		uint32 graphicsQueueFamilyIndex;
 		VkQueue vkGraphicsQueue;
+		// False without the surface and swapchain extensions, e.g. on a
+		// headless machine; only offscreen render targets can be created
+		bool presentationSupported;
+		// The queue and the command pool are externally synchronized; every
+		// submit, present and command buffer allocation or free takes it
+		concurrency::critical_section queueSection;
+		GpuDeviceOptions options;
+		std::string pipelineCachePath;
+		VkPipelineCache vkPipelineCache;
+		size_t pipelineCacheSize;
 		Buffer *storageBuffer;
 		GpuMemoryManager *memManager;
+		// The storage heap stays mapped for the device lifetime; writers share
+		// heapLock and only a heap resize or an upload takes it exclusively.
+		// With a device local heap this is a CPU copy instead
+		uint8 *heapData;
+		concurrency::reader_writer_lock heapLock;
 		concurrency::critical_section memorySection;
+		struct DeferredDeallocation
+		{
+			uint32 offset;
+			uint64 serial;
+		};
+		struct PendingFrame
+		{
+			uint64 serial;
+			// Signaled once the frame completes
+			VkFence fence;
+		};
+		// Heap blocks freed while frames are in flight are released once
+		// every frame begun before the free has completed
+		uint64 frameSerial;
+		std::vector<PendingFrame> pendingFrames;
+		std::vector<DeferredDeallocation> deferredDeallocations;
+		struct DirtyRange
+		{
+			uint32 offset;
+			uint32 size;
+		};
+		struct StagingBlock
+		{
+			uint32 start;
+			uint32 end;
+			uint64 serial;
+			// Signaled by the upload that copies the block
+			VkFence fence;
+		};
+		// Uploads to a device local heap are staged in a ring whose blocks
+		// are reclaimed with the frame that copied them, or earlier through
+		// their fence when the ring is full
+		std::vector<DirtyRange> dirtyRanges;
+		concurrency::critical_section dirtySection;
+		Buffer *stagingBuffer;
+		uint8 *stagingData;
+		uint32 stagingHead;
+		uint32 stagingTail;
+		std::vector<StagingBlock> stagingBlocks;
+		// Fences of retired blocks, reused by later uploads
+		std::vector<VkFence> stagingFences;
+		concurrency::critical_section stagingSection;
+		// Bytes written to the storage heap, counted when copied to a device
+		// local heap or when mapped for a host visible one
+		std::atomic<uint64> storageBytesUploaded;
+		// Valid bits of graphics queue timestamps, zero when unsupported
+		uint64 timestampMask;
 		VkSampleCountFlagBits msaa;
 
 		GpuDevice(
@@ -63,13 +139,38 @@ namespace gpu
 			VkDescriptorSet vkDescSet,
 			VkPipelineLayout vkPipelineLayout,
 			uint32 graphicsQueueFamilyIndex,
-			VkQueue vkGraphicsQueue);
+			VkQueue vkGraphicsQueue,
+			bool presentationSupported,
+			GpuDeviceOptions &options);
 		~GpuDevice();
 		uint32 AllocateMemory(uint32 size);
 		void DeallocateMemory(uint32 offset);
+		uint64 BeginFrame(VkFence fence);
+		void CompleteFrame(uint64 serial);
+		// Blocks until every pending frame up to serial has completed
+		void WaitForFrames(uint64 serial);
+		HResult ResizeStorageHeap(uint32 oldSize, uint32 newSize);
+		HResult AcquireStagingFence(VkFence *fence);
+		void RetireStagingBlocks(uint32 count);
+		HResult AllocateStaging(uint32 size, uint32 *offset);
+		void SubmitStorageUploads(CommandBuffer *cmdBuffer, uint64 serial);
 		void MapMemory(uint32 offset, uint32 size, void **ppData);
 		void UnmapMemory();
 		void UpdateStorageBuffer();
+		// The file starts with the driver version and cache UUID it was
+		// written for; reading a mismatched or truncated one yields no data
+		static void ReadPipelineCacheFile(
+			const std::string &path,
+			uint32 driverVersion,
+			const uint8 *uuid,
+			std::vector<uint8> *data);
+		static void WritePipelineCacheFile(
+			const std::string &path,
+			uint32 driverVersion,
+			const uint8 *uuid,
+			std::vector<uint8> &data);
+		void LoadPipelineCache();
+		void SavePipelineCache();
 		bool GetMemoryTypeFromRequirements(
 			VkPhysicalDevice vkPhysicalDevice,
 			uint32 typeBits,
@@ -88,12 +189,25 @@ namespace gpu
 			uint32 height,
 			Surface *surface,
 			SwapChain **ppSwapChain);
+		HResult CreateOffscreenSwapChain(
+			uint32 width,
+			uint32 height,
+			uint32 imageCount,
+			SwapChain **ppSwapChain);
+		HResult CreateRenderTarget(
+			SwapChain *swapChain,
+			RenderTarget **ppRenderTarget);
 		HResult CreatePipeline(
 			SwapChain* swapChain,
 			Shader *vertexShader,
 			Shader *fragmentShader,
-			Pipeline **ppPipeline);
+			Pipeline **ppPipeline,
+			VkSpecializationInfo *fragmentSpecialization = nullptr);
 		HResult CreateCommandBuffer(CommandBuffer **ppCommandBuffer);
+		HResult CopyBuffer(
+			Buffer *source,
+			Buffer *destination,
+			uint32 size);
 		HResult CreateBuffer(
 			VkBufferUsageFlags vkBufferType,
 			uint32 memoryTypeBits,
@@ -101,15 +215,23 @@ namespace gpu
 			Buffer **ppBuffer);
 	public:
 		VkInstance GetVkInstance();
+		bool IsPresentationSupported();
+		void GetMemoryStatistics(GpuMemoryStatistics *statistics);
 		HResult CreateRenderTarget(
 			uint32 width,
 			uint32 height,
 			Surface *surface,
 			RenderTarget **ppRenderTarget);
+		// Renders into device images instead of a window; see RenderTarget::ReadPixels
+		HResult CreateOffscreenRenderTarget(
+			uint32 width,
+			uint32 height,
+			RenderTarget **ppRenderTarget);
 		HResult CreateBitmap(
 			uint32 width,
 			uint32 height,
-			Bitmap **ppBitmap);
+			Bitmap **ppBitmap,
+			bool mipmaps = false);
 		HResult CreateGradientCollection(
 			GradientStop *stops,
 			uint32 count,
@@ -5,10 +5,32 @@
 #include "gpu\GpuDevice.h"
 #include "gpu\GpuMemoryManager.h"
 #include <vector>
+#include <cstring>
 
 namespace gpu
 {
 	GpuDevice *gpuDevice;
+	GpuDeviceOptions gpuDeviceOptions = {};
+
+	void SetGpuDeviceOptions(GpuDeviceOptions *options)
+	{
+		gpuDeviceOptions = *options;
+	}
+
+	static bool HasExtensions(
+		std::vector<VkExtensionProperties> &available,
+		char8 **names,
+		uint32 count)
+	{
+		for (uint32 i = 0; i < count; i++)
+		{
+			bool found = false;
+			for (VkExtensionProperties &extension : available)
+				found |= strcmp(extension.extensionName, names[i]) == 0;
+			if (!found) return false;
+		}
+		return true;
+	}
 
 	HResult GpuInitialize()
 	{
@@ -26,9 +48,15 @@ namespace gpu
 		instInfo.pNext = nullptr;
 		instInfo.flags = 0;
 		instInfo.pApplicationInfo = &appInfo;
+		// Presentation is optional, so offscreen rendering works headless
+		uint32 extensionCount = 0;
+		vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, nullptr);
+		std::vector<VkExtensionProperties> extensionProps(extensionCount);
+		vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, extensionProps.data());
 		char8 *extensions[] = { VK_KHR_SURFACE_EXTENSION_NAME, VK_KHR_WIN32_SURFACE_EXTENSION_NAME };
-		instInfo.enabledExtensionCount = ARRAYSIZE(extensions);
-		instInfo.ppEnabledExtensionNames = extensions;
+		bool presentationSupported = HasExtensions(extensionProps, extensions, ARRAYSIZE(extensions));
+		instInfo.enabledExtensionCount = presentationSupported ? ARRAYSIZE(extensions) : 0;
+		instInfo.ppEnabledExtensionNames = presentationSupported ? extensions : nullptr;
 		instInfo.enabledLayerCount = 0;
 		instInfo.ppEnabledLayerNames = nullptr;
 		CheckReturnFail(vkCreateInstance(&instInfo, nullptr, &vkInstance));
@@ -87,9 +115,21 @@ namespace gpu
 		deviceInfo.pNext = nullptr;
 		deviceInfo.pQueueCreateInfos = queueCreateInfo.data();
 		deviceInfo.queueCreateInfoCount = queueCreateInfo.size();
+		if (presentationSupported)
+		{
+			vkEnumerateDeviceExtensionProperties(vkPhysicalDevice, nullptr, &extensionCount, nullptr);
+			extensionProps.resize(extensionCount);
+			vkEnumerateDeviceExtensionProperties(
+				vkPhysicalDevice,
+				nullptr,
+				&extensionCount,
+				extensionProps.data());
+		}
 		char8 *deviceExtensions[] = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
-		deviceInfo.enabledExtensionCount = ARRAYSIZE(deviceExtensions);
-		deviceInfo.ppEnabledExtensionNames = deviceExtensions;
+		presentationSupported = presentationSupported
+			&& HasExtensions(extensionProps, deviceExtensions, ARRAYSIZE(deviceExtensions));
+		deviceInfo.enabledExtensionCount = presentationSupported ? ARRAYSIZE(deviceExtensions) : 0;
+		deviceInfo.ppEnabledExtensionNames = presentationSupported ? deviceExtensions : nullptr;
 		deviceInfo.enabledLayerCount = 0;
 		deviceInfo.ppEnabledLayerNames = nullptr;
 		deviceInfo.pEnabledFeatures = nullptr;
@@ -160,15 +200,11 @@ namespace gpu
 			&descAllocInfo,
 			&vkDescSet);
 
-		VkPushConstantRange vkPushConstantRange;
-		vkPushConstantRange.offset = 0;
-		vkPushConstantRange.size = 128;
-		vkPushConstantRange.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
 		VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo;
 		pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
 		pipelineLayoutCreateInfo.pNext = nullptr;
-		pipelineLayoutCreateInfo.pushConstantRangeCount = 1;
-		pipelineLayoutCreateInfo.pPushConstantRanges = &vkPushConstantRange;
+		pipelineLayoutCreateInfo.pushConstantRangeCount = 0;
+		pipelineLayoutCreateInfo.pPushConstantRanges = nullptr;
 		pipelineLayoutCreateInfo.setLayoutCount = 1;
 		pipelineLayoutCreateInfo.pSetLayouts = &descSetLayout;
 		pipelineLayoutCreateInfo.flags = 0;
@@ -191,7 +227,9 @@ namespace gpu
 			vkDescSet,
 			vkPipelineLayout,
 			graphicsQueueFamilyIndex,
-			vkGraphicsQueue);
+			vkGraphicsQueue,
+			presentationSupported,
+			gpuDeviceOptions);
 
 		return HResultSuccess;
 	}
@@ -6,6 +6,22 @@
 
 namespace gpu
 {
+	struct GpuDeviceOptions
+	{
+		// Keeps the storage heap in device local memory; writes go to a CPU
+		// copy and are uploaded before the next frame
+		bool deviceLocalStorage;
+		// File the pipeline cache is kept in between runs, PipelineCache.bin
+		// in the working directory when null
+		const char8 *pipelineCachePath;
+		// 1, 2, 4 or 8 samples per pixel, 8 when zero; lowered to the largest
+		// count the device supports. Geometry computes its own coverage, so
+		// a single sample only loses antialiasing on primitive edges
+		uint32 sampleCount;
+	};
+
+	// Takes effect when called before GpuInitialize
+	void SetGpuDeviceOptions(GpuDeviceOptions *options);
 	HResult GpuInitialize();
 
 	void QueryGpuDevice(GpuDevice **ppGpuDevice);
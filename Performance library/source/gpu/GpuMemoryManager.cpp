@@ -3,145 +3,157 @@
 
 #include "gpu\GpuMemoryManager.h"
 #include "gpu\GpuDevice.h"
-#include "gpu\Buffer.h"
 
 namespace gpu
 {
-	GpuMemoryManager::GpuMemoryManager(
-		GpuDevice *device,
-		Buffer *storageBuffer)
+	GpuMemoryManager::GpuMemoryManager(GpuDevice *device)
 	{
 		this->device = device;
-		this->storageBuffer = storageBuffer;
-		root = new Node(InitialHeapSize);
 		heapSize = InitialHeapSize;
+		rootOrder = BlockOrder(heapSize / BlockSize);
+		freeOrders.resize(2 << rootOrder);
+		freeOrders[1] = (uint8)(rootOrder + 1);
+		allocatedSize = 0;
+		for (uint32 i = 0; i < SizeClassCount; i++)
+			sizeClassCounts[i] = 0;
 	}
 	GpuMemoryManager::~GpuMemoryManager()
 	{
-		delete root;
 	}
-	void GpuMemoryManager::AllocBlock(Node *node, uint32 size)
+	uint32 GpuMemoryManager::BlockOrder(uint32 blockCount)
 	{
-		rangeDiv2 = range >> 1;
-		if (rangeDiv2 < size)
+		uint32 order = 0;
+		while ((1u << order) < blockCount) order++;
+		return order;
+	}
+	void GpuMemoryManager::UpdateParents(uint32 node, uint32 order)
+	{
+		while (node > 1)
 		{
-			if (range == size)
-			{
-				node->maxAlloc = 0;
-				node->allocated = size;
-			}
-			else
-			{
-				node->left = new Node(rangeDiv2);
-				node->left->allocated = size;
-				node->left->maxAlloc = 0;
-				node->right = new Node(rangeDiv2);
-				range = rangeDiv2;
-				AllocBlock(node->right, size - rangeDiv2);
-				node->maxAlloc = node->right->maxAlloc;
-			}
+			node >>= 1;
+			uint8 left = freeOrders[node << 1], right = freeOrders[(node << 1) + 1];
+			if (left == order + 1 && right == order + 1)
+				freeOrders[node] = (uint8)(order + 2);
+			else freeOrders[node] = Max(left, right);
+			order++;
 		}
-		else
+	}
+	bool GpuMemoryManager::GrowHeap(uint32 order)
+	{
+		// The storage buffer is resized first, so a failure leaves the tree
+		// describing the heap that actually exists
+		uint32 newRootOrder = rootOrder;
+		uint8 rootFree = freeOrders[1];
+		while (rootFree < order + 1)
 		{
-			range = rangeDiv2;
-			if (node->left == nullptr)
-			{
-				node->left = new Node(rangeDiv2);
-				node->right = new Node(rangeDiv2);
-			}
-			if (size <= node->left->maxAlloc)
-				AllocBlock(node->left, size);
-			else
+			rootFree = (uint8)(rootFree == newRootOrder + 1 ? newRootOrder + 2 : newRootOrder + 1);
+			newRootOrder++;
+		}
+		if (device->ResizeStorageHeap(heapSize, BlockSize << newRootOrder) != HResultSuccess)
+			return false;
+
+		// The old tree becomes the left subtree of the new root, level by level
+		while (rootOrder < newRootOrder)
+		{
+			std::vector<uint8> grown(4 << rootOrder);
+			for (uint32 level = 0; level <= rootOrder; level++)
 			{
-				offset += rangeDiv2;
-				AllocBlock(node->right, size);
+				uint32 first = 1u << level;
+				for (uint32 i = 0; i < first; i++)
+					grown[(first << 1) + i] = freeOrders[first + i];
 			}
-			node->maxAlloc = Max(node->left->maxAlloc, node->right->maxAlloc);
+			grown[3] = (uint8)(rootOrder + 1);
+			if (grown[2] == rootOrder + 1) grown[1] = (uint8)(rootOrder + 2);
+			else grown[1] = (uint8)(rootOrder + 1);
+			freeOrders.swap(grown);
+			rootOrder++;
 		}
+		heapSize = BlockSize << rootOrder;
+		return true;
 	}
-	void GpuMemoryManager::DeallocBlock(Node *node, uint32 offset, uint32 range, uint32 addr)
+	uint32 GpuMemoryManager::Allocate(uint32 size)
 	{
-		uint32 rangeDiv2 = range >> 1;
-		if (offset == addr)
+		uint32 blockCount = Max((size + BlockSize - 1) / BlockSize, 1u);
+		uint32 order = BlockOrder(blockCount);
+		if (freeOrders[1] < order + 1 && !GrowHeap(order)) return UINT32_MAX;
+
+		uint32 node = 1, nodeOrder = rootOrder;
+		while (nodeOrder > order)
 		{
-			if (node->allocated != 0)
-			{
-				node->allocated = 0;
-				node->maxAlloc = range;
-			}
-			else if (node->left->allocated != 0)
+			if (freeOrders[node] == nodeOrder + 1)
 			{
-				if (node->left->allocated != rangeDiv2)
-					DeallocBlock(node->right, offset + rangeDiv2, rangeDiv2, offset + rangeDiv2);
-				node->left->allocated = 0;
-				node->left->maxAlloc = rangeDiv2;
+				freeOrders[node << 1] = (uint8)nodeOrder;
+				freeOrders[(node << 1) + 1] = (uint8)nodeOrder;
 			}
-			else DeallocBlock(node->left, offset, rangeDiv2, addr);
+			node <<= 1;
+			nodeOrder--;
+			if (freeOrders[node] < order + 1) node++;
 		}
-		else if (addr < offset + rangeDiv2)
-			DeallocBlock(node->left, offset, rangeDiv2, addr);
-		else
-			DeallocBlock(node->right, offset + rangeDiv2, rangeDiv2, addr);
-		if (node->left != nullptr)
+		uint32 offset = (node - (1u << (rootOrder - order))) * (BlockSize << order);
+
+		// Only the leading blocks are taken; the unused tail of the buddy
+		// block stays free in halving pieces
+		uint32 remaining = blockCount;
+		while (remaining != 1u << nodeOrder)
 		{
-			if (node->left->maxAlloc == rangeDiv2
-				&& node->right->maxAlloc == rangeDiv2)
+			uint32 half = 1u << (nodeOrder - 1);
+			freeOrders[node << 1] = (uint8)nodeOrder;
+			freeOrders[(node << 1) + 1] = (uint8)nodeOrder;
+			if (remaining > half)
 			{
-				delete node->left;
-				node->left = nullptr;
-				delete node->right;
-				node->right = nullptr;
-				node->maxAlloc = range;
+				freeOrders[node << 1] = 0;
+				remaining -= half;
+				node = (node << 1) + 1;
 			}
-			else node->maxAlloc = Max(node->left->maxAlloc, node->right->maxAlloc);
+			else node <<= 1;
+			nodeOrder--;
 		}
-		else node->maxAlloc = range;
+		freeOrders[node] = 0;
+		UpdateParents(node, nodeOrder);
+
+		allocations[offset] = blockCount;
+		allocatedSize += blockCount * BlockSize;
+		sizeClassCounts[order]++;
+		return offset;
 	}
-	uint32 GpuMemoryManager::Allocate(uint32 size)
+	void GpuMemoryManager::Deallocate(uint32 addr)
 	{
-		if (root->maxAlloc < size)
+		auto iter = allocations.find(addr);
+		if (iter == allocations.end()) return;
+		uint32 blockCount = iter->second;
+		allocations.erase(iter);
+		uint32 order = BlockOrder(blockCount);
+		allocatedSize -= blockCount * BlockSize;
+		sizeClassCounts[order]--;
+
+		// Retrace the leading blocks; the tail pieces may be in use again
+		uint32 node = (1u << (rootOrder - order)) + addr / (BlockSize << order);
+		uint32 nodeOrder = order, remaining = blockCount;
+		while (remaining != 1u << nodeOrder)
 		{
-			void *data = new uint8[heapSize], *gpuData;
-			vkMapMemory(
-				device->vkDevice,
-				storageBuffer->vkBufferMemory,
-				0,
-				heapSize,
-				0,
-				&gpuData);
-			memcpy(data, gpuData, heapSize);
-			vkUnmapMemory(storageBuffer->device->vkDevice, storageBuffer->vkBufferMemory);
-			uint32 oldHeapSize = heapSize;
-			while (root->maxAlloc < size)
+			uint32 half = 1u << (nodeOrder - 1);
+			if (remaining > half)
 			{
-				Node *node = new Node(heapSize << 1);
-				node->left = root;
-				node->right = new Node(heapSize);
-				root = node;
-				if (root->left->maxAlloc == heapSize) root->maxAlloc = heapSize << 1;
-				else root->maxAlloc = Max(root->left->maxAlloc, root->right->maxAlloc);
-				heapSize <<= 1;
+				freeOrders[node << 1] = (uint8)nodeOrder;
+				remaining -= half;
+				node = (node << 1) + 1;
 			}
-			storageBuffer->Resize(heapSize);
-			device->UpdateStorageBuffer();
-			vkMapMemory(
-				storageBuffer->device->vkDevice,
-				storageBuffer->vkBufferMemory,
-				0,
-				oldHeapSize,
-				0,
-				&gpuData);
-			memcpy(gpuData, data, oldHeapSize);
-			delete[] data;
-			vkUnmapMemory(storageBuffer->device->vkDevice, storageBuffer->vkBufferMemory);
+			else node <<= 1;
+			nodeOrder--;
 		}
-		offset = 0;
-		range = heapSize;
-		AllocBlock(root, size);
-		return offset;
+		freeOrders[node] = (uint8)(nodeOrder + 1);
+		UpdateParents(node, nodeOrder);
 	}
-	void GpuMemoryManager::Deallocate(uint32 addr)
+	void GpuMemoryManager::GetStatistics(GpuMemoryStatistics *statistics)
 	{
-		DeallocBlock(root, 0, heapSize, addr);
+		statistics->heapSize = heapSize;
+		statistics->allocatedSize = allocatedSize;
+		statistics->allocationCount = (uint32)allocations.size();
+		statistics->largestFreeBlock = freeOrders[1] == 0 ? 0 : BlockSize << (freeOrders[1] - 1);
+		uint32 freeSize = heapSize - allocatedSize;
+		statistics->fragmentation = freeSize == 0 ? 0.0f
+			: 100.0f * (1.0f - (float32)statistics->largestFreeBlock / (float32)freeSize);
+		for (uint32 i = 0; i < SizeClassCount; i++)
+			statistics->sizeClassCounts[i] = sizeClassCounts[i];
 	}
 }
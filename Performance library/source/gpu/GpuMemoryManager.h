@@ -4,52 +4,40 @@
 #pragma once
 #include "kernel\kernel.h"
 #include "atc\StaticOperators.h"
+#include <vector>
+#include <unordered_map>
 
 namespace gpu
 {
+	struct GpuMemoryStatistics;
+
 	class GpuMemoryManager
 	{
 		friend class GpuDevice;
 	protected:
 		static constexpr uint32 InitialHeapSize = 2 << 15;
-		struct Node
-		{
-			uint32 allocated;
-			uint32 maxAlloc;
-			Node *left;
-			Node *right;
-			Node(uint32 size)
-			{
-				this->allocated = 0;
-				this->maxAlloc = size;
-				left = nullptr;
-				right = nullptr;
-			}
-			~Node()
-			{
-				if (left != nullptr)
-				{
-					delete left;
-					delete right;
-				}
-			}
-		};
-		Node *root;
+		static constexpr uint32 BlockSize = 64;
+		static constexpr uint32 SizeClassCount = 32;
+		// Implicit buddy tree: node i has children 2i and 2i + 1, the root is 1.
+		// Each entry holds the order of the largest free block under the node
+		// plus one, zero when the node has no free space
+		std::vector<uint8> freeOrders;
+		uint32 rootOrder;
 		uint32 heapSize;
-		uint32 offset;
-		uint32 range;
-		uint32 rangeDiv2;
+		std::unordered_map<uint32, uint32> allocations;
+		uint32 allocatedSize;
+		uint32 sizeClassCounts[SizeClassCount];
 		GpuDevice *device;
-		Buffer *storageBuffer;
 
-		GpuMemoryManager(
-			GpuDevice *device,
-			Buffer *storageBuffer);
+		GpuMemoryManager(GpuDevice *device);
 		~GpuMemoryManager();
-		void AllocBlock(Node *node, uint32 size);
-		void DeallocBlock(Node *node, uint32 offset, uint32 range, uint32 addr);
+		static uint32 BlockOrder(uint32 blockCount);
+		void UpdateParents(uint32 node, uint32 order);
+		bool GrowHeap(uint32 order);
 	public:
+		// Returns UINT32_MAX when the heap cannot grow to fit the allocation
 		uint32 Allocate(uint32 size);
 		void Deallocate(uint32 addr);
+		void GetStatistics(GpuMemoryStatistics *statistics);
 	};
 }
@@ -7,7 +7,12 @@
 #include "gpu\Buffer.h"
 #include "gpu\CommandBuffer.h"
 #include "gpu\Pipeline.h"
+#include "gpu\Shader.h"
 #include "gpu\Bitmap.h"
+#include "graphics\GlyphAtlas.h"
+#include "util\Time.h"
+#include <algorithm>
+#include <iomanip>
 
 namespace gpu
 {
@@ -15,30 +20,284 @@ namespace gpu
 		GpuDevice *device,
 		SwapChain *swapChain,
 		Buffer *vertexBuffer,
-		CommandBuffer *cmdBuffer,
+		CommandBuffer **cmdBuffers,
+		CommandBuffer **uploadCmdBuffers,
+		VkFence *fences,
+		VkSemaphore *imageAcquiredSemaphores,
+		VkSemaphore *renderFinishedSemaphores,
+		VkQueryPool *queryPools,
+		Shader *vertexShader,
+		Shader *fragmentShader,
 		Pipeline *pipeline)
 	{
 		device->AddRef();
 		this->device = device;
 		swapChain->AddRef();
 		this->swapChain = swapChain;
+		VertexChunk chunk;
+		chunk.buffer = vertexBuffer;
+		chunk.frame = 0;
 		vertexBuffer->AddRef();
-		this->vertexBuffer = vertexBuffer;
-		cmdBuffer->AddRef();
-		this->cmdBuffer = cmdBuffer;
+		vertexBuffer->MapMemory(0, vertexBufferSize, (void **)&chunk.instances);
+		vertexChunks.push_back(chunk);
+		instances = chunk.instances;
+		for (uint32 i = 0; i < framesInFlight; i++)
+		{
+			cmdBuffers[i]->AddRef();
+			frames[i].cmdBuffer = cmdBuffers[i];
+			uploadCmdBuffers[i]->AddRef();
+			frames[i].uploadCmdBuffer = uploadCmdBuffers[i];
+			frames[i].fence = fences[i];
+			frames[i].imageAcquired = imageAcquiredSemaphores[i];
+			frames[i].renderFinished = renderFinishedSemaphores[i];
+			frames[i].frame = 0;
+			frames[i].serial = 0;
+			frames[i].readbackBuffer = nullptr;
+			frames[i].readbackData = nullptr;
+			frames[i].readbackTarget = nullptr;
+			frames[i].queryPool = queryPools[i];
+			frames[i].queryCount = 0;
+			frames[i].timings = {};
+			frames[i].timingsPending = false;
+		}
+		frameIndex = 0;
+		cmdBuffer = frames[0].cmdBuffer;
+		vertexShader->AddRef();
+		this->vertexShader = vertexShader;
+		fragmentShader->AddRef();
+		this->fragmentShader = fragmentShader;
 		pipeline->AddRef();
 		this->pipeline = pipeline;
-		currentVertex = 0;
+		for (Pipeline *&specialized : specializedPipelines)
+			specialized = nullptr;
+		specializedPipelinesEnabled = true;
+		boundPipeline = nullptr;
+		currentInstance = 0;
+		batchStart = 0;
+		currentFrame = 0;
+		completedFrame = 0;
+		frameStatistics = {};
+		statistics = {};
+		frameStart = 0;
+		geometryPrepareTime = 0;
+		storageBytesAtBegin = 0;
+		timings = {};
+		traceCapture = false;
+		glyphAtlas = nullptr;
 	}
 	RenderTarget::~RenderTarget()
 	{
-		device->Unref();
+		WaitIdle();
+		DestroyReadbackBuffers();
+		delete glyphAtlas;
+		for (uint32 i = 0; i < framesInFlight; i++)
+		{
+			frames[i].cmdBuffer->Unref();
+			frames[i].uploadCmdBuffer->Unref();
+			vkDestroyFence(device->vkDevice, frames[i].fence, nullptr);
+			vkDestroySemaphore(device->vkDevice, frames[i].imageAcquired, nullptr);
+			vkDestroySemaphore(device->vkDevice, frames[i].renderFinished, nullptr);
+			if (frames[i].queryPool != VK_NULL_HANDLE)
+				vkDestroyQueryPool(device->vkDevice, frames[i].queryPool, nullptr);
+		}
+		for (VertexChunk &chunk : vertexChunks)
+		{
+			chunk.buffer->UnmapMemory();
+			chunk.buffer->Unref();
+		}
+		for (Pipeline *specialized : specializedPipelines)
+		{
+			if (specialized != nullptr) specialized->Unref();
+		}
 		swapChain->Unref();
-		vertexBuffer->Unref();
-		cmdBuffer->Unref();
 		pipeline->Unref();
+		vertexShader->Unref();
+		fragmentShader->Unref();
+		device->Unref();
+	}
+	void RenderTarget::UpdateCompletedFrames()
+	{
+		for (uint32 i = 0; i < framesInFlight; i++)
+		{
+			if (frames[i].frame > completedFrame
+				&& vkGetFenceStatus(device->vkDevice, frames[i].fence) == VK_SUCCESS)
+				completedFrame = frames[i].frame;
+		}
+	}
+	void RenderTarget::WaitIdle()
+	{
+		device->queueSection.lock();
+		vkDeviceWaitIdle(device->vkDevice);
+		device->queueSection.unlock();
+		// Oldest slot first so the latest timings end up current
+		for (uint32 i = 1; i <= framesInFlight; i++)
+		{
+			FrameResources &slot = frames[(frameIndex + i) % framesInFlight];
+			device->CompleteFrame(slot.serial);
+			slot.serial = 0;
+			CompleteReadback(slot);
+			ResolveTimings(slot);
+		}
+		completedFrame = currentFrame;
+	}
+	HResult RenderTarget::CreateReadbackBuffers()
+	{
+		uint32 size = swapChain->GetWidth() * swapChain->GetHeight() * sizeof(uint32);
+		for (uint32 i = 0; i < framesInFlight; i++)
+		{
+			CheckReturn(device->CreateBuffer(
+				VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+				VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+				size,
+				&frames[i].readbackBuffer));
+			CheckReturn(frames[i].readbackBuffer->MapMemory(0, size, &frames[i].readbackData));
+		}
+		return HResultSuccess;
+	}
+	void RenderTarget::DestroyReadbackBuffers()
+	{
+		for (uint32 i = 0; i < framesInFlight; i++)
+		{
+			if (frames[i].readbackBuffer == nullptr) continue;
+			if (frames[i].readbackData != nullptr)
+				frames[i].readbackBuffer->UnmapMemory();
+			frames[i].readbackBuffer->Unref();
+			frames[i].readbackBuffer = nullptr;
+			frames[i].readbackData = nullptr;
+			frames[i].readbackTarget = nullptr;
+		}
+	}
+	void RenderTarget::CompleteReadback(FrameResources &slot)
+	{
+		if (slot.readbackTarget == nullptr) return;
+		memcpy(
+			slot.readbackTarget,
+			slot.readbackData,
+			swapChain->GetWidth() * swapChain->GetHeight() * sizeof(uint32));
+		slot.readbackTarget = nullptr;
+	}
+	void RenderTarget::ResolveTimings(FrameResources &slot)
+	{
+		if (!slot.timingsPending) return;
+		slot.timingsPending = false;
+		FrameTimings &frameTimings = slot.timings;
+		frameTimings.gpuTime = 0;
+		frameTimings.scopes.resize(slot.scopeQueries.size());
+		for (uint32 i = 0; i < slot.scopeQueries.size(); i++)
+		{
+			frameTimings.scopes[i].name = slot.scopeQueries[i].name;
+			frameTimings.scopes[i].depth = slot.scopeQueries[i].depth;
+			frameTimings.scopes[i].start = 0;
+			frameTimings.scopes[i].duration = 0;
+		}
+		uint64 results[maxTimestamps];
+		if (slot.queryPool != VK_NULL_HANDLE
+			&& vkGetQueryPoolResults(
+				device->vkDevice,
+				slot.queryPool,
+				0,
+				slot.queryCount,
+				sizeof(results),
+				results,
+				sizeof(uint64),
+				VK_QUERY_RESULT_64_BIT) == VK_SUCCESS)
+		{
+			float64 period = device->vkDeviceProp.limits.timestampPeriod;
+			uint64 mask = device->timestampMask;
+			frameTimings.gpuTime = (uint64)(((results[1] - results[0]) & mask) * period);
+			for (uint32 i = 0; i < slot.scopeQueries.size(); i++)
+			{
+				ScopeQueries &queries = slot.scopeQueries[i];
+				if (queries.beginQuery == UINT32_MAX) continue;
+				frameTimings.scopes[i].start = (uint64)(
+					((results[queries.beginQuery] - results[0]) & mask) * period);
+				frameTimings.scopes[i].duration = (uint64)(
+					((results[queries.endQuery] - results[queries.beginQuery]) & mask) * period);
+			}
+		}
+		timings = frameTimings;
+		if (traceCapture) traceFrames.push_back(frameTimings);
+	}
+	bool RenderTarget::PrepareGeometry(Geometry &geometry)
+	{
+		if (geometry.ready) return true;
+		int64 start = Time::Now();
+		bool prepared = geometry.Prepare();
+		geometryPrepareTime += Time::Now() - start;
+		frameStatistics.geometriesPrepared++;
+		return prepared;
+	}
+	HResult RenderTarget::AcquireVertexChunk()
+	{
+		FlushBatch();
+		UpdateCompletedFrames();
+		VertexChunk *chunk = nullptr;
+		for (VertexChunk &c : vertexChunks)
+		{
+			if (c.frame <= completedFrame)
+			{
+				chunk = &c;
+				break;
+			}
+		}
+		if (chunk == nullptr)
+		{
+			VertexChunk newChunk;
+			CheckReturn(device->CreateBuffer(
+				VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+				VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+				vertexBufferSize,
+				&newChunk.buffer));
+			if (newChunk.buffer->MapMemory(0, vertexBufferSize, (void **)&newChunk.instances) != HResultSuccess)
+			{
+				newChunk.buffer->Unref();
+				return HResultFail;
+			}
+			vertexChunks.push_back(newChunk);
+			chunk = &vertexChunks.back();
+		}
+		chunk->frame = currentFrame;
+		instances = chunk->instances;
+		currentInstance = 0;
+		batchStart = 0;
+		cmdBuffer->BindVertexBuffer(0, chunk->buffer);
+		return HResultSuccess;
 	}
-	void RenderTarget::PushVertex(Vector2f vertex)
+	Pipeline *RenderTarget::GetPipeline(uint32 renderMode, uint32 colorMode)
+	{
+		if (!specializedPipelinesEnabled) return pipeline;
+		Pipeline *&specialized = specializedPipelines[renderMode * colorModeCount + colorMode];
+		if (specialized != nullptr) return specialized;
+		// Constant ids 0 and 1 of the fragment shader
+		uint32 modes[2] = { renderMode, colorMode };
+		VkSpecializationMapEntry entries[2] = {
+			{ 0, 0, sizeof(uint32) },
+			{ 1, sizeof(uint32), sizeof(uint32) } };
+		VkSpecializationInfo specialization;
+		specialization.mapEntryCount = 2;
+		specialization.pMapEntries = entries;
+		specialization.dataSize = sizeof(modes);
+		specialization.pData = modes;
+		if (device->CreatePipeline(
+			swapChain,
+			vertexShader,
+			fragmentShader,
+			&specialized,
+			&specialization) != HResultSuccess)
+		{
+			pipeline->AddRef();
+			specialized = pipeline;
+		}
+		return specialized;
+	}
+	void RenderTarget::FlushBatch()
+	{
+		if (currentInstance == batchStart) return;
+		cmdBuffer->Draw(4, currentInstance - batchStart, 0, batchStart);
+		frameStatistics.drawsIssued++;
+		batchStart = currentInstance;
+	}
+	Vector2f RenderTarget::TransformVertex(Vector2f vertex)
 	{
 		vertex.x /= fc.decayX;
 		vertex.y /= fc.decayY;
@@ -51,14 +310,43 @@ namespace gpu
 			+ fc.transform[2][1];
 		vertex.x = vertex.x*projX - 1.0f;
 		vertex.y = vertex.y*projY - 1.0f;
-		vertices[currentVertex++] = vertex;
+		return vertex;
+	}
+	void RenderTarget::DrawQuad(
+		Vector2f v1,
+		Vector2f v2,
+		Vector2f v3,
+		Vector2f v4)
+	{
+		// Quads are only appended here; consecutive ones go out as a single
+		// instanced draw once something that affects the pipeline state happens
+		Pipeline *required = GetPipeline(fc.renderMode, fc.colorMode);
+		if (required != boundPipeline)
+		{
+			FlushBatch();
+			cmdBuffer->BindPipeline(required);
+			boundPipeline = required;
+		}
+		if (currentInstance == instanceChunkCapacity
+			&& AcquireVertexChunk() != HResultSuccess)
+			return;
+		QuadInstance &instance = instances[currentInstance++];
+		instance.vertices[0] = TransformVertex(v1);
+		instance.vertices[1] = TransformVertex(v2);
+		instance.vertices[2] = TransformVertex(v3);
+		instance.vertices[3] = TransformVertex(v4);
+		instance.constants = fc;
+		frameStatistics.primitivesRecorded++;
+		frameStatistics.verticesPushed += 4;
+		frameStatistics.instanceBytesWritten += sizeof(QuadInstance);
 	}
 	HResult RenderTarget::CreateBitmap(
 		uint32 width,
 		uint32 height,
-		Bitmap **ppBitmap)
+		Bitmap **ppBitmap,
+		bool mipmaps)
 	{
-		return device->CreateBitmap(width, height, ppBitmap);
+		return device->CreateBitmap(width, height, ppBitmap, mipmaps);
 	}
 	HResult RenderTarget::CreateGradientCollection(
 		GradientStop *stops,
@@ -69,31 +357,262 @@ namespace gpu
 	}
 	void RenderTarget::Begin()
 	{
+		frameIndex = (frameIndex + 1) % framesInFlight;
+		FrameResources &slot = frames[frameIndex];
+		vkWaitForFences(device->vkDevice, 1, &slot.fence, VK_TRUE, UINT64_MAX);
+		completedFrame = Max(completedFrame, slot.frame);
+		device->CompleteFrame(slot.serial);
+		CompleteReadback(slot);
+		ResolveTimings(slot);
+		slot.serial = device->BeginFrame(slot.fence);
+		swapChain->AcquireNextImage(slot.imageAcquired);
+		cmdBuffer = slot.cmdBuffer;
+		frameStatistics = {};
+		frameStart = Time::Now();
+		geometryPrepareTime = 0;
+		storageBytesAtBegin = device->storageBytesUploaded;
+		slot.scopeQueries.clear();
+		openScopes.clear();
 		cmdBuffer->Begin();
+		slot.queryCount = 0;
+		if (slot.queryPool != VK_NULL_HANDLE)
+		{
+			cmdBuffer->ResetQueryPool(slot.queryPool, 0, maxTimestamps);
+			cmdBuffer->WriteTimestamp(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, slot.queryPool, 0);
+			slot.queryCount = 2;
+		}
+		// Storage uploads are submitted ahead of this command buffer in End
+		if (device->options.deviceLocalStorage)
+			cmdBuffer->PipelineBarrier(
+				VK_PIPELINE_STAGE_TRANSFER_BIT,
+				VK_ACCESS_TRANSFER_WRITE_BIT,
+				VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+				VK_ACCESS_SHADER_READ_BIT);
 		cmdBuffer->BeginRenderPass(swapChain);
 		cmdBuffer->SetViewport(0, 0, swapChain->GetWidth(), swapChain->GetHeight(), 0.0f, 1.0f);
 		cmdBuffer->BindPipeline(pipeline);
+		boundPipeline = pipeline;
 		cmdBuffer->BindDescriptorSet(device->vkDescSet);
 		projX = 2.0f / (float32)swapChain->GetWidth();
 		projY = 2.0f / (float32)swapChain->GetHeight();
-		vertexBuffer->MapMemory(0, vertexBufferSize, (void **)&vertices);
-		cmdBuffer->BindVertexBuffer(0, vertexBuffer);
+		currentFrame++;
+		AcquireVertexChunk();
 		SetSolidColorBrush(Color(Color::Black));
 		SetColorInterpolationMode(ColorInterpolationModeSmooth);
 		SetOpacity(1.0f);
 	}
 	void RenderTarget::End()
 	{
-		vertexBuffer->UnmapMemory();
-		currentVertex = 0;
+		FrameResources &slot = frames[frameIndex];
+		FlushBatch();
+		while (!openScopes.empty()) EndTimingScope();
 		cmdBuffer->EndRenderPass();
+		if (slot.readbackBuffer != nullptr)
+		{
+			// Ordered after the pass by its outgoing dependency, see SwapChain
+			cmdBuffer->CopyImageToBuffer(swapChain, slot.readbackBuffer);
+			cmdBuffer->PipelineBarrier(
+				VK_PIPELINE_STAGE_TRANSFER_BIT,
+				VK_ACCESS_TRANSFER_WRITE_BIT,
+				VK_PIPELINE_STAGE_HOST_BIT,
+				VK_ACCESS_HOST_READ_BIT);
+		}
+		if (slot.queryPool != VK_NULL_HANDLE)
+			cmdBuffer->WriteTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, slot.queryPool, 1);
 		cmdBuffer->End();
-		cmdBuffer->Submit(swapChain);
-		swapChain->Present();
+		vkResetFences(device->vkDevice, 1, &slot.fence);
+		slot.frame = currentFrame;
+		device->SubmitStorageUploads(slot.uploadCmdBuffer, slot.serial);
+		frameStatistics.storageBytesUploaded = device->storageBytesUploaded - storageBytesAtBegin;
+		slot.timings.frame = currentFrame;
+		slot.timings.cpuStart = frameStart;
+		slot.timings.cpuRecordTime = Time::Now() - frameStart;
+		slot.timings.geometryPrepareTime = geometryPrepareTime;
+		slot.timings.counters = frameStatistics;
+		slot.timingsPending = true;
+		if (swapChain->IsOffscreen())
+			cmdBuffer->Submit(swapChain, VK_NULL_HANDLE, VK_NULL_HANDLE, slot.fence);
+		else
+		{
+			cmdBuffer->Submit(
+				swapChain,
+				slot.imageAcquired,
+				slot.renderFinished,
+				slot.fence);
+			swapChain->Present(slot.renderFinished);
+		}
+		statistics = frameStatistics;
+	}
+	HResult RenderTarget::Resize(uint32 width, uint32 height)
+	{
+		WaitIdle();
+		CheckReturn(swapChain->Resize(width, height));
+		if (swapChain->IsOffscreen())
+		{
+			DestroyReadbackBuffers();
+			CheckReturn(CreateReadbackBuffers());
+		}
+		return HResultSuccess;
+	}
+	HResult RenderTarget::ReadPixels(void *data)
+	{
+		CheckReturn(ReadPixelsAsync(data));
+		FrameResources &slot = frames[frameIndex];
+		vkWaitForFences(device->vkDevice, 1, &slot.fence, VK_TRUE, UINT64_MAX);
+		CompleteReadback(slot);
+		return HResultSuccess;
+	}
+	HResult RenderTarget::ReadPixelsAsync(void *data)
+	{
+		FrameResources &slot = frames[frameIndex];
+		// Only a frame that has been ended and submitted can be read back
+		if (slot.readbackBuffer == nullptr
+			|| currentFrame == 0
+			|| slot.frame != currentFrame)
+			return HResultFail;
+		slot.readbackTarget = data;
+		return HResultSuccess;
+	}
+	void RenderTarget::FinishReadbacks()
+	{
+		for (uint32 i = 0; i < framesInFlight; i++)
+		{
+			if (frames[i].readbackTarget == nullptr) continue;
+			vkWaitForFences(device->vkDevice, 1, &frames[i].fence, VK_TRUE, UINT64_MAX);
+			CompleteReadback(frames[i]);
+		}
+	}
+	void RenderTarget::GetStatistics(RenderTargetStatistics *statistics)
+	{
+		*statistics = this->statistics;
+	}
+	void RenderTarget::BeginTimingScope(const char8 *name)
+	{
+		FlushBatch();
+		FrameResources &slot = frames[frameIndex];
+		ScopeQueries queries;
+		queries.name = name;
+		queries.depth = (uint32)openScopes.size();
+		queries.beginQuery = UINT32_MAX;
+		queries.endQuery = UINT32_MAX;
+		// Both queries are reserved up front so a scope is timed entirely or not at all
+		if (slot.queryPool != VK_NULL_HANDLE && slot.queryCount + 2 <= maxTimestamps)
+		{
+			queries.beginQuery = slot.queryCount;
+			queries.endQuery = slot.queryCount + 1;
+			slot.queryCount += 2;
+			cmdBuffer->WriteTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, slot.queryPool, queries.beginQuery);
+		}
+		openScopes.push_back((uint32)slot.scopeQueries.size());
+		slot.scopeQueries.push_back(queries);
+	}
+	void RenderTarget::EndTimingScope()
+	{
+		if (openScopes.empty()) return;
+		FlushBatch();
+		FrameResources &slot = frames[frameIndex];
+		ScopeQueries &queries = slot.scopeQueries[openScopes.back()];
+		openScopes.pop_back();
+		if (queries.endQuery != UINT32_MAX)
+			cmdBuffer->WriteTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, slot.queryPool, queries.endQuery);
+	}
+	void RenderTarget::GetFrameTimings(FrameTimings *timings)
+	{
+		*timings = this->timings;
+	}
+	void RenderTarget::BeginTraceCapture()
+	{
+		traceFrames.clear();
+		traceCapture = true;
+	}
+	static void WriteTraceEvent(
+		std::ofstream &file,
+		bool &first,
+		const char8 *name,
+		uint32 thread,
+		float64 timestamp,
+		float64 duration)
+	{
+		if (!first) file << ",";
+		first = false;
+		file << "\n{\"name\":\"";
+		for (const char8 *c = name; *c != 0; c++)
+		{
+			if (*c == '"' || *c == '\\') file << '\\';
+			file << *c;
+		}
+		file << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread
+			<< ",\"ts\":" << timestamp
+			<< ",\"dur\":" << duration << "}";
 	}
-	void RenderTarget::Resize(uint32 width, uint32 height)
+	HResult RenderTarget::EndTraceCapture(const char8 *fileName)
 	{
-		swapChain->Resize(width, height);
+		// Frames still in flight are resolved first
+		WaitIdle();
+		traceCapture = false;
+		std::ofstream file(fileName, std::ios::trunc);
+		if (!file.is_open())
+		{
+			traceFrames.clear();
+			return HResultCannotOpenFile;
+		}
+		std::sort(
+			traceFrames.begin(),
+			traceFrames.end(),
+			[](const FrameTimings &a, const FrameTimings &b) { return a.frame < b.frame; });
+		// Chrome trace times are microseconds. The GPU track is placed at the
+		// submission of each frame since the two clocks are not calibrated
+		int64 origin = traceFrames.empty() ? 0 : traceFrames[0].cpuStart;
+		bool first = true;
+		file << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+		for (FrameTimings &frame : traceFrames)
+		{
+			float64 cpuStart = (frame.cpuStart - origin) / 1000.0;
+			float64 gpuStart = cpuStart + frame.cpuRecordTime / 1000.0;
+			std::string name = "Frame " + std::to_string(frame.frame);
+			WriteTraceEvent(file, first, name.c_str(), 1, cpuStart, frame.cpuRecordTime / 1000.0);
+			if (frame.geometryPrepareTime != 0)
+				WriteTraceEvent(file, first, "Geometry preparation", 1, cpuStart, frame.geometryPrepareTime / 1000.0);
+			WriteTraceEvent(file, first, name.c_str(), 2, gpuStart, frame.gpuTime / 1000.0);
+			for (TimingScope &scope : frame.scopes)
+				WriteTraceEvent(file, first, scope.name, 2, gpuStart + scope.start / 1000.0, scope.duration / 1000.0);
+			RenderTargetStatistics &counters = frame.counters;
+			file << ",\n{\"name\":\"Counters\",\"ph\":\"C\",\"pid\":1,\"ts\":" << cpuStart
+				<< ",\"args\":{\"drawsIssued\":" << counters.drawsIssued
+				<< ",\"verticesPushed\":" << counters.verticesPushed
+				<< ",\"instanceBytesWritten\":" << counters.instanceBytesWritten
+				<< ",\"storageBytesUploaded\":" << counters.storageBytesUploaded
+				<< ",\"geometriesPrepared\":" << counters.geometriesPrepared << "}}";
+		}
+		file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+		traceFrames.clear();
+		return file.good() ? HResultSuccess : HResultFail;
+	}
+	GlyphAtlas *RenderTarget::GetGlyphAtlas()
+	{
+		if (glyphAtlas == nullptr)
+		{
+			Bitmap *bitmap;
+			if (CreateBitmap(GlyphAtlas::atlasSize, GlyphAtlas::atlasSize, &bitmap) != HResultSuccess)
+				return nullptr;
+			// The atlas only overwrites glyphs whose frames have completed
+			bitmap->waitForFrames = false;
+			glyphAtlas = new GlyphAtlas(this, bitmap);
+			bitmap->Unref();
+		}
+		return glyphAtlas;
+	}
+	uint64 RenderTarget::GetCurrentFrame()
+	{
+		return currentFrame;
+	}
+	uint64 RenderTarget::GetCompletedFrame()
+	{
+		return completedFrame;
+	}
+	void RenderTarget::SetSpecializedPipelines(bool enabled)
+	{
+		specializedPipelinesEnabled = enabled;
 	}
 	void RenderTarget::SetSolidColorBrush(Color color)
 	{
@@ -101,11 +620,6 @@ namespace gpu
 		fc.paramf[0] = color.r / 255.0f;
 		fc.paramf[1] = color.g / 255.0f;
 		fc.paramf[2] = color.b / 255.0f;
-		cmdBuffer->PushConstants(
-			&fc,
-			0,
-			6 * sizeof(float32),
-			VK_SHADER_STAGE_FRAGMENT_BIT);
 	}
 	void RenderTarget::SetLinearGradientBrush(
 		GradientCollection *gradientCollection,
@@ -119,11 +633,6 @@ namespace gpu
 		fc.paramf[1] = startPoint.y;
 		fc.paramf[2] = endPoint.x;
 		fc.paramf[3] = endPoint.y;
-		cmdBuffer->PushConstants(
-			&fc,
-			0,
-			7 * sizeof(float32),
-			VK_SHADER_STAGE_FRAGMENT_BIT);
 	}
 	void RenderTarget::SetRadialGradientBrush(
 		GradientCollection *gradientCollection,
@@ -141,45 +650,52 @@ namespace gpu
 		fc.paramf[3] = ry;
 		fc.paramf[4] = center.x + offset.x;
 		fc.paramf[5] = center.y + offset.y;
-		cmdBuffer->PushConstants(
-			&fc,
-			0,
-			9 * sizeof(float32),
-			VK_SHADER_STAGE_FRAGMENT_BIT);
 	}
 	void RenderTarget::SetBitmapBrush(
 		Bitmap *bitmap,
 		float32 x,
 		float32 y)
 	{
-		fc.colorMode = colorModeBitmap;
-		fc.colorOffset = bitmap->memOffset >> 2;
-		fc.colorCount = bitmap->width;
 		Vector2f startPoint = Vector3f(x, y, 1.0f)*bitmap->transform,
 			aw = (Vector3f(x + bitmap->width, y, 1.0f)*bitmap->transform) - startPoint,
 			ah = (Vector3f(x, y + bitmap->height, 1.0f)*bitmap->transform) - startPoint;
+		// Minified bitmaps sample the mip level whose texels cover about one pixel
+		float32 scale = Min(
+			VectorLength(aw) / (float32)bitmap->width,
+			VectorLength(ah) / (float32)bitmap->height);
+		uint32 level = 0;
+		while (level + 1 < bitmap->levels.size()
+			&& scale * (float32)(2u << level) <= 1.0f)
+			level++;
+		Bitmap::MipLevel &mipLevel = bitmap->levels[level];
+		bitmap->lastFrame = frames[frameIndex].serial;
+		fc.colorMode = colorModeBitmap;
+		fc.colorOffset = (bitmap->memOffset + mipLevel.offset) >> 2;
+		fc.colorCount = mipLevel.width;
 		fc.paramf[0] = startPoint.x;
 		fc.paramf[1] = startPoint.y;
 		fc.paramf[2] = aw.x;
 		fc.paramf[3] = aw.y;
 		fc.paramf[4] = ah.x;
 		fc.paramf[5] = ah.y;
-		fc.paramf[6] = (float32)bitmap->height;
-		cmdBuffer->PushConstants(
-			&fc,
-			0,
-			10 * sizeof(float32),
-			VK_SHADER_STAGE_FRAGMENT_BIT);
+		fc.paramf[6] = (float32)mipLevel.height;
+	}
+	void RenderTarget::SetCoverageBrush(
+		Bitmap *bitmap,
+		float32 x,
+		float32 y,
+		Color color)
+	{
+		SetBitmapBrush(bitmap, x, y);
+		fc.colorMode = colorModeCoverage;
+		fc.paramf[11] = color.r / 255.0f;
+		fc.paramf[12] = color.g / 255.0f;
+		fc.paramf[13] = color.b / 255.0f;
 	}
 	void RenderTarget::SetOpacity(float32 opacity)
 	{
 		if (fc.opacity == opacity) return;
 		fc.opacity = opacity;
-		cmdBuffer->PushConstants(
-			&fc,
-			31 * sizeof(float32),
-			sizeof(float32),
-			VK_SHADER_STAGE_FRAGMENT_BIT);
 	}
 	float32 RenderTarget::GetOpacity()
 	{
@@ -189,11 +705,6 @@ namespace gpu
 	{
 		if (fc.interpolationMode == value) return;
 		fc.interpolationMode = value;
-		cmdBuffer->PushConstants(
-			&fc,
-			30 * sizeof(float32),
-			sizeof(float32),
-			VK_SHADER_STAGE_FRAGMENT_BIT);
 	}
 	ColorInterpolationMode RenderTarget::GetColorInterpolationMode()
 	{
@@ -205,12 +716,35 @@ namespace gpu
 		float32 width,
 		float32 height)
 	{
+		FlushBatch();
 		cmdBuffer->PushScissor(x, y, width, height);
 	}
 	void RenderTarget::PopScissor()
 	{
+		FlushBatch();
 		cmdBuffer->PopScissor();
 	}
+	void RenderTarget::PushGeometryStrip(
+		Geometry &geometry,
+		Geometry::XtableStrip &strip)
+	{
+		fc.xtableOffset = (geometry.xtableOffset >> 2) + strip.offset;
+		// The shader reads packed rows when bit 31 is set
+		if (geometry.packedXtable) fc.xtableOffset |= INT32_MIN;
+		fc.xtableStart = geometry.xtableStart + strip.start / 8;
+		fc.xtableHeight = strip.height;
+		fc.xtableWidth = strip.width;
+	}
+	void RenderTarget::DrawGeometryStrip(Geometry::XtableStrip &strip)
+	{
+		float32 yMin = (float32)fc.xtableStart,
+			yMax = yMin + (float32)(strip.height / 8);
+		Vector2f v1(strip.xMax, yMin),
+			v2(strip.xMin, yMin),
+			v3(strip.xMin, yMax),
+			v4(strip.xMax, yMax);
+		DrawQuad(v1, v2, v3, v4);
+	}
 	void RenderTarget::RenderGeometry(
 		Geometry &geometry,
 		float32 translateX,
@@ -219,31 +753,64 @@ namespace gpu
 		float32 originX,
 		float32 originY)
 	{
-		if (!geometry.ready && !geometry.Prepare()) return;
+		if (!PrepareGeometry(geometry)) return;
 		fc.renderMode = renderModeGeometry;
 		MatrixRotate2d(rotation, originX, originY, &fc.transform);
 		fc.transform[2][0] += round(translateX);
 		fc.transform[2][1] += round(translateY);
-		fc.xtableOffset = geometry.xtableOffset >> 2;
-		fc.xtableStart = geometry.xtableStart;
-		fc.xtableHeight = geometry.xtableHeight;
-		fc.xtableWidth = geometry.xtableWidth;
 		fc.decayX = geometry.decay.x;
 		fc.decayY = geometry.decay.y;
-		cmdBuffer->PushConstants(
-			&fc,
-			17 * sizeof(float32),
-			13 * sizeof(float32),
-			VK_SHADER_STAGE_FRAGMENT_BIT);
-		Vector2f v1(geometry.xMax, geometry.yMin),
-			v2(geometry.xMin, geometry.yMin),
-			v3(geometry.xMin, geometry.yMax),
-			v4(geometry.xMax, geometry.yMax);
-		PushVertex(v1);
-		PushVertex(v2);
-		PushVertex(v3);
-		PushVertex(v4);
-		cmdBuffer->Draw(4, 1, currentVertex - 4, 0);
+		for (Geometry::XtableStrip &strip : geometry.xtableStrips)
+		{
+			if (strip.width == 0) continue;
+			PushGeometryStrip(geometry, strip);
+			DrawGeometryStrip(strip);
+		}
+	}
+	void RenderTarget::RenderGeometryInstanced(
+		Geometry &geometry,
+		const GeometryInstance *instances,
+		uint32 count)
+	{
+		if (count == 0 || !PrepareGeometry(geometry)) return;
+		FragmentConstants brush = fc;
+		Geometry::XtableStrip *singleStrip = nullptr;
+		uint32 stripCount = 0;
+		for (Geometry::XtableStrip &strip : geometry.xtableStrips)
+		{
+			if (strip.width == 0) continue;
+			singleStrip = &strip;
+			stripCount++;
+		}
+		fc.renderMode = renderModeGeometry;
+		fc.decayX = geometry.decay.x;
+		fc.decayY = geometry.decay.y;
+		// Instances only append to the current batch, so the whole set is
+		// usually recorded as a single draw
+		if (stripCount == 1) PushGeometryStrip(geometry, *singleStrip);
+		for (uint32 i = 0; i < count; i++)
+		{
+			const GeometryInstance &instance = instances[i];
+			SetSolidColorBrush(instance.color);
+			SetOpacity(instance.opacity);
+			if (instance.rotation == 0.0f) MatrixSetIdentity(&fc.transform);
+			else MatrixRotate2d(instance.rotation, instance.originX, instance.originY, &fc.transform);
+			fc.transform[2][0] += round(instance.translateX);
+			fc.transform[2][1] += round(instance.translateY);
+			if (stripCount == 1)
+			{
+				DrawGeometryStrip(*singleStrip);
+				continue;
+			}
+			for (Geometry::XtableStrip &strip : geometry.xtableStrips)
+			{
+				if (strip.width == 0) continue;
+				PushGeometryStrip(geometry, strip);
+				DrawGeometryStrip(strip);
+			}
+		}
+		memcpy(&fc, &brush, 17 * sizeof(float32));
+		SetOpacity(brush.opacity);
 	}
 	void RenderTarget::DrawLine(
 		Vector2f a,
@@ -262,20 +829,11 @@ namespace gpu
 		fc.paramf[9] = b.x;
 		fc.paramf[10] = b.y;
 		fc.paramf[11] = lineWidth;
-		cmdBuffer->PushConstants(
-			&fc,
-			10 * sizeof(float32),
-			16 * sizeof(float32),
-			VK_SHADER_STAGE_FRAGMENT_BIT);
 		Vector2f v1(Max(a.x, b.x) + lineWidth, Min(a.y, b.y) - lineWidth),
 			v2(Min(a.x, b.x) - lineWidth, Min(a.y, b.y) - lineWidth),
 			v3(Min(a.x, b.x) - lineWidth, Max(a.y, b.y) + lineWidth),
 			v4(Max(a.x, b.x) + lineWidth, Max(a.y, b.y) + lineWidth);
-		PushVertex(v1);
-		PushVertex(v2);
-		PushVertex(v3);
-		PushVertex(v4);
-		cmdBuffer->Draw(4, 1, currentVertex - 4, 0);
+		DrawQuad(v1, v2, v3, v4);
 	}
 	void RenderTarget::DrawRectangle(
 		float32 x,
@@ -303,20 +861,11 @@ namespace gpu
 		fc.paramf[9] = x + width;
 		fc.paramf[10] = y + height;
 		fc.paramf[11] = lineWidth;
-		cmdBuffer->PushConstants(
-			&fc,
-			10 * sizeof(float32),
-			16 * sizeof(float32),
-			VK_SHADER_STAGE_FRAGMENT_BIT);
 		Vector2f v1(x + width + lineWidth, y - lineWidth),
 			v2(x - lineWidth, y - lineWidth),
 			v3(x - lineWidth, y + height + lineWidth),
 			v4(x + width + lineWidth, y + height + lineWidth);
-		PushVertex(v1);
-		PushVertex(v2);
-		PushVertex(v3);
-		PushVertex(v4);
-		cmdBuffer->Draw(4, 1, currentVertex - 4, 0);
+		DrawQuad(v1, v2, v3, v4);
 	}
 	void RenderTarget::FillRectangle(
 		float32 x,
@@ -341,20 +890,11 @@ namespace gpu
 		fc.paramf[8] = y;
 		fc.paramf[9] = x + width;
 		fc.paramf[10] = y + height;
-		cmdBuffer->PushConstants(
-			&fc,
-			10 * sizeof(float32),
-			16 * sizeof(float32),
-			VK_SHADER_STAGE_FRAGMENT_BIT);
 		Vector2f v1(x + width, y),
 			v2(x, y),
 			v3(x, y + height),
 			v4(x + width, y + height);
-		PushVertex(v1);
-		PushVertex(v2);
-		PushVertex(v3);
-		PushVertex(v4);
-		cmdBuffer->Draw(4, 1, currentVertex - 4, 0);
+		DrawQuad(v1, v2, v3, v4);
 	}
 	void RenderTarget::DrawRoundedRectangle(
 		float32 x,
@@ -386,20 +926,11 @@ namespace gpu
 		fc.paramf[11] = rx;
 		fc.paramf[12] = ry;
 		fc.paramf[13] = lineWidth;
-		cmdBuffer->PushConstants(
-			&fc,
-			10 * sizeof(float32),
-			16 * sizeof(float32),
-			VK_SHADER_STAGE_FRAGMENT_BIT);
 		Vector2f v1(x + width + lineWidth, y - lineWidth),
 			v2(x - lineWidth, y - lineWidth),
 			v3(x - lineWidth, y + height + lineWidth),
 			v4(x + width + lineWidth, y + height + lineWidth);
-		PushVertex(v1);
-		PushVertex(v2);
-		PushVertex(v3);
-		PushVertex(v4);
-		cmdBuffer->Draw(4, 1, currentVertex - 4, 0);
+		DrawQuad(v1, v2, v3, v4);
 	}
 	void RenderTarget::FillRoundedRectangle(
 		float32 x,
@@ -428,20 +959,11 @@ namespace gpu
 		fc.paramf[10] = y + height;
 		fc.paramf[11] = rx;
 		fc.paramf[12] = ry;
-		cmdBuffer->PushConstants(
-			&fc,
-			10 * sizeof(float32),
-			16 * sizeof(float32),
-			VK_SHADER_STAGE_FRAGMENT_BIT);
 		Vector2f v1(x + width, y),
 			v2(x, y),
 			v3(x, y + height),
 			v4(x + width, y + height);
-		PushVertex(v1);
-		PushVertex(v2);
-		PushVertex(v3);
-		PushVertex(v4);
-		cmdBuffer->Draw(4, 1, currentVertex - 4, 0);
+		DrawQuad(v1, v2, v3, v4);
 	}
 	void RenderTarget::DrawEllipse(
 		Vector2f center,
@@ -461,20 +983,11 @@ namespace gpu
 		fc.paramf[9] = rx;
 		fc.paramf[10] = ry;
 		fc.paramf[11] = lineWidth;
-		cmdBuffer->PushConstants(
-			&fc,
-			10 * sizeof(float32),
-			16 * sizeof(float32),
-			VK_SHADER_STAGE_FRAGMENT_BIT);
 		Vector2f v1(center.x + rx + lineWidth, center.y - ry - lineWidth),
 			v2(center.x - rx - lineWidth, center.y - ry - lineWidth),
 			v3(center.x - rx - lineWidth, center.y + ry + lineWidth),
 			v4(center.x + rx + lineWidth, center.y + ry + lineWidth);
-		PushVertex(v1);
-		PushVertex(v2);
-		PushVertex(v3);
-		PushVertex(v4);
-		cmdBuffer->Draw(4, 1, currentVertex - 4, 0);
+		DrawQuad(v1, v2, v3, v4);
 	}
 	void RenderTarget::FillEllipse(
 		Vector2f center,
@@ -492,19 +1005,10 @@ namespace gpu
 		fc.paramf[8] = center.y;
 		fc.paramf[9] = rx;
 		fc.paramf[10] = ry;
-		cmdBuffer->PushConstants(
-			&fc,
-			10 * sizeof(float32),
-			16 * sizeof(float32),
-			VK_SHADER_STAGE_FRAGMENT_BIT);
 		Vector2f v1(center.x + rx, center.y - ry),
 			v2(center.x - rx, center.y - ry),
 			v3(center.x - rx, center.y + ry),
 			v4(center.x + rx, center.y + ry);
-		PushVertex(v1);
-		PushVertex(v2);
-		PushVertex(v3);
-		PushVertex(v4);
-		cmdBuffer->Draw(4, 1, currentVertex - 4, 0);
+		DrawQuad(v1, v2, v3, v4);
 	}
 }
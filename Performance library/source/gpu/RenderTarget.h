@@ -7,16 +7,63 @@
 #include "math\VectorMath.h"
 #include "graphics\Color.h"
 #include "algo\DistanceGeometry.h"
+#include "gpu\GpuDevice.h"
 #include "gpu\GradientCollection.h"
 #include "graphics\Geometry.h"
+#include <vector>
 
 namespace gpu
 {
+	struct GeometryInstance
+	{
+		float32 translateX;
+		float32 translateY;
+		float32 rotation;
+		float32 originX;
+		float32 originY;
+		float32 opacity;
+		Color color;
+	};
+
+	struct RenderTargetStatistics
+	{
+		uint32 primitivesRecorded;
+		uint32 drawsIssued;
+		uint32 verticesPushed;
+		uint32 instanceBytesWritten;
+		uint32 geometriesPrepared;
+		// Device wide, including uploads made for other render targets
+		uint64 storageBytesUploaded;
+	};
+
+	// Times are in nanoseconds. GPU scope times are relative to the start
+	// of the frame on the GPU and stay zero when timestamps are unsupported
+	struct TimingScope
+	{
+		const char8 *name;
+		uint32 depth;
+		uint64 start;
+		uint64 duration;
+	};
+
+	struct FrameTimings
+	{
+		uint64 frame;
+		int64 cpuStart;
+		int64 cpuRecordTime;
+		int64 geometryPrepareTime;
+		uint64 gpuTime;
+		std::vector<TimingScope> scopes;
+		RenderTargetStatistics counters;
+	};
+
 	class RenderTarget : public SharedObject
 	{
 		friend class GpuDevice;
 	protected:
-		static const uint32 vertexBufferSize = 10000 * 4 * sizeof(float32);
+		static const uint32 instanceChunkCapacity = 4096;
+		static const uint32 framesInFlight = 2;
+		static const uint32 maxTimestamps = 256;
 		static const uint32 renderModeGeometry = 0;
 		static const uint32 renderModeLine = 1;
 		static const uint32 renderModeRectangleOutline = 2;
@@ -29,7 +76,10 @@ namespace gpu
 		static const uint32 colorModeBitmap = 1;
 		static const uint32 colorModeLinearGradient = 2;
 		static const uint32 colorModeRadialGradient = 3;
+		static const uint32 colorModeCoverage = 4;
 		static const uint32 colorModeDistanceBased = 5;
+		static const uint32 renderModeCount = 8;
+		static const uint32 colorModeCount = 6;
 
 		struct FragmentConstants
 		{
@@ -48,36 +98,160 @@ namespace gpu
 			uint32 interpolationMode;
 			float32 opacity;
 		} fc;
+		// Every primitive is one instance of a four vertex fan; the vertex
+		// shader picks the corner by vertex index and forwards the constants
+		struct QuadInstance
+		{
+			Vector2f vertices[4];
+			FragmentConstants constants;
+		};
+		static const uint32 vertexBufferSize = instanceChunkCapacity * sizeof(QuadInstance);
 		GpuDevice *device;
 		SwapChain *swapChain;
-		Buffer *vertexBuffer;
+		struct VertexChunk
+		{
+			Buffer *buffer;
+			QuadInstance *instances;
+			uint64 frame;
+		};
+		struct ScopeQueries
+		{
+			const char8 *name;
+			uint32 depth;
+			uint32 beginQuery;
+			uint32 endQuery;
+		};
+		// Recording of a frame waits only for the frame that last used its slot
+		struct FrameResources
+		{
+			CommandBuffer *cmdBuffer;
+			CommandBuffer *uploadCmdBuffer;
+			VkFence fence;
+			VkSemaphore imageAcquired;
+			VkSemaphore renderFinished;
+			uint64 frame;
+			uint64 serial;
+			// Offscreen only: the frame's image is copied here in End and
+			// handed to readbackTarget once the fence has passed
+			Buffer *readbackBuffer;
+			void *readbackData;
+			void *readbackTarget;
+			// Queries 0 and 1 time the whole frame; results are read when
+			// the slot is reused, so resolving never waits on the GPU
+			VkQueryPool queryPool;
+			uint32 queryCount;
+			std::vector<ScopeQueries> scopeQueries;
+			FrameTimings timings;
+			bool timingsPending;
+		} frames[framesInFlight];
+		uint32 frameIndex;
 		CommandBuffer *cmdBuffer;
+		Shader *vertexShader;
+		Shader *fragmentShader;
+		// Reads the render and color modes from the instance constants
 		Pipeline *pipeline;
-		Vector2f *vertices;
-		uint32 currentVertex;
+		// Variants with both modes fixed by specialization constants, so the
+		// driver drops the branches of the other modes; created on first use
+		Pipeline *specializedPipelines[renderModeCount * colorModeCount];
+		bool specializedPipelinesEnabled;
+		Pipeline *boundPipeline;
+		// Persistently mapped vertex buffers; a chunk is reused only once
+		// the frame that last used it has completed
+		std::vector<VertexChunk> vertexChunks;
+		QuadInstance *instances;
+		uint32 currentInstance;
+		// Instances from here to currentInstance are drawn by the next FlushBatch
+		uint32 batchStart;
+		uint64 currentFrame;
+		uint64 completedFrame;
 		float32 projX;
 		float32 projY;
+		RenderTargetStatistics frameStatistics;
+		RenderTargetStatistics statistics;
+		std::vector<uint32> openScopes;
+		int64 frameStart;
+		int64 geometryPrepareTime;
+		uint64 storageBytesAtBegin;
+		FrameTimings timings;
+		bool traceCapture;
+		std::vector<FrameTimings> traceFrames;
+		GlyphAtlas *glyphAtlas;
 
 		RenderTarget(
 			GpuDevice *device,
 			SwapChain *swapChain,
 			Buffer *vertexBuffer,
-			CommandBuffer *cmdBuffer,
+			CommandBuffer **cmdBuffers,
+			CommandBuffer **uploadCmdBuffers,
+			VkFence *fences,
+			VkSemaphore *imageAcquiredSemaphores,
+			VkSemaphore *renderFinishedSemaphores,
+			VkQueryPool *queryPools,
+			Shader *vertexShader,
+			Shader *fragmentShader,
 			Pipeline *pipeline);
 		~RenderTarget();
-		void PushVertex(Vector2f vertex);
+		void WaitIdle();
+		HResult CreateReadbackBuffers();
+		void DestroyReadbackBuffers();
+		void CompleteReadback(FrameResources &slot);
+		void ResolveTimings(FrameResources &slot);
+		bool PrepareGeometry(Geometry &geometry);
+		HResult AcquireVertexChunk();
+		Pipeline *GetPipeline(uint32 renderMode, uint32 colorMode);
+		void FlushBatch();
+		Vector2f TransformVertex(Vector2f vertex);
+		void DrawQuad(
+			Vector2f v1,
+			Vector2f v2,
+			Vector2f v3,
+			Vector2f v4);
+		void PushGeometryStrip(
+			Geometry &geometry,
+			Geometry::XtableStrip &strip);
+		void DrawGeometryStrip(Geometry::XtableStrip &strip);
 	public:
 		HResult CreateBitmap(
 			uint32 width,
 			uint32 height,
-			Bitmap **ppBitmap);
+			Bitmap **ppBitmap,
+			bool mipmaps = false);
 		HResult CreateGradientCollection(
 			GradientStop *stops,
 			uint32 count,
 			GradientCollection **ppGradientCollection);
 		void Begin();
 		void End();
-		void Resize(uint32 width, uint32 height);
+		HResult Resize(uint32 width, uint32 height);
+		// Offscreen targets only. Copies the last ended frame into data as
+		// tightly packed RGBA rows, waiting for the frame to finish
+		HResult ReadPixels(void *data);
+		// Offscreen targets only. Queues the same copy without waiting; data is
+		// filled by the Begin that reuses the frame's slot or by FinishReadbacks
+		HResult ReadPixelsAsync(void *data);
+		void FinishReadbacks();
+		// Counters of the last completed frame
+		void GetStatistics(RenderTargetStatistics *statistics);
+		// Scopes may nest and are closed at End if left open; the name must
+		// outlive the frame, typically a string literal
+		void BeginTimingScope(const char8 *name);
+		void EndTimingScope();
+		// Timings of the most recently resolved frame, framesInFlight behind
+		void GetFrameTimings(FrameTimings *timings);
+		void BeginTraceCapture();
+		// Writes the frames resolved since BeginTraceCapture as Chrome trace JSON
+		HResult EndTraceCapture(const char8 *fileName);
+		// Created on first use; null if its bitmap could not be allocated
+		GlyphAtlas *GetGlyphAtlas();
+		// Frames are numbered from 1 by Begin. Resources a frame reads may be
+		// overwritten once GetCompletedFrame reaches its number
+		uint64 GetCurrentFrame();
+		uint64 GetCompletedFrame();
+		// Polls the fences of the frames in flight without waiting
+		void UpdateCompletedFrames();
+		// On by default. Specialized pipelines run less shader code per pixel
+		// but split batches wherever the render or color mode changes
+		void SetSpecializedPipelines(bool enabled);
 		void SetSolidColorBrush(Color color);
 		void SetLinearGradientBrush(
 			GradientCollection *gradientCollection,
@@ -93,6 +267,12 @@ namespace gpu
 			Bitmap *bitmap,
 			float32 x,
 			float32 y);
+		// Bitmap brush that draws color, using the texel alpha as coverage
+		void SetCoverageBrush(
+			Bitmap *bitmap,
+			float32 x,
+			float32 y,
+			Color color);
 		void SetOpacity(float32 opacity);
 		float32 GetOpacity();
 		void SetColorInterpolationMode(ColorInterpolationMode value);
@@ -110,6 +290,12 @@ namespace gpu
 			float32 rotation = 0.0f,
 			float32 originX = 0.0f,
 			float32 originY = 0.0f);
+		// Renders the geometry once per instance with a solid color brush;
+		// brush and opacity are restored afterwards
+		void RenderGeometryInstanced(
+			Geometry &geometry,
+			const GeometryInstance *instances,
+			uint32 count);
 		void DrawLine(
 			Vector2f a,
 			Vector2f b,
@@ -2,6 +2,6 @@
 
 namespace gpu
 {
-	const uint8 vertexShaderData[] = { 3, 2, 35, 7, 0, 0, 1, 0, 7, 0, 8, 0, 28, 0, 0, 0, 0, 0, 0, 0, 17, 0, 2, 0, 1, 0, 0, 0, 11, 0, 6, 0, 1, 0, 0, 0, 71, 76, 83, 76, 46, 115, 116, 100, 46, 52, 53, 48, 0, 0, 0, 0, 14, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 15, 0, 8, 0, 0, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 13, 0, 0, 0, 18, 0, 0, 0, 27, 0, 0, 0, 3, 0, 3, 0, 2, 0, 0, 0, 194, 1, 0, 0, 5, 0, 4, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 5, 0, 6, 0, 11, 0, 0, 0, 103, 108, 95, 80, 101, 114, 86, 101, 114, 116, 101, 120, 0, 0, 0, 0, 6, 0, 6, 0, 11, 0, 0, 0, 0, 0, 0, 0, 103, 108, 95, 80, 111, 115, 105, 116, 105, 111, 110, 0, 6, 0, 7, 0, 11, 0, 0, 0, 1, 0, 0, 0, 103, 108, 95, 80, 111, 105, 110, 116, 83, 105, 122, 101, 0, 0, 0, 0, 6, 0, 7, 0, 11, 0, 0, 0, 2, 0, 0, 0, 103, 108, 95, 67, 108, 105, 112, 68, 105, 115, 116, 97, 110, 99, 101, 0, 6, 0, 7, 0, 11, 0, 0, 0, 3, 0, 0, 0, 103, 108, 95, 67, 117, 108, 108, 68, 105, 115, 116, 97, 110, 99, 101, 0, 5, 0, 3, 0, 13, 0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 0, 18, 0, 0, 0, 112, 111, 115, 105, 116, 105, 111, 110, 0, 0, 0, 0, 5, 0, 5, 0, 27, 0, 0, 0, 111, 117, 116, 67, 111, 108, 111, 114, 0, 0, 0, 0, 72, 0, 5, 0, 11, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 72, 0, 5, 0, 11, 0, 0, 0, 1, 0, 0, 0, 11, 0, 0, 0, 1, 0, 0, 0, 72, 0, 5, 0, 11, 0, 0, 0, 2, 0, 0, 0, 11, 0, 0, 0, 3, 0, 0, 0, 72, 0, 5, 0, 11, 0, 0, 0, 3, 0, 0, 0, 11, 0, 0, 0, 4, 0, 0, 0, 71, 0, 3, 0, 11, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 18, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 3, 0, 27, 0, 0, 0, 14, 0, 0, 0, 71, 0, 4, 0, 27, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 19, 0, 2, 0, 2, 0, 0, 0, 33, 0, 3, 0, 3, 0, 0, 0, 2, 0, 0, 0, 22, 0, 3, 0, 6, 0, 0, 0, 32, 0, 0, 0, 23, 0, 4, 0, 7, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 21, 0, 4, 0, 8, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 43, 0, 4, 0, 8, 0, 0, 0, 9, 0, 0, 0, 1, 0, 0, 0, 28, 0, 4, 0, 10, 0, 0, 0, 6, 0, 0, 0, 9, 0, 0, 0, 30, 0, 6, 0, 11, 0, 0, 0, 7, 0, 0, 0, 6, 0, 0, 0, 10, 0, 0, 0, 10, 0, 0, 0, 32, 0, 4, 0, 12, 0, 0, 0, 3, 0, 0, 0, 11, 0, 0, 0, 59, 0, 4, 0, 12, 0, 0, 0, 13, 0, 0, 0, 3, 0, 0, 0, 21, 0, 4, 0, 14, 0, 0, 0, 32, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 14, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 23, 0, 4, 0, 16, 0, 0, 0, 6, 0, 0, 0, 2, 0, 0, 0, 32, 0, 4, 0, 17, 0, 0, 0, 1, 0, 0, 0, 16, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 18, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 21, 0, 0, 0, 0, 0, 128, 63, 32, 0, 4, 0, 25, 0, 0, 0, 3, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 25, 0, 0, 0, 27, 0, 0, 0, 3, 0, 0, 0, 54, 0, 5, 0, 2, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 248, 0, 2, 0, 5, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 19, 0, 0, 0, 18, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 22, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 23, 0, 0, 0, 19, 0, 0, 0, 1, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 24, 0, 0, 0, 22, 0, 0, 0, 23, 0, 0, 0, 20, 0, 0, 0, 21, 0, 0, 0, 65, 0, 5, 0, 25, 0, 0, 0, 26, 0, 0, 0, 13, 0, 0, 0, 15, 0, 0, 0, 62, 0, 3, 0, 26, 0, 0, 0, 24, 0, 0, 0, 253, 0, 1, 0, 56, 0, 1, 0, };
-	const uint8 fragmentShaderData[] = { 3, 2, 35, 7, 0, 0, 1, 0, 7, 0, 8, 0, 155, 6, 0, 0, 0, 0, 0, 0, 17, 0, 2, 0, 1, 0, 0, 0, 11, 0, 6, 0, 1, 0, 0, 0, 71, 76, 83, 76, 46, 115, 116, 100, 46, 52, 53, 48, 0, 0, 0, 0, 14, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 15, 0, 8, 0, 4, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 42, 1, 0, 0, 86, 5, 0, 0, 154, 6, 0, 0, 16, 0, 3, 0, 4, 0, 0, 0, 7, 0, 0, 0, 3, 0, 3, 0, 2, 0, 0, 0, 194, 1, 0, 0, 5, 0, 4, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 5, 0, 8, 0, 11, 0, 0, 0, 71, 101, 116, 71, 114, 97, 100, 105, 101, 110, 116, 67, 111, 108, 111, 114, 40, 102, 49, 59, 0, 0, 0, 0, 5, 0, 5, 0, 10, 0, 0, 0, 103, 114, 97, 100, 105, 101, 110, 116, 0, 0, 0, 0, 5, 0, 5, 0, 14, 0, 0, 0, 71, 101, 116, 67, 111, 108, 111, 114, 40, 0, 0, 0, 5, 0, 8, 0, 23, 0, 0, 0, 67, 67, 87, 84, 101, 115, 116, 40, 118, 102, 50, 59, 118, 102, 50, 59, 118, 102, 50, 59, 0, 0, 0, 0, 5, 0, 3, 0, 20, 0, 0, 0, 97, 0, 0, 0, 5, 0, 3, 0, 21, 0, 0, 0, 98, 0, 0, 0, 5, 0, 3, 0, 22, 0, 0, 0, 99, 0, 0, 0, 5, 0, 9, 0, 30, 0, 0, 0, 72, 105, 116, 84, 101, 115, 116, 76, 105, 110, 101, 40, 118, 102, 50, 59, 118, 102, 50, 59, 102, 49, 59, 118, 102, 50, 59, 0, 5, 0, 3, 0, 26, 0, 0, 0, 97, 0, 0, 0, 5, 0, 3, 0, 27, 0, 0, 0, 98, 0, 0, 0, 5, 0, 5, 0, 28, 0, 0, 0, 108, 105, 110, 101, 87, 105, 100, 116, 104, 0, 0, 0, 5, 0, 3, 0, 29, 0, 0, 0, 112, 0, 0, 0, 5, 0, 11, 0, 38, 0, 0, 0, 72, 105, 116, 84, 101, 115, 116, 82, 101, 99, 116, 97, 110, 103, 108, 101, 40, 102, 49, 59, 102, 49, 59, 102, 49, 59, 102, 49, 59, 118, 102, 50, 59, 0, 0, 0, 5, 0, 4, 0, 33, 0, 0, 0, 108, 101, 102, 116, 0, 0, 0, 0, 5, 0, 3, 0, 34, 0, 0, 0, 116, 111, 112, 0, 5, 0, 4, 0, 35, 0, 0, 0, 114, 105, 103, 104, 116, 0, 0, 0, 5, 0, 4, 0, 36, 0, 0, 0, 98, 111, 116, 116, 111, 109, 0, 0, 5, 0, 3, 0, 37, 0, 0, 0, 112, 0, 0, 0, 5, 0, 10, 0, 45, 0, 0, 0, 72, 105, 116, 84, 101, 115, 116, 69, 108, 108, 105, 112, 115, 101, 40, 118, 102, 50, 59, 102, 49, 59, 102, 49, 59, 118, 102, 50, 59, 0, 0, 0, 5, 0, 4, 0, 41, 0, 0, 0, 99, 101, 110, 116, 101, 114, 0, 0, 5, 0, 3, 0, 42, 0, 0, 0, 114, 120, 0, 0, 5, 0, 3, 0, 43, 0, 0, 0, 114, 121, 0, 0, 5, 0, 3, 0, 44, 0, 0, 0, 112, 0, 0, 0, 5, 0, 14, 0, 55, 0, 0, 0, 72, 105, 116, 84, 101, 115, 116, 82, 111, 117, 110, 100, 101, 100, 82, 101, 99, 116, 97, 110, 103, 108, 101, 40, 102, 49, 59, 102, 49, 59, 102, 49, 59, 102, 49, 59, 102, 49, 59, 102, 49, 59, 118, 102, 50, 59, 0, 0, 5, 0, 4, 0, 48, 0, 0, 0, 108, 101, 102, 116, 0, 0, 0, 0, 5, 0, 3, 0, 49, 0, 0, 0, 116, 111, 112, 0, 5, 0, 4, 0, 50, 0, 0, 0, 114, 105, 103, 104, 116, 0, 0, 0, 5, 0, 4, 0, 51, 0, 0, 0, 98, 111, 116, 116, 111, 109, 0, 0, 5, 0, 3, 0, 52, 0, 0, 0, 114, 120, 0, 0, 5, 0, 3, 0, 53, 0, 0, 0, 114, 121, 0, 0, 5, 0, 3, 0, 54, 0, 0, 0, 112, 0, 0, 0, 5, 0, 4, 0, 59, 0, 0, 0, 111, 102, 102, 115, 101, 116, 0, 0, 5, 0, 6, 0, 65, 0, 0, 0, 67, 111, 110, 115, 116, 97, 110, 116, 66, 117, 102, 102, 101, 114, 0, 0, 6, 0, 6, 0, 65, 0, 0, 0, 0, 0, 0, 0, 99, 111, 108, 111, 114, 77, 111, 100, 101, 0, 0, 0, 6, 0, 6, 0, 65, 0, 0, 0, 1, 0, 0, 0, 99, 111, 108, 111, 114, 79, 102, 102, 115, 101, 116, 0, 6, 0, 6, 0, 65, 0, 0, 0, 2, 0, 0, 0, 99, 111, 108, 111, 114, 67, 111, 117, 110, 116, 0, 0, 6, 0, 5, 0, 65, 0, 0, 0, 3, 0, 0, 0, 112, 97, 114, 97, 109, 102, 0, 0, 6, 0, 6, 0, 65, 0, 0, 0, 4, 0, 0, 0, 114, 101, 110, 100, 101, 114, 77, 111, 100, 101, 0, 0, 6, 0, 6, 0, 65, 0, 0, 0, 5, 0, 0, 0, 116, 114, 97, 110, 115, 102, 111, 114, 109, 0, 0, 0, 6, 0, 5, 0, 65, 0, 0, 0, 6, 0, 0, 0, 100, 101, 99, 97, 121, 88, 0, 0, 6, 0, 5, 0, 65, 0, 0, 0, 7, 0, 0, 0, 100, 101, 99, 97, 121, 89, 0, 0, 6, 0, 7, 0, 65, 0, 0, 0, 8, 0, 0, 0, 120, 116, 97, 98, 108, 101, 79, 102, 102, 115, 101, 116, 0, 0, 0, 0, 6, 0, 6, 0, 65, 0, 0, 0, 9, 0, 0, 0, 120, 116, 97, 98, 108, 101, 83, 116, 97, 114, 116, 0, 6, 0, 7, 0, 65, 0, 0, 0, 10, 0, 0, 0, 120, 116, 97, 98, 108, 101, 72, 101, 105, 103, 104, 116, 0, 0, 0, 0, 6, 0, 6, 0, 65, 0, 0, 0, 11, 0, 0, 0, 120, 116, 97, 98, 108, 101, 87, 105, 100, 116, 104, 0, 6, 0, 8, 0, 65, 0, 0, 0, 12, 0, 0, 0, 105, 110, 116, 101, 114, 112, 111, 108, 97, 116, 105, 111, 110, 77, 111, 100, 101, 0, 0, 0, 6, 0, 5, 0, 65, 0, 0, 0, 13, 0, 0, 0, 111, 112, 97, 99, 105, 116, 121, 0, 5, 0, 3, 0, 67, 0, 0, 0, 99, 98, 0, 0, 5, 0, 4, 0, 72, 0, 0, 0, 115, 105, 122, 101, 0, 0, 0, 0, 5, 0, 6, 0, 89, 0, 0, 0, 83, 116, 111, 114, 97, 103, 101, 66, 117, 102, 102, 101, 114, 0, 0, 0, 6, 0, 5, 0, 89, 0, 0, 0, 0, 0, 0, 0, 100, 97, 116, 97, 0, 0, 0, 0, 5, 0, 3, 0, 91, 0, 0, 0, 115, 98, 0, 0, 5, 0, 4, 0, 119, 0, 0, 0, 99, 111, 108, 111, 114, 0, 0, 0, 5, 0, 4, 0, 162, 0, 0, 0, 99, 111, 108, 111, 114, 49, 0, 0, 5, 0, 4, 0, 195, 0, 0, 0, 99, 111, 108, 111, 114, 50, 0, 0, 5, 0, 3, 0, 40, 1, 0, 0, 112, 115, 0, 0, 5, 0, 6, 0, 42, 1, 0, 0, 103, 108, 95, 70, 114, 97, 103, 67, 111, 111, 114, 100, 0, 0, 0, 0, 5, 0, 3, 0, 55, 1, 0, 0, 97, 119, 0, 0, 5, 0, 3, 0, 61, 1, 0, 0, 97, 104, 0, 0, 5, 0, 4, 0, 102, 1, 0, 0, 112, 115, 76, 101, 110, 0, 0, 0, 5, 0, 4, 0, 105, 1, 0, 0, 97, 119, 76, 101, 110, 0, 0, 0, 5, 0, 4, 0, 108, 1, 0, 0, 97, 104, 76, 101, 110, 0, 0, 0, 5, 0, 4, 0, 111, 1, 0, 0, 97, 108, 112, 104, 97, 0, 0, 0, 5, 0, 3, 0, 120, 1, 0, 0, 119, 114, 0, 0, 5, 0, 3, 0, 133, 1, 0, 0, 104, 114, 0, 0, 5, 0, 3, 0, 139, 1, 0, 0, 119, 0, 0, 0, 5, 0, 3, 0, 148, 1, 0, 0, 104, 0, 0, 0, 5, 0, 4, 0, 180, 1, 0, 0, 99, 111, 108, 111, 114, 0, 0, 0, 5, 0, 3, 0, 224, 1, 0, 0, 97, 98, 0, 0, 5, 0, 4, 0, 236, 1, 0, 0, 114, 76, 101, 110, 0, 0, 0, 0, 5, 0, 4, 0, 2, 2, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 3, 0, 6, 2, 0, 0, 112, 120, 0, 0, 5, 0, 3, 0, 9, 2, 0, 0, 112, 121, 0, 0, 5, 0, 4, 0, 30, 2, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 3, 0, 42, 2, 0, 0, 112, 0, 0, 0, 5, 0, 3, 0, 71, 2, 0, 0, 99, 49, 0, 0, 5, 0, 4, 0, 87, 2, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 3, 0, 90, 2, 0, 0, 121, 49, 0, 0, 5, 0, 3, 0, 95, 2, 0, 0, 121, 50, 0, 0, 5, 0, 3, 0, 100, 2, 0, 0, 120, 49, 0, 0, 5, 0, 3, 0, 102, 2, 0, 0, 120, 50, 0, 0, 5, 0, 3, 0, 105, 2, 0, 0, 107, 0, 0, 0, 5, 0, 3, 0, 115, 2, 0, 0, 109, 0, 0, 0, 5, 0, 3, 0, 123, 2, 0, 0, 97, 0, 0, 0, 5, 0, 3, 0, 139, 2, 0, 0, 98, 0, 0, 0, 5, 0, 3, 0, 174, 2, 0, 0, 99, 0, 0, 0, 5, 0, 3, 0, 214, 2, 0, 0, 99, 49, 0, 0, 5, 0, 4, 0, 231, 2, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 3, 0, 2, 3, 0, 0, 112, 49, 0, 0, 5, 0, 3, 0, 12, 3, 0, 0, 112, 50, 0, 0, 5, 0, 3, 0, 22, 3, 0, 0, 112, 51, 0, 0, 5, 0, 4, 0, 60, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 87, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 117, 3, 0, 0, 116, 97, 110, 103, 101, 110, 116, 0, 5, 0, 4, 0, 136, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 137, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 138, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 149, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 150, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 151, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 163, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 164, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 165, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 177, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 178, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 179, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 247, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 248, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 249, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 8, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 9, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 10, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 26, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 27, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 28, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 44, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 45, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 46, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 62, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 63, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 64, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 80, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 81, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 82, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 98, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 99, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 100, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 116, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 117, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 118, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 132, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 133, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 135, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 137, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 151, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 152, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 154, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 156, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 170, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 171, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 173, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 175, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 189, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 190, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 192, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 194, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 5, 0, 200, 4, 0, 0, 112, 105, 120, 101, 108, 83, 97, 109, 112, 108, 101, 0, 5, 0, 3, 0, 249, 4, 0, 0, 105, 100, 120, 0, 5, 0, 3, 0, 28, 5, 0, 0, 119, 0, 0, 0, 5, 0, 5, 0, 32, 5, 0, 0, 112, 111, 108, 97, 114, 105, 116, 121, 0, 0, 0, 0, 5, 0, 3, 0, 44, 5, 0, 0, 120, 115, 0, 0, 5, 0, 5, 0, 86, 5, 0, 0, 111, 117, 116, 67, 111, 108, 111, 114, 0, 0, 0, 0, 5, 0, 4, 0, 95, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 98, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 101, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 104, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 107, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 121, 5, 0, 0, 100, 101, 108, 116, 97, 0, 0, 0, 5, 0, 4, 0, 142, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 143, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 144, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 145, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 146, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 167, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 168, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 169, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 170, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 171, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 188, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 191, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 194, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 197, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 200, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 203, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 206, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 221, 5, 0, 0, 100, 101, 108, 116, 97, 0, 0, 0, 5, 0, 4, 0, 249, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 250, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 251, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 252, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 253, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 254, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 255, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 30, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 31, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 32, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 33, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 34, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 35, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 36, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 58, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 59, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 62, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 65, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 79, 6, 0, 0, 100, 101, 108, 116, 97, 0, 0, 0, 5, 0, 4, 0, 96, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 97, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 98, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 99, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 117, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 118, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 119, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 120, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 141, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 142, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 143, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 146, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 154, 6, 0, 0, 99, 111, 108, 111, 114, 0, 0, 0, 71, 0, 4, 0, 61, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 71, 0, 4, 0, 63, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 1, 0, 0, 0, 35, 0, 0, 0, 4, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 2, 0, 0, 0, 35, 0, 0, 0, 8, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 3, 0, 0, 0, 35, 0, 0, 0, 12, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 4, 0, 0, 0, 35, 0, 0, 0, 68, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 5, 0, 0, 0, 35, 0, 0, 0, 72, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 6, 0, 0, 0, 35, 0, 0, 0, 96, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 7, 0, 0, 0, 35, 0, 0, 0, 100, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 8, 0, 0, 0, 35, 0, 0, 0, 104, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 9, 0, 0, 0, 35, 0, 0, 0, 108, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 10, 0, 0, 0, 35, 0, 0, 0, 112, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 11, 0, 0, 0, 35, 0, 0, 0, 116, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 12, 0, 0, 0, 35, 0, 0, 0, 120, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 13, 0, 0, 0, 35, 0, 0, 0, 124, 0, 0, 0, 71, 0, 3, 0, 65, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 88, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 72, 0, 5, 0, 89, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 71, 0, 3, 0, 89, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 91, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 91, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 42, 1, 0, 0, 11, 0, 0, 0, 15, 0, 0, 0, 71, 0, 4, 0, 86, 5, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 3, 0, 154, 6, 0, 0, 14, 0, 0, 0, 71, 0, 4, 0, 154, 6, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 19, 0, 2, 0, 2, 0, 0, 0, 33, 0, 3, 0, 3, 0, 0, 0, 2, 0, 0, 0, 22, 0, 3, 0, 6, 0, 0, 0, 32, 0, 0, 0, 32, 0, 4, 0, 7, 0, 0, 0, 7, 0, 0, 0, 6, 0, 0, 0, 23, 0, 4, 0, 8, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 33, 0, 4, 0, 9, 0, 0, 0, 8, 0, 0, 0, 7, 0, 0, 0, 33, 0, 3, 0, 13, 0, 0, 0, 8, 0, 0, 0, 23, 0, 4, 0, 16, 0, 0, 0, 6, 0, 0, 0, 2, 0, 0, 0, 32, 0, 4, 0, 17, 0, 0, 0, 7, 0, 0, 0, 16, 0, 0, 0, 20, 0, 2, 0, 18, 0, 0, 0, 33, 0, 6, 0, 19, 0, 0, 0, 18, 0, 0, 0, 17, 0, 0, 0, 17, 0, 0, 0, 17, 0, 0, 0, 33, 0, 7, 0, 25, 0, 0, 0, 18, 0, 0, 0, 17, 0, 0, 0, 17, 0, 0, 0, 7, 0, 0, 0, 17, 0, 0, 0, 33, 0, 8, 0, 32, 0, 0, 0, 18, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 17, 0, 0, 0, 33, 0, 7, 0, 40, 0, 0, 0, 18, 0, 0, 0, 17, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 17, 0, 0, 0, 33, 0, 10, 0, 47, 0, 0, 0, 18, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 17, 0, 0, 0, 21, 0, 4, 0, 57, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 32, 0, 4, 0, 58, 0, 0, 0, 7, 0, 0, 0, 57, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 60, 0, 0, 0, 14, 0, 0, 0, 28, 0, 4, 0, 61, 0, 0, 0, 6, 0, 0, 0, 60, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 62, 0, 0, 0, 6, 0, 0, 0, 28, 0, 4, 0, 63, 0, 0, 0, 6, 0, 0, 0, 62, 0, 0, 0, 21, 0, 4, 0, 64, 0, 0, 0, 32, 0, 0, 0, 1, 0, 0, 0, 30, 0, 16, 0, 65, 0, 0, 0, 57, 0, 0, 0, 57, 0, 0, 0, 57, 0, 0, 0, 61, 0, 0, 0, 57, 0, 0, 0, 63, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0, 64, 0, 0, 0, 64, 0, 0, 0, 64, 0, 0, 0, 64, 0, 0, 0, 57, 0, 0, 0, 6, 0, 0, 0, 32, 0, 4, 0, 66, 0, 0, 0, 9, 0, 0, 0, 65, 0, 0, 0, 59, 0, 4, 0, 66, 0, 0, 0, 67, 0, 0, 0, 9, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 68, 0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 69, 0, 0, 0, 9, 0, 0, 0, 57, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 75, 0, 0, 0, 2, 0, 0, 0, 29, 0, 3, 0, 88, 0, 0, 0, 6, 0, 0, 0, 30, 0, 3, 0, 89, 0, 0, 0, 88, 0, 0, 0, 32, 0, 4, 0, 90, 0, 0, 0, 2, 0, 0, 0, 89, 0, 0, 0, 59, 0, 4, 0, 90, 0, 0, 0, 91, 0, 0, 0, 2, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 92, 0, 0, 0, 0, 0, 0, 0, 32, 0, 4, 0, 94, 0, 0, 0, 2, 0, 0, 0, 6, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 101, 0, 0, 0, 2, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 106, 0, 0, 0, 12, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 109, 0, 0, 0, 0, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 121, 0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 161, 0, 0, 0, 7, 0, 0, 0, 8, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 164, 0, 0, 0, 255, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 168, 0, 0, 0, 8, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 173, 0, 0, 0, 16, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 178, 0, 0, 0, 24, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 182, 0, 0, 0, 13, 0, 0, 0, 32, 0, 4, 0, 183, 0, 0, 0, 9, 0, 0, 0, 6, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 188, 0, 0, 0, 129, 128, 128, 59, 43, 0, 4, 0, 64, 0, 0, 0, 23, 1, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 41, 1, 0, 0, 1, 0, 0, 0, 8, 0, 0, 0, 59, 0, 4, 0, 41, 1, 0, 0, 42, 1, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 43, 1, 0, 0, 1, 0, 0, 0, 6, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 62, 1, 0, 0, 4, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 65, 1, 0, 0, 5, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 80, 1, 0, 0, 0, 0, 0, 0, 44, 0, 7, 0, 8, 0, 0, 0, 100, 1, 0, 0, 80, 1, 0, 0, 80, 1, 0, 0, 80, 1, 0, 0, 80, 1, 0, 0, 32, 0, 4, 0, 138, 1, 0, 0, 7, 0, 0, 0, 64, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 149, 1, 0, 0, 6, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 237, 1, 0, 0, 0, 0, 128, 63, 43, 0, 4, 0, 6, 0, 0, 0, 17, 2, 0, 0, 10, 215, 35, 60, 43, 0, 4, 0, 6, 0, 0, 0, 38, 2, 0, 0, 0, 0, 192, 63, 43, 0, 4, 0, 6, 0, 0, 0, 86, 2, 0, 0, 255, 255, 127, 127, 43, 0, 4, 0, 6, 0, 0, 0, 140, 2, 0, 0, 0, 0, 0, 192, 43, 0, 4, 0, 6, 0, 0, 0, 150, 2, 0, 0, 0, 0, 0, 64, 43, 0, 4, 0, 6, 0, 0, 0, 218, 2, 0, 0, 0, 0, 128, 64, 43, 0, 4, 0, 64, 0, 0, 0, 239, 4, 0, 0, 7, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 250, 4, 0, 0, 0, 0, 0, 65, 43, 0, 4, 0, 64, 0, 0, 0, 253, 4, 0, 0, 9, 0, 0, 0, 32, 0, 4, 0, 254, 4, 0, 0, 9, 0, 0, 0, 64, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 11, 5, 0, 0, 10, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 19, 5, 0, 0, 11, 0, 0, 0, 41, 0, 3, 0, 18, 0, 0, 0, 38, 5, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 58, 5, 0, 0, 0, 80, 195, 71, 32, 0, 4, 0, 85, 5, 0, 0, 3, 0, 0, 0, 8, 0, 0, 0, 59, 0, 4, 0, 85, 5, 0, 0, 86, 5, 0, 0, 3, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 91, 5, 0, 0, 3, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 122, 5, 0, 0, 0, 0, 0, 63, 43, 0, 4, 0, 57, 0, 0, 0, 184, 5, 0, 0, 5, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 217, 5, 0, 0, 4, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 49, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 41, 1, 0, 0, 154, 6, 0, 0, 1, 0, 0, 0, 54, 0, 5, 0, 2, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 248, 0, 2, 0, 5, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 200, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 138, 1, 0, 0, 249, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 138, 1, 0, 0, 28, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 138, 1, 0, 0, 32, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 44, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 95, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 98, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 101, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 104, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 107, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 121, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 142, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 143, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 144, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 145, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 146, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 167, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 168, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 169, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 170, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 171, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 188, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 191, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 194, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 197, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 200, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 203, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 206, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 221, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 249, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 250, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 251, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 252, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 253, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 254, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 255, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 30, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 31, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 32, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 33, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 34, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 35, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 36, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 58, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 59, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 62, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 65, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 79, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 96, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 97, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 98, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 99, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 117, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 118, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 119, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 120, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 141, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 142, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 143, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 146, 6, 0, 0, 7, 0, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 201, 4, 0, 0, 67, 0, 0, 0, 65, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 202, 4, 0, 0, 201, 4, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 203, 4, 0, 0, 42, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 204, 4, 0, 0, 203, 4, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 205, 4, 0, 0, 67, 0, 0, 0, 65, 1, 0, 0, 62, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 206, 4, 0, 0, 205, 4, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 207, 4, 0, 0, 204, 4, 0, 0, 206, 4, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 208, 4, 0, 0, 202, 4, 0, 0, 207, 4, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 209, 4, 0, 0, 67, 0, 0, 0, 65, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 210, 4, 0, 0, 209, 4, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 211, 4, 0, 0, 42, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 212, 4, 0, 0, 211, 4, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 213, 4, 0, 0, 67, 0, 0, 0, 65, 1, 0, 0, 65, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 214, 4, 0, 0, 213, 4, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 215, 4, 0, 0, 212, 4, 0, 0, 214, 4, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 216, 4, 0, 0, 210, 4, 0, 0, 215, 4, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 217, 4, 0, 0, 208, 4, 0, 0, 216, 4, 0, 0, 65, 0, 5, 0, 183, 0, 0, 0, 218, 4, 0, 0, 67, 0, 0, 0, 149, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 219, 4, 0, 0, 218, 4, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 220, 4, 0, 0, 217, 4, 0, 0, 219, 4, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 221, 4, 0, 0, 67, 0, 0, 0, 65, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 222, 4, 0, 0, 221, 4, 0, 0, 127, 0, 4, 0, 6, 0, 0, 0, 223, 4, 0, 0, 222, 4, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 224, 4, 0, 0, 42, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 225, 4, 0, 0, 224, 4, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 226, 4, 0, 0, 67, 0, 0, 0, 65, 1, 0, 0, 62, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 227, 4, 0, 0, 226, 4, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 228, 4, 0, 0, 225, 4, 0, 0, 227, 4, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 229, 4, 0, 0, 223, 4, 0, 0, 228, 4, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 230, 4, 0, 0, 67, 0, 0, 0, 65, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 231, 4, 0, 0, 230, 4, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 232, 4, 0, 0, 42, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 233, 4, 0, 0, 232, 4, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 234, 4, 0, 0, 67, 0, 0, 0, 65, 1, 0, 0, 65, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 235, 4, 0, 0, 234, 4, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 236, 4, 0, 0, 233, 4, 0, 0, 235, 4, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 237, 4, 0, 0, 231, 4, 0, 0, 236, 4, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 238, 4, 0, 0, 229, 4, 0, 0, 237, 4, 0, 0, 65, 0, 5, 0, 183, 0, 0, 0, 240, 4, 0, 0, 67, 0, 0, 0, 239, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 241, 4, 0, 0, 240, 4, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 242, 4, 0, 0, 238, 4, 0, 0, 241, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 243, 4, 0, 0, 220, 4, 0, 0, 242, 4, 0, 0, 62, 0, 3, 0, 200, 4, 0, 0, 243, 4, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 244, 4, 0, 0, 67, 0, 0, 0, 62, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 245, 4, 0, 0, 244, 4, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 246, 4, 0, 0, 245, 4, 0, 0, 109, 0, 0, 0, 247, 0, 3, 0, 248, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 246, 4, 0, 0, 247, 4, 0, 0, 88, 5, 0, 0, 248, 0, 2, 0, 247, 4, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 251, 4, 0, 0, 200, 4, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 252, 4, 0, 0, 251, 4, 0, 0, 65, 0, 5, 0, 254, 4, 0, 0, 255, 4, 0, 0, 67, 0, 0, 0, 253, 4, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 0, 5, 0, 0, 255, 4, 0, 0, 111, 0, 4, 0, 6, 0, 0, 0, 1, 5, 0, 0, 0, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 2, 5, 0, 0, 252, 4, 0, 0, 1, 5, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 3, 5, 0, 0, 250, 4, 0, 0, 2, 5, 0, 0, 110, 0, 4, 0, 64, 0, 0, 0, 4, 5, 0, 0, 3, 5, 0, 0, 62, 0, 3, 0, 249, 4, 0, 0, 4, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 5, 5, 0, 0, 249, 4, 0, 0, 177, 0, 5, 0, 18, 0, 0, 0, 6, 5, 0, 0, 5, 5, 0, 0, 92, 0, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 7, 5, 0, 0, 6, 5, 0, 0, 247, 0, 3, 0, 9, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 7, 5, 0, 0, 8, 5, 0, 0, 9, 5, 0, 0, 248, 0, 2, 0, 8, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 10, 5, 0, 0, 249, 4, 0, 0, 65, 0, 5, 0, 254, 4, 0, 0, 12, 5, 0, 0, 67, 0, 0, 0, 11, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 13, 5, 0, 0, 12, 5, 0, 0, 175, 0, 5, 0, 18, 0, 0, 0, 14, 5, 0, 0, 10, 5, 0, 0, 13, 5, 0, 0, 249, 0, 2, 0, 9, 5, 0, 0, 248, 0, 2, 0, 9, 5, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 15, 5, 0, 0, 6, 5, 0, 0, 247, 4, 0, 0, 14, 5, 0, 0, 8, 5, 0, 0, 247, 0, 3, 0, 17, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 15, 5, 0, 0, 16, 5, 0, 0, 17, 5, 0, 0, 248, 0, 2, 0, 16, 5, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 17, 5, 0, 0, 65, 0, 5, 0, 254, 4, 0, 0, 20, 5, 0, 0, 67, 0, 0, 0, 19, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 21, 5, 0, 0, 20, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 22, 5, 0, 0, 249, 4, 0, 0, 132, 0, 5, 0, 64, 0, 0, 0, 23, 5, 0, 0, 22, 5, 0, 0, 21, 5, 0, 0, 62, 0, 3, 0, 249, 4, 0, 0, 23, 5, 0, 0, 65, 0, 5, 0, 254, 4, 0, 0, 24, 5, 0, 0, 67, 0, 0, 0, 168, 0, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 25, 5, 0, 0, 24, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 26, 5, 0, 0, 249, 4, 0, 0, 128, 0, 5, 0, 64, 0, 0, 0, 27, 5, 0, 0, 26, 5, 0, 0, 25, 5, 0, 0, 62, 0, 3, 0, 249, 4, 0, 0, 27, 5, 0, 0, 65, 0, 5, 0, 254, 4, 0, 0, 29, 5, 0, 0, 67, 0, 0, 0, 19, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 30, 5, 0, 0, 29, 5, 0, 0, 130, 0, 5, 0, 64, 0, 0, 0, 31, 5, 0, 0, 30, 5, 0, 0, 68, 0, 0, 0, 62, 0, 3, 0, 28, 5, 0, 0, 31, 5, 0, 0, 62, 0, 3, 0, 32, 5, 0, 0, 92, 0, 0, 0, 249, 0, 2, 0, 33, 5, 0, 0, 248, 0, 2, 0, 33, 5, 0, 0, 246, 0, 4, 0, 35, 5, 0, 0, 36, 5, 0, 0, 0, 0, 0, 0, 249, 0, 2, 0, 37, 5, 0, 0, 248, 0, 2, 0, 37, 5, 0, 0, 250, 0, 4, 0, 38, 5, 0, 0, 34, 5, 0, 0, 35, 5, 0, 0, 248, 0, 2, 0, 34, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 39, 5, 0, 0, 28, 5, 0, 0, 177, 0, 5, 0, 18, 0, 0, 0, 40, 5, 0, 0, 39, 5, 0, 0, 92, 0, 0, 0, 247, 0, 3, 0, 42, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 40, 5, 0, 0, 41, 5, 0, 0, 42, 5, 0, 0, 248, 0, 2, 0, 41, 5, 0, 0, 249, 0, 2, 0, 35, 5, 0, 0, 248, 0, 2, 0, 42, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 45, 5, 0, 0, 249, 4, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 46, 5, 0, 0, 28, 5, 0, 0, 128, 0, 5, 0, 64, 0, 0, 0, 47, 5, 0, 0, 45, 5, 0, 0, 46, 5, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 48, 5, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 47, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 49, 5, 0, 0, 48, 5, 0, 0, 62, 0, 3, 0, 44, 5, 0, 0, 49, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 50, 5, 0, 0, 44, 5, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 51, 5, 0, 0, 50, 5, 0, 0, 80, 1, 0, 0, 247, 0, 3, 0, 53, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 51, 5, 0, 0, 52, 5, 0, 0, 66, 5, 0, 0, 248, 0, 2, 0, 52, 5, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 54, 5, 0, 0, 200, 4, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 55, 5, 0, 0, 54, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 56, 5, 0, 0, 44, 5, 0, 0, 127, 0, 4, 0, 6, 0, 0, 0, 57, 5, 0, 0, 56, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 59, 5, 0, 0, 57, 5, 0, 0, 58, 5, 0, 0, 188, 0, 5, 0, 18, 0, 0, 0, 60, 5, 0, 0, 55, 5, 0, 0, 59, 5, 0, 0, 247, 0, 3, 0, 62, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 60, 5, 0, 0, 61, 5, 0, 0, 62, 5, 0, 0, 248, 0, 2, 0, 61, 5, 0, 0, 249, 0, 2, 0, 35, 5, 0, 0, 248, 0, 2, 0, 62, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 64, 5, 0, 0, 32, 5, 0, 0, 130, 0, 5, 0, 64, 0, 0, 0, 65, 5, 0, 0, 64, 5, 0, 0, 68, 0, 0, 0, 62, 0, 3, 0, 32, 5, 0, 0, 65, 5, 0, 0, 249, 0, 2, 0, 53, 5, 0, 0, 248, 0, 2, 0, 66, 5, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 67, 5, 0, 0, 200, 4, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 68, 5, 0, 0, 67, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 69, 5, 0, 0, 44, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 70, 5, 0, 0, 69, 5, 0, 0, 58, 5, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 71, 5, 0, 0, 68, 5, 0, 0, 70, 5, 0, 0, 247, 0, 3, 0, 73, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 71, 5, 0, 0, 72, 5, 0, 0, 73, 5, 0, 0, 248, 0, 2, 0, 72, 5, 0, 0, 249, 0, 2, 0, 35, 5, 0, 0, 248, 0, 2, 0, 73, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 75, 5, 0, 0, 32, 5, 0, 0, 128, 0, 5, 0, 64, 0, 0, 0, 76, 5, 0, 0, 75, 5, 0, 0, 68, 0, 0, 0, 62, 0, 3, 0, 32, 5, 0, 0, 76, 5, 0, 0, 249, 0, 2, 0, 53, 5, 0, 0, 248, 0, 2, 0, 53, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 77, 5, 0, 0, 28, 5, 0, 0, 130, 0, 5, 0, 64, 0, 0, 0, 78, 5, 0, 0, 77, 5, 0, 0, 68, 0, 0, 0, 62, 0, 3, 0, 28, 5, 0, 0, 78, 5, 0, 0, 249, 0, 2, 0, 36, 5, 0, 0, 248, 0, 2, 0, 36, 5, 0, 0, 249, 0, 2, 0, 33, 5, 0, 0, 248, 0, 2, 0, 35, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 79, 5, 0, 0, 32, 5, 0, 0, 179, 0, 5, 0, 18, 0, 0, 0, 80, 5, 0, 0, 79, 5, 0, 0, 92, 0, 0, 0, 247, 0, 3, 0, 82, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 80, 5, 0, 0, 81, 5, 0, 0, 84, 5, 0, 0, 248, 0, 2, 0, 81, 5, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 84, 5, 0, 0, 57, 0, 4, 0, 8, 0, 0, 0, 87, 5, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 86, 5, 0, 0, 87, 5, 0, 0, 249, 0, 2, 0, 82, 5, 0, 0, 248, 0, 2, 0, 82, 5, 0, 0, 249, 0, 2, 0, 248, 4, 0, 0, 248, 0, 2, 0, 88, 5, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 89, 5, 0, 0, 67, 0, 0, 0, 62, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 90, 5, 0, 0, 89, 5, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 92, 5, 0, 0, 90, 5, 0, 0, 91, 5, 0, 0, 247, 0, 3, 0, 94, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 92, 5, 0, 0, 93, 5, 0, 0, 115, 5, 0, 0, 248, 0, 2, 0, 93, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 96, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 239, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 97, 5, 0, 0, 96, 5, 0, 0, 62, 0, 3, 0, 95, 5, 0, 0, 97, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 99, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 168, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 100, 5, 0, 0, 99, 5, 0, 0, 62, 0, 3, 0, 98, 5, 0, 0, 100, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 102, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 253, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 103, 5, 0, 0, 102, 5, 0, 0, 62, 0, 3, 0, 101, 5, 0, 0, 103, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 105, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 11, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 106, 5, 0, 0, 105, 5, 0, 0, 62, 0, 3, 0, 104, 5, 0, 0, 106, 5, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 108, 5, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 107, 5, 0, 0, 108, 5, 0, 0, 57, 0, 9, 0, 18, 0, 0, 0, 109, 5, 0, 0, 38, 0, 0, 0, 95, 5, 0, 0, 98, 5, 0, 0, 101, 5, 0, 0, 104, 5, 0, 0, 107, 5, 0, 0, 247, 0, 3, 0, 111, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 109, 5, 0, 0, 110, 5, 0, 0, 113, 5, 0, 0, 248, 0, 2, 0, 110, 5, 0, 0, 57, 0, 4, 0, 8, 0, 0, 0, 112, 5, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 86, 5, 0, 0, 112, 5, 0, 0, 249, 0, 2, 0, 111, 5, 0, 0, 248, 0, 2, 0, 113, 5, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 111, 5, 0, 0, 249, 0, 2, 0, 94, 5, 0, 0, 248, 0, 2, 0, 115, 5, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 116, 5, 0, 0, 67, 0, 0, 0, 62, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 117, 5, 0, 0, 116, 5, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 118, 5, 0, 0, 117, 5, 0, 0, 101, 0, 0, 0, 247, 0, 3, 0, 120, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 118, 5, 0, 0, 119, 5, 0, 0, 181, 5, 0, 0, 248, 0, 2, 0, 119, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 123, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 19, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 124, 5, 0, 0, 123, 5, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 125, 5, 0, 0, 122, 5, 0, 0, 124, 5, 0, 0, 62, 0, 3, 0, 121, 5, 0, 0, 125, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 126, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 239, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 127, 5, 0, 0, 126, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 128, 5, 0, 0, 121, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 129, 5, 0, 0, 127, 5, 0, 0, 128, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 130, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 168, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 131, 5, 0, 0, 130, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 132, 5, 0, 0, 121, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 133, 5, 0, 0, 131, 5, 0, 0, 132, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 134, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 253, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 135, 5, 0, 0, 134, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 136, 5, 0, 0, 121, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 137, 5, 0, 0, 135, 5, 0, 0, 136, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 138, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 11, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 139, 5, 0, 0, 138, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 140, 5, 0, 0, 121, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 141, 5, 0, 0, 139, 5, 0, 0, 140, 5, 0, 0, 62, 0, 3, 0, 142, 5, 0, 0, 129, 5, 0, 0, 62, 0, 3, 0, 143, 5, 0, 0, 133, 5, 0, 0, 62, 0, 3, 0, 144, 5, 0, 0, 137, 5, 0, 0, 62, 0, 3, 0, 145, 5, 0, 0, 141, 5, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 147, 5, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 146, 5, 0, 0, 147, 5, 0, 0, 57, 0, 9, 0, 18, 0, 0, 0, 148, 5, 0, 0, 38, 0, 0, 0, 142, 5, 0, 0, 143, 5, 0, 0, 144, 5, 0, 0, 145, 5, 0, 0, 146, 5, 0, 0, 247, 0, 3, 0, 150, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 148, 5, 0, 0, 149, 5, 0, 0, 150, 5, 0, 0, 248, 0, 2, 0, 149, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 151, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 239, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 152, 5, 0, 0, 151, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 153, 5, 0, 0, 121, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 154, 5, 0, 0, 152, 5, 0, 0, 153, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 155, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 168, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 156, 5, 0, 0, 155, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 157, 5, 0, 0, 121, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 158, 5, 0, 0, 156, 5, 0, 0, 157, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 159, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 253, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 160, 5, 0, 0, 159, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 161, 5, 0, 0, 121, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 162, 5, 0, 0, 160, 5, 0, 0, 161, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 163, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 11, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 164, 5, 0, 0, 163, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 165, 5, 0, 0, 121, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 166, 5, 0, 0, 164, 5, 0, 0, 165, 5, 0, 0, 62, 0, 3, 0, 167, 5, 0, 0, 154, 5, 0, 0, 62, 0, 3, 0, 168, 5, 0, 0, 158, 5, 0, 0, 62, 0, 3, 0, 169, 5, 0, 0, 162, 5, 0, 0, 62, 0, 3, 0, 170, 5, 0, 0, 166, 5, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 172, 5, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 171, 5, 0, 0, 172, 5, 0, 0, 57, 0, 9, 0, 18, 0, 0, 0, 173, 5, 0, 0, 38, 0, 0, 0, 167, 5, 0, 0, 168, 5, 0, 0, 169, 5, 0, 0, 170, 5, 0, 0, 171, 5, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 174, 5, 0, 0, 173, 5, 0, 0, 249, 0, 2, 0, 150, 5, 0, 0, 248, 0, 2, 0, 150, 5, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 175, 5, 0, 0, 148, 5, 0, 0, 119, 5, 0, 0, 174, 5, 0, 0, 149, 5, 0, 0, 247, 0, 3, 0, 177, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 175, 5, 0, 0, 176, 5, 0, 0, 179, 5, 0, 0, 248, 0, 2, 0, 176, 5, 0, 0, 57, 0, 4, 0, 8, 0, 0, 0, 178, 5, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 86, 5, 0, 0, 178, 5, 0, 0, 249, 0, 2, 0, 177, 5, 0, 0, 248, 0, 2, 0, 179, 5, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 177, 5, 0, 0, 249, 0, 2, 0, 120, 5, 0, 0, 248, 0, 2, 0, 181, 5, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 182, 5, 0, 0, 67, 0, 0, 0, 62, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 183, 5, 0, 0, 182, 5, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 185, 5, 0, 0, 183, 5, 0, 0, 184, 5, 0, 0, 247, 0, 3, 0, 187, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 185, 5, 0, 0, 186, 5, 0, 0, 214, 5, 0, 0, 248, 0, 2, 0, 186, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 189, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 239, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 190, 5, 0, 0, 189, 5, 0, 0, 62, 0, 3, 0, 188, 5, 0, 0, 190, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 192, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 168, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 193, 5, 0, 0, 192, 5, 0, 0, 62, 0, 3, 0, 191, 5, 0, 0, 193, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 195, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 253, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 196, 5, 0, 0, 195, 5, 0, 0, 62, 0, 3, 0, 194, 5, 0, 0, 196, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 198, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 11, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 199, 5, 0, 0, 198, 5, 0, 0, 62, 0, 3, 0, 197, 5, 0, 0, 199, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 201, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 19, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 202, 5, 0, 0, 201, 5, 0, 0, 62, 0, 3, 0, 200, 5, 0, 0, 202, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 204, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 106, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 205, 5, 0, 0, 204, 5, 0, 0, 62, 0, 3, 0, 203, 5, 0, 0, 205, 5, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 207, 5, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 206, 5, 0, 0, 207, 5, 0, 0, 57, 0, 11, 0, 18, 0, 0, 0, 208, 5, 0, 0, 55, 0, 0, 0, 188, 5, 0, 0, 191, 5, 0, 0, 194, 5, 0, 0, 197, 5, 0, 0, 200, 5, 0, 0, 203, 5, 0, 0, 206, 5, 0, 0, 247, 0, 3, 0, 210, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 208, 5, 0, 0, 209, 5, 0, 0, 212, 5, 0, 0, 248, 0, 2, 0, 209, 5, 0, 0, 57, 0, 4, 0, 8, 0, 0, 0, 211, 5, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 86, 5, 0, 0, 211, 5, 0, 0, 249, 0, 2, 0, 210, 5, 0, 0, 248, 0, 2, 0, 212, 5, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 210, 5, 0, 0, 249, 0, 2, 0, 187, 5, 0, 0, 248, 0, 2, 0, 214, 5, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 215, 5, 0, 0, 67, 0, 0, 0, 62, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 216, 5, 0, 0, 215, 5, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 218, 5, 0, 0, 216, 5, 0, 0, 217, 5, 0, 0, 247, 0, 3, 0, 220, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 218, 5, 0, 0, 219, 5, 0, 0, 46, 6, 0, 0, 248, 0, 2, 0, 219, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 222, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 182, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 223, 5, 0, 0, 222, 5, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 224, 5, 0, 0, 122, 5, 0, 0, 223, 5, 0, 0, 62, 0, 3, 0, 221, 5, 0, 0, 224, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 225, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 239, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 226, 5, 0, 0, 225, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 227, 5, 0, 0, 221, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 228, 5, 0, 0, 226, 5, 0, 0, 227, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 229, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 168, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 230, 5, 0, 0, 229, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 231, 5, 0, 0, 221, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 232, 5, 0, 0, 230, 5, 0, 0, 231, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 233, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 253, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 234, 5, 0, 0, 233, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 235, 5, 0, 0, 221, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 236, 5, 0, 0, 234, 5, 0, 0, 235, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 237, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 11, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 238, 5, 0, 0, 237, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 239, 5, 0, 0, 221, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 240, 5, 0, 0, 238, 5, 0, 0, 239, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 241, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 19, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 242, 5, 0, 0, 241, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 243, 5, 0, 0, 221, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 244, 5, 0, 0, 242, 5, 0, 0, 243, 5, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 245, 5, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 106, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 246, 5, 0, 0, 245, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 247, 5, 0, 0, 221, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 248, 5, 0, 0, 246, 5, 0, 0, 247, 5, 0, 0, 62, 0, 3, 0, 249, 5, 0, 0, 228, 5, 0, 0, 62, 0, 3, 0, 250, 5, 0, 0, 232, 5, 0, 0, 62, 0, 3, 0, 251, 5, 0, 0, 236, 5, 0, 0, 62, 0, 3, 0, 252, 5, 0, 0, 240, 5, 0, 0, 62, 0, 3, 0, 253, 5, 0, 0, 244, 5, 0, 0, 62, 0, 3, 0, 254, 5, 0, 0, 248, 5, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 0, 6, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 255, 5, 0, 0, 0, 6, 0, 0, 57, 0, 11, 0, 18, 0, 0, 0, 1, 6, 0, 0, 55, 0, 0, 0, 249, 5, 0, 0, 250, 5, 0, 0, 251, 5, 0, 0, 252, 5, 0, 0, 253, 5, 0, 0, 254, 5, 0, 0, 255, 5, 0, 0, 247, 0, 3, 0, 3, 6, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 1, 6, 0, 0, 2, 6, 0, 0, 3, 6, 0, 0, 248, 0, 2, 0, 2, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 4, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 239, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 5, 6, 0, 0, 4, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 6, 6, 0, 0, 221, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 7, 6, 0, 0, 5, 6, 0, 0, 6, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 8, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 168, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 9, 6, 0, 0, 8, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 10, 6, 0, 0, 221, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 11, 6, 0, 0, 9, 6, 0, 0, 10, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 12, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 253, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 13, 6, 0, 0, 12, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 14, 6, 0, 0, 221, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 15, 6, 0, 0, 13, 6, 0, 0, 14, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 16, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 11, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 17, 6, 0, 0, 16, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 18, 6, 0, 0, 221, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 19, 6, 0, 0, 17, 6, 0, 0, 18, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 20, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 19, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 21, 6, 0, 0, 20, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 22, 6, 0, 0, 221, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 23, 6, 0, 0, 21, 6, 0, 0, 22, 6, 0, 0, 12, 0, 7, 0, 6, 0, 0, 0, 24, 6, 0, 0, 1, 0, 0, 0, 40, 0, 0, 0, 80, 1, 0, 0, 23, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 25, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 106, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 26, 6, 0, 0, 25, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 27, 6, 0, 0, 221, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 28, 6, 0, 0, 26, 6, 0, 0, 27, 6, 0, 0, 12, 0, 7, 0, 6, 0, 0, 0, 29, 6, 0, 0, 1, 0, 0, 0, 40, 0, 0, 0, 80, 1, 0, 0, 28, 6, 0, 0, 62, 0, 3, 0, 30, 6, 0, 0, 7, 6, 0, 0, 62, 0, 3, 0, 31, 6, 0, 0, 11, 6, 0, 0, 62, 0, 3, 0, 32, 6, 0, 0, 15, 6, 0, 0, 62, 0, 3, 0, 33, 6, 0, 0, 19, 6, 0, 0, 62, 0, 3, 0, 34, 6, 0, 0, 24, 6, 0, 0, 62, 0, 3, 0, 35, 6, 0, 0, 29, 6, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 37, 6, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 36, 6, 0, 0, 37, 6, 0, 0, 57, 0, 11, 0, 18, 0, 0, 0, 38, 6, 0, 0, 55, 0, 0, 0, 30, 6, 0, 0, 31, 6, 0, 0, 32, 6, 0, 0, 33, 6, 0, 0, 34, 6, 0, 0, 35, 6, 0, 0, 36, 6, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 39, 6, 0, 0, 38, 6, 0, 0, 249, 0, 2, 0, 3, 6, 0, 0, 248, 0, 2, 0, 3, 6, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 40, 6, 0, 0, 1, 6, 0, 0, 219, 5, 0, 0, 39, 6, 0, 0, 2, 6, 0, 0, 247, 0, 3, 0, 42, 6, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 40, 6, 0, 0, 41, 6, 0, 0, 44, 6, 0, 0, 248, 0, 2, 0, 41, 6, 0, 0, 57, 0, 4, 0, 8, 0, 0, 0, 43, 6, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 86, 5, 0, 0, 43, 6, 0, 0, 249, 0, 2, 0, 42, 6, 0, 0, 248, 0, 2, 0, 44, 6, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 42, 6, 0, 0, 249, 0, 2, 0, 220, 5, 0, 0, 248, 0, 2, 0, 46, 6, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 47, 6, 0, 0, 67, 0, 0, 0, 62, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 48, 6, 0, 0, 47, 6, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 50, 6, 0, 0, 48, 6, 0, 0, 49, 6, 0, 0, 247, 0, 3, 0, 52, 6, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 50, 6, 0, 0, 51, 6, 0, 0, 73, 6, 0, 0, 248, 0, 2, 0, 51, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 53, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 239, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 54, 6, 0, 0, 53, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 55, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 168, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 56, 6, 0, 0, 55, 6, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 57, 6, 0, 0, 54, 6, 0, 0, 56, 6, 0, 0, 62, 0, 3, 0, 58, 6, 0, 0, 57, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 60, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 253, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 61, 6, 0, 0, 60, 6, 0, 0, 62, 0, 3, 0, 59, 6, 0, 0, 61, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 63, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 11, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 64, 6, 0, 0, 63, 6, 0, 0, 62, 0, 3, 0, 62, 6, 0, 0, 64, 6, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 66, 6, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 65, 6, 0, 0, 66, 6, 0, 0, 57, 0, 8, 0, 18, 0, 0, 0, 67, 6, 0, 0, 45, 0, 0, 0, 58, 6, 0, 0, 59, 6, 0, 0, 62, 6, 0, 0, 65, 6, 0, 0, 247, 0, 3, 0, 69, 6, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 67, 6, 0, 0, 68, 6, 0, 0, 71, 6, 0, 0, 248, 0, 2, 0, 68, 6, 0, 0, 57, 0, 4, 0, 8, 0, 0, 0, 70, 6, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 86, 5, 0, 0, 70, 6, 0, 0, 249, 0, 2, 0, 69, 6, 0, 0, 248, 0, 2, 0, 71, 6, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 69, 6, 0, 0, 249, 0, 2, 0, 52, 6, 0, 0, 248, 0, 2, 0, 73, 6, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 74, 6, 0, 0, 67, 0, 0, 0, 62, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 75, 6, 0, 0, 74, 6, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 76, 6, 0, 0, 75, 6, 0, 0, 62, 0, 0, 0, 247, 0, 3, 0, 78, 6, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 76, 6, 0, 0, 77, 6, 0, 0, 130, 6, 0, 0, 248, 0, 2, 0, 77, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 80, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 182, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 81, 6, 0, 0, 80, 6, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 82, 6, 0, 0, 122, 5, 0, 0, 81, 6, 0, 0, 62, 0, 3, 0, 79, 6, 0, 0, 82, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 83, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 239, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 84, 6, 0, 0, 83, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 85, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 168, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 86, 6, 0, 0, 85, 6, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 87, 6, 0, 0, 84, 6, 0, 0, 86, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 88, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 253, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 89, 6, 0, 0, 88, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 90, 6, 0, 0, 79, 6, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 91, 6, 0, 0, 89, 6, 0, 0, 90, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 92, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 11, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 93, 6, 0, 0, 92, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 94, 6, 0, 0, 79, 6, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 95, 6, 0, 0, 93, 6, 0, 0, 94, 6, 0, 0, 62, 0, 3, 0, 96, 6, 0, 0, 87, 6, 0, 0, 62, 0, 3, 0, 97, 6, 0, 0, 91, 6, 0, 0, 62, 0, 3, 0, 98, 6, 0, 0, 95, 6, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 100, 6, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 99, 6, 0, 0, 100, 6, 0, 0, 57, 0, 8, 0, 18, 0, 0, 0, 101, 6, 0, 0, 45, 0, 0, 0, 96, 6, 0, 0, 97, 6, 0, 0, 98, 6, 0, 0, 99, 6, 0, 0, 247, 0, 3, 0, 103, 6, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 101, 6, 0, 0, 102, 6, 0, 0, 103, 6, 0, 0, 248, 0, 2, 0, 102, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 104, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 239, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 105, 6, 0, 0, 104, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 106, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 168, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 107, 6, 0, 0, 106, 6, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 108, 6, 0, 0, 105, 6, 0, 0, 107, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 109, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 253, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 110, 6, 0, 0, 109, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 111, 6, 0, 0, 79, 6, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 112, 6, 0, 0, 110, 6, 0, 0, 111, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 113, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 11, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 114, 6, 0, 0, 113, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 115, 6, 0, 0, 79, 6, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 116, 6, 0, 0, 114, 6, 0, 0, 115, 6, 0, 0, 62, 0, 3, 0, 117, 6, 0, 0, 108, 6, 0, 0, 62, 0, 3, 0, 118, 6, 0, 0, 112, 6, 0, 0, 62, 0, 3, 0, 119, 6, 0, 0, 116, 6, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 121, 6, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 120, 6, 0, 0, 121, 6, 0, 0, 57, 0, 8, 0, 18, 0, 0, 0, 122, 6, 0, 0, 45, 0, 0, 0, 117, 6, 0, 0, 118, 6, 0, 0, 119, 6, 0, 0, 120, 6, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 123, 6, 0, 0, 122, 6, 0, 0, 249, 0, 2, 0, 103, 6, 0, 0, 248, 0, 2, 0, 103, 6, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 124, 6, 0, 0, 101, 6, 0, 0, 77, 6, 0, 0, 123, 6, 0, 0, 102, 6, 0, 0, 247, 0, 3, 0, 126, 6, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 124, 6, 0, 0, 125, 6, 0, 0, 128, 6, 0, 0, 248, 0, 2, 0, 125, 6, 0, 0, 57, 0, 4, 0, 8, 0, 0, 0, 127, 6, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 86, 5, 0, 0, 127, 6, 0, 0, 249, 0, 2, 0, 126, 6, 0, 0, 248, 0, 2, 0, 128, 6, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 126, 6, 0, 0, 249, 0, 2, 0, 78, 6, 0, 0, 248, 0, 2, 0, 130, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 131, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 239, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 132, 6, 0, 0, 131, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 133, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 168, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 134, 6, 0, 0, 133, 6, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 135, 6, 0, 0, 132, 6, 0, 0, 134, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 136, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 253, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 137, 6, 0, 0, 136, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 138, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 11, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 139, 6, 0, 0, 138, 6, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 140, 6, 0, 0, 137, 6, 0, 0, 139, 6, 0, 0, 62, 0, 3, 0, 141, 6, 0, 0, 135, 6, 0, 0, 62, 0, 3, 0, 142, 6, 0, 0, 140, 6, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 144, 6, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 19, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 145, 6, 0, 0, 144, 6, 0, 0, 62, 0, 3, 0, 143, 6, 0, 0, 145, 6, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 147, 6, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 146, 6, 0, 0, 147, 6, 0, 0, 57, 0, 8, 0, 18, 0, 0, 0, 148, 6, 0, 0, 30, 0, 0, 0, 141, 6, 0, 0, 142, 6, 0, 0, 143, 6, 0, 0, 146, 6, 0, 0, 247, 0, 3, 0, 150, 6, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 148, 6, 0, 0, 149, 6, 0, 0, 152, 6, 0, 0, 248, 0, 2, 0, 149, 6, 0, 0, 57, 0, 4, 0, 8, 0, 0, 0, 151, 6, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 86, 5, 0, 0, 151, 6, 0, 0, 249, 0, 2, 0, 150, 6, 0, 0, 248, 0, 2, 0, 152, 6, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 150, 6, 0, 0, 249, 0, 2, 0, 78, 6, 0, 0, 248, 0, 2, 0, 78, 6, 0, 0, 249, 0, 2, 0, 52, 6, 0, 0, 248, 0, 2, 0, 52, 6, 0, 0, 249, 0, 2, 0, 220, 5, 0, 0, 248, 0, 2, 0, 220, 5, 0, 0, 249, 0, 2, 0, 187, 5, 0, 0, 248, 0, 2, 0, 187, 5, 0, 0, 249, 0, 2, 0, 120, 5, 0, 0, 248, 0, 2, 0, 120, 5, 0, 0, 249, 0, 2, 0, 94, 5, 0, 0, 248, 0, 2, 0, 94, 5, 0, 0, 249, 0, 2, 0, 248, 4, 0, 0, 248, 0, 2, 0, 248, 4, 0, 0, 253, 0, 1, 0, 56, 0, 1, 0, 54, 0, 5, 0, 8, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 10, 0, 0, 0, 248, 0, 2, 0, 12, 0, 0, 0, 59, 0, 4, 0, 58, 0, 0, 0, 59, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 58, 0, 0, 0, 72, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 58, 0, 0, 0, 119, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 161, 0, 0, 0, 162, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 161, 0, 0, 0, 195, 0, 0, 0, 7, 0, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 70, 0, 0, 0, 67, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 71, 0, 0, 0, 70, 0, 0, 0, 62, 0, 3, 0, 59, 0, 0, 0, 71, 0, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 73, 0, 0, 0, 67, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 74, 0, 0, 0, 73, 0, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 76, 0, 0, 0, 67, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 77, 0, 0, 0, 76, 0, 0, 0, 196, 0, 5, 0, 57, 0, 0, 0, 78, 0, 0, 0, 77, 0, 0, 0, 68, 0, 0, 0, 128, 0, 5, 0, 57, 0, 0, 0, 79, 0, 0, 0, 74, 0, 0, 0, 78, 0, 0, 0, 62, 0, 3, 0, 72, 0, 0, 0, 79, 0, 0, 0, 249, 0, 2, 0, 80, 0, 0, 0, 248, 0, 2, 0, 80, 0, 0, 0, 246, 0, 4, 0, 82, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 249, 0, 2, 0, 84, 0, 0, 0, 248, 0, 2, 0, 84, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 85, 0, 0, 0, 59, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 86, 0, 0, 0, 72, 0, 0, 0, 171, 0, 5, 0, 18, 0, 0, 0, 87, 0, 0, 0, 85, 0, 0, 0, 86, 0, 0, 0, 250, 0, 4, 0, 87, 0, 0, 0, 81, 0, 0, 0, 82, 0, 0, 0, 248, 0, 2, 0, 81, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 93, 0, 0, 0, 59, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 95, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 93, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 96, 0, 0, 0, 95, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 97, 0, 0, 0, 10, 0, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 98, 0, 0, 0, 96, 0, 0, 0, 97, 0, 0, 0, 247, 0, 3, 0, 100, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 98, 0, 0, 0, 99, 0, 0, 0, 104, 0, 0, 0, 248, 0, 2, 0, 99, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 102, 0, 0, 0, 59, 0, 0, 0, 128, 0, 5, 0, 57, 0, 0, 0, 103, 0, 0, 0, 102, 0, 0, 0, 101, 0, 0, 0, 62, 0, 3, 0, 59, 0, 0, 0, 103, 0, 0, 0, 249, 0, 2, 0, 100, 0, 0, 0, 248, 0, 2, 0, 104, 0, 0, 0, 249, 0, 2, 0, 82, 0, 0, 0, 248, 0, 2, 0, 100, 0, 0, 0, 249, 0, 2, 0, 83, 0, 0, 0, 248, 0, 2, 0, 83, 0, 0, 0, 249, 0, 2, 0, 80, 0, 0, 0, 248, 0, 2, 0, 82, 0, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 107, 0, 0, 0, 67, 0, 0, 0, 106, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 108, 0, 0, 0, 107, 0, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 110, 0, 0, 0, 108, 0, 0, 0, 109, 0, 0, 0, 247, 0, 3, 0, 112, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 110, 0, 0, 0, 111, 0, 0, 0, 132, 0, 0, 0, 248, 0, 2, 0, 111, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 113, 0, 0, 0, 59, 0, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 114, 0, 0, 0, 67, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 115, 0, 0, 0, 114, 0, 0, 0, 171, 0, 5, 0, 18, 0, 0, 0, 116, 0, 0, 0, 113, 0, 0, 0, 115, 0, 0, 0, 247, 0, 3, 0, 118, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 116, 0, 0, 0, 117, 0, 0, 0, 126, 0, 0, 0, 248, 0, 2, 0, 117, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 120, 0, 0, 0, 59, 0, 0, 0, 130, 0, 5, 0, 57, 0, 0, 0, 122, 0, 0, 0, 120, 0, 0, 0, 121, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 123, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 122, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 124, 0, 0, 0, 123, 0, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 125, 0, 0, 0, 124, 0, 0, 0, 62, 0, 3, 0, 119, 0, 0, 0, 125, 0, 0, 0, 249, 0, 2, 0, 118, 0, 0, 0, 248, 0, 2, 0, 126, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 127, 0, 0, 0, 59, 0, 0, 0, 128, 0, 5, 0, 57, 0, 0, 0, 128, 0, 0, 0, 127, 0, 0, 0, 121, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 129, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 128, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 130, 0, 0, 0, 129, 0, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 131, 0, 0, 0, 130, 0, 0, 0, 62, 0, 3, 0, 119, 0, 0, 0, 131, 0, 0, 0, 249, 0, 2, 0, 118, 0, 0, 0, 248, 0, 2, 0, 118, 0, 0, 0, 249, 0, 2, 0, 112, 0, 0, 0, 248, 0, 2, 0, 132, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 133, 0, 0, 0, 59, 0, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 134, 0, 0, 0, 67, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 135, 0, 0, 0, 134, 0, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 136, 0, 0, 0, 133, 0, 0, 0, 135, 0, 0, 0, 247, 0, 3, 0, 138, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 136, 0, 0, 0, 137, 0, 0, 0, 144, 0, 0, 0, 248, 0, 2, 0, 137, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 139, 0, 0, 0, 59, 0, 0, 0, 128, 0, 5, 0, 57, 0, 0, 0, 140, 0, 0, 0, 139, 0, 0, 0, 121, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 141, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 140, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 142, 0, 0, 0, 141, 0, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 143, 0, 0, 0, 142, 0, 0, 0, 62, 0, 3, 0, 119, 0, 0, 0, 143, 0, 0, 0, 249, 0, 2, 0, 138, 0, 0, 0, 248, 0, 2, 0, 144, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 145, 0, 0, 0, 59, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 146, 0, 0, 0, 72, 0, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 147, 0, 0, 0, 145, 0, 0, 0, 146, 0, 0, 0, 247, 0, 3, 0, 149, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 147, 0, 0, 0, 148, 0, 0, 0, 155, 0, 0, 0, 248, 0, 2, 0, 148, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 150, 0, 0, 0, 59, 0, 0, 0, 130, 0, 5, 0, 57, 0, 0, 0, 151, 0, 0, 0, 150, 0, 0, 0, 121, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 152, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 151, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 153, 0, 0, 0, 152, 0, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 154, 0, 0, 0, 153, 0, 0, 0, 62, 0, 3, 0, 119, 0, 0, 0, 154, 0, 0, 0, 249, 0, 2, 0, 149, 0, 0, 0, 248, 0, 2, 0, 155, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 156, 0, 0, 0, 59, 0, 0, 0, 130, 0, 5, 0, 57, 0, 0, 0, 157, 0, 0, 0, 156, 0, 0, 0, 121, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 158, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 157, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 159, 0, 0, 0, 158, 0, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 160, 0, 0, 0, 159, 0, 0, 0, 62, 0, 3, 0, 119, 0, 0, 0, 160, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 163, 0, 0, 0, 119, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 165, 0, 0, 0, 163, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 166, 0, 0, 0, 165, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 167, 0, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 169, 0, 0, 0, 167, 0, 0, 0, 168, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 170, 0, 0, 0, 169, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 171, 0, 0, 0, 170, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 172, 0, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 174, 0, 0, 0, 172, 0, 0, 0, 173, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 175, 0, 0, 0, 174, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 176, 0, 0, 0, 175, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 177, 0, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 179, 0, 0, 0, 177, 0, 0, 0, 178, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 180, 0, 0, 0, 179, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 181, 0, 0, 0, 180, 0, 0, 0, 65, 0, 5, 0, 183, 0, 0, 0, 184, 0, 0, 0, 67, 0, 0, 0, 182, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 185, 0, 0, 0, 184, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 186, 0, 0, 0, 181, 0, 0, 0, 185, 0, 0, 0, 80, 0, 7, 0, 8, 0, 0, 0, 187, 0, 0, 0, 166, 0, 0, 0, 171, 0, 0, 0, 176, 0, 0, 0, 186, 0, 0, 0, 142, 0, 5, 0, 8, 0, 0, 0, 189, 0, 0, 0, 187, 0, 0, 0, 188, 0, 0, 0, 62, 0, 3, 0, 162, 0, 0, 0, 189, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 190, 0, 0, 0, 59, 0, 0, 0, 128, 0, 5, 0, 57, 0, 0, 0, 191, 0, 0, 0, 190, 0, 0, 0, 121, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 192, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 191, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 193, 0, 0, 0, 192, 0, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 194, 0, 0, 0, 193, 0, 0, 0, 62, 0, 3, 0, 119, 0, 0, 0, 194, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 196, 0, 0, 0, 119, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 197, 0, 0, 0, 196, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 198, 0, 0, 0, 197, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 199, 0, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 200, 0, 0, 0, 199, 0, 0, 0, 168, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 201, 0, 0, 0, 200, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 202, 0, 0, 0, 201, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 203, 0, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 204, 0, 0, 0, 203, 0, 0, 0, 173, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 205, 0, 0, 0, 204, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 206, 0, 0, 0, 205, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 207, 0, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 208, 0, 0, 0, 207, 0, 0, 0, 178, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 209, 0, 0, 0, 208, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 210, 0, 0, 0, 209, 0, 0, 0, 65, 0, 5, 0, 183, 0, 0, 0, 211, 0, 0, 0, 67, 0, 0, 0, 182, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 212, 0, 0, 0, 211, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 213, 0, 0, 0, 210, 0, 0, 0, 212, 0, 0, 0, 80, 0, 7, 0, 8, 0, 0, 0, 214, 0, 0, 0, 198, 0, 0, 0, 202, 0, 0, 0, 206, 0, 0, 0, 213, 0, 0, 0, 142, 0, 5, 0, 8, 0, 0, 0, 215, 0, 0, 0, 214, 0, 0, 0, 188, 0, 0, 0, 62, 0, 3, 0, 195, 0, 0, 0, 215, 0, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 216, 0, 0, 0, 67, 0, 0, 0, 106, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 217, 0, 0, 0, 216, 0, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 218, 0, 0, 0, 217, 0, 0, 0, 121, 0, 0, 0, 247, 0, 3, 0, 220, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 218, 0, 0, 0, 219, 0, 0, 0, 236, 0, 0, 0, 248, 0, 2, 0, 219, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 221, 0, 0, 0, 10, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 222, 0, 0, 0, 59, 0, 0, 0, 130, 0, 5, 0, 57, 0, 0, 0, 223, 0, 0, 0, 222, 0, 0, 0, 101, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 224, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 223, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 225, 0, 0, 0, 224, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 226, 0, 0, 0, 221, 0, 0, 0, 225, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 227, 0, 0, 0, 59, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 228, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 227, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 229, 0, 0, 0, 228, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 230, 0, 0, 0, 59, 0, 0, 0, 130, 0, 5, 0, 57, 0, 0, 0, 231, 0, 0, 0, 230, 0, 0, 0, 101, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 232, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 231, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 233, 0, 0, 0, 232, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 234, 0, 0, 0, 229, 0, 0, 0, 233, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 235, 0, 0, 0, 226, 0, 0, 0, 234, 0, 0, 0, 62, 0, 3, 0, 10, 0, 0, 0, 235, 0, 0, 0, 249, 0, 2, 0, 220, 0, 0, 0, 248, 0, 2, 0, 236, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 237, 0, 0, 0, 59, 0, 0, 0, 130, 0, 5, 0, 57, 0, 0, 0, 238, 0, 0, 0, 237, 0, 0, 0, 101, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 239, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 238, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 240, 0, 0, 0, 239, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 241, 0, 0, 0, 59, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 242, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 241, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 243, 0, 0, 0, 242, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 244, 0, 0, 0, 10, 0, 0, 0, 12, 0, 8, 0, 6, 0, 0, 0, 245, 0, 0, 0, 1, 0, 0, 0, 49, 0, 0, 0, 240, 0, 0, 0, 243, 0, 0, 0, 244, 0, 0, 0, 62, 0, 3, 0, 10, 0, 0, 0, 245, 0, 0, 0, 249, 0, 2, 0, 220, 0, 0, 0, 248, 0, 2, 0, 220, 0, 0, 0, 61, 0, 4, 0, 8, 0, 0, 0, 246, 0, 0, 0, 162, 0, 0, 0, 61, 0, 4, 0, 8, 0, 0, 0, 247, 0, 0, 0, 195, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 248, 0, 0, 0, 10, 0, 0, 0, 80, 0, 7, 0, 8, 0, 0, 0, 249, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 12, 0, 8, 0, 8, 0, 0, 0, 250, 0, 0, 0, 1, 0, 0, 0, 46, 0, 0, 0, 246, 0, 0, 0, 247, 0, 0, 0, 249, 0, 0, 0, 254, 0, 2, 0, 250, 0, 0, 0, 248, 0, 2, 0, 149, 0, 0, 0, 249, 0, 2, 0, 138, 0, 0, 0, 248, 0, 2, 0, 138, 0, 0, 0, 249, 0, 2, 0, 112, 0, 0, 0, 248, 0, 2, 0, 112, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 252, 0, 0, 0, 119, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 253, 0, 0, 0, 252, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 254, 0, 0, 0, 253, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 255, 0, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 0, 1, 0, 0, 255, 0, 0, 0, 168, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 2, 1, 0, 0, 1, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 3, 1, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 4, 1, 0, 0, 3, 1, 0, 0, 173, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 5, 1, 0, 0, 4, 1, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 6, 1, 0, 0, 5, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 7, 1, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 8, 1, 0, 0, 7, 1, 0, 0, 178, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 9, 1, 0, 0, 8, 1, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 10, 1, 0, 0, 9, 1, 0, 0, 65, 0, 5, 0, 183, 0, 0, 0, 11, 1, 0, 0, 67, 0, 0, 0, 182, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 12, 1, 0, 0, 11, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 13, 1, 0, 0, 10, 1, 0, 0, 12, 1, 0, 0, 80, 0, 7, 0, 8, 0, 0, 0, 14, 1, 0, 0, 254, 0, 0, 0, 2, 1, 0, 0, 6, 1, 0, 0, 13, 1, 0, 0, 142, 0, 5, 0, 8, 0, 0, 0, 15, 1, 0, 0, 14, 1, 0, 0, 188, 0, 0, 0, 254, 0, 2, 0, 15, 1, 0, 0, 56, 0, 1, 0, 54, 0, 5, 0, 8, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 248, 0, 2, 0, 15, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 40, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 55, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 61, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 102, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 105, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 108, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 111, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 120, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 133, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 138, 1, 0, 0, 139, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 138, 1, 0, 0, 148, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 58, 0, 0, 0, 180, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 224, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 236, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 2, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 6, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 9, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 30, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 42, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 71, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 87, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 90, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 95, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 100, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 102, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 105, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 115, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 123, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 139, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 174, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 214, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 231, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 2, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 12, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 22, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 60, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 87, 3, 0, 0, 7, 0, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 18, 1, 0, 0, 67, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 19, 1, 0, 0, 18, 1, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 20, 1, 0, 0, 19, 1, 0, 0, 109, 0, 0, 0, 247, 0, 3, 0, 22, 1, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 20, 1, 0, 0, 21, 1, 0, 0, 34, 1, 0, 0, 248, 0, 2, 0, 21, 1, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 24, 1, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 25, 1, 0, 0, 24, 1, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 26, 1, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 27, 1, 0, 0, 26, 1, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 28, 1, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 29, 1, 0, 0, 28, 1, 0, 0, 65, 0, 5, 0, 183, 0, 0, 0, 30, 1, 0, 0, 67, 0, 0, 0, 182, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 31, 1, 0, 0, 30, 1, 0, 0, 80, 0, 7, 0, 8, 0, 0, 0, 32, 1, 0, 0, 25, 1, 0, 0, 27, 1, 0, 0, 29, 1, 0, 0, 31, 1, 0, 0, 254, 0, 2, 0, 32, 1, 0, 0, 248, 0, 2, 0, 34, 1, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 35, 1, 0, 0, 67, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 36, 1, 0, 0, 35, 1, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 37, 1, 0, 0, 36, 1, 0, 0, 121, 0, 0, 0, 247, 0, 3, 0, 39, 1, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 37, 1, 0, 0, 38, 1, 0, 0, 218, 1, 0, 0, 248, 0, 2, 0, 38, 1, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 44, 1, 0, 0, 42, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 45, 1, 0, 0, 44, 1, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 46, 1, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 47, 1, 0, 0, 46, 1, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 48, 1, 0, 0, 45, 1, 0, 0, 47, 1, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 49, 1, 0, 0, 42, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 50, 1, 0, 0, 49, 1, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 51, 1, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 52, 1, 0, 0, 51, 1, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 53, 1, 0, 0, 50, 1, 0, 0, 52, 1, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 54, 1, 0, 0, 48, 1, 0, 0, 53, 1, 0, 0, 62, 0, 3, 0, 40, 1, 0, 0, 54, 1, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 56, 1, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 57, 1, 0, 0, 56, 1, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 58, 1, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 59, 1, 0, 0, 58, 1, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 60, 1, 0, 0, 57, 1, 0, 0, 59, 1, 0, 0, 62, 0, 3, 0, 55, 1, 0, 0, 60, 1, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 63, 1, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 62, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 64, 1, 0, 0, 63, 1, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 66, 1, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 65, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 67, 1, 0, 0, 66, 1, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 68, 1, 0, 0, 64, 1, 0, 0, 67, 1, 0, 0, 62, 0, 3, 0, 61, 1, 0, 0, 68, 1, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 69, 1, 0, 0, 40, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 70, 1, 0, 0, 69, 1, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 71, 1, 0, 0, 55, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 72, 1, 0, 0, 71, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 73, 1, 0, 0, 70, 1, 0, 0, 72, 1, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 74, 1, 0, 0, 55, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 75, 1, 0, 0, 74, 1, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 76, 1, 0, 0, 40, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 77, 1, 0, 0, 76, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 78, 1, 0, 0, 75, 1, 0, 0, 77, 1, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 79, 1, 0, 0, 73, 1, 0, 0, 78, 1, 0, 0, 190, 0, 5, 0, 18, 0, 0, 0, 81, 1, 0, 0, 79, 1, 0, 0, 80, 1, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 82, 1, 0, 0, 81, 1, 0, 0, 247, 0, 3, 0, 84, 1, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 82, 1, 0, 0, 83, 1, 0, 0, 84, 1, 0, 0, 248, 0, 2, 0, 83, 1, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 85, 1, 0, 0, 61, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 86, 1, 0, 0, 85, 1, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 87, 1, 0, 0, 40, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 88, 1, 0, 0, 87, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 89, 1, 0, 0, 86, 1, 0, 0, 88, 1, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 90, 1, 0, 0, 40, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 91, 1, 0, 0, 90, 1, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 92, 1, 0, 0, 61, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 93, 1, 0, 0, 92, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 94, 1, 0, 0, 91, 1, 0, 0, 93, 1, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 95, 1, 0, 0, 89, 1, 0, 0, 94, 1, 0, 0, 190, 0, 5, 0, 18, 0, 0, 0, 96, 1, 0, 0, 95, 1, 0, 0, 80, 1, 0, 0, 249, 0, 2, 0, 84, 1, 0, 0, 248, 0, 2, 0, 84, 1, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 97, 1, 0, 0, 81, 1, 0, 0, 38, 1, 0, 0, 96, 1, 0, 0, 83, 1, 0, 0, 247, 0, 3, 0, 99, 1, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 97, 1, 0, 0, 98, 1, 0, 0, 99, 1, 0, 0, 248, 0, 2, 0, 98, 1, 0, 0, 254, 0, 2, 0, 100, 1, 0, 0, 248, 0, 2, 0, 99, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 103, 1, 0, 0, 40, 1, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 104, 1, 0, 0, 1, 0, 0, 0, 66, 0, 0, 0, 103, 1, 0, 0, 62, 0, 3, 0, 102, 1, 0, 0, 104, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 106, 1, 0, 0, 55, 1, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 107, 1, 0, 0, 1, 0, 0, 0, 66, 0, 0, 0, 106, 1, 0, 0, 62, 0, 3, 0, 105, 1, 0, 0, 107, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 109, 1, 0, 0, 61, 1, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 110, 1, 0, 0, 1, 0, 0, 0, 66, 0, 0, 0, 109, 1, 0, 0, 62, 0, 3, 0, 108, 1, 0, 0, 110, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 112, 1, 0, 0, 40, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 113, 1, 0, 0, 61, 1, 0, 0, 148, 0, 5, 0, 6, 0, 0, 0, 114, 1, 0, 0, 112, 1, 0, 0, 113, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 115, 1, 0, 0, 102, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 116, 1, 0, 0, 108, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 117, 1, 0, 0, 115, 1, 0, 0, 116, 1, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 118, 1, 0, 0, 114, 1, 0, 0, 117, 1, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 119, 1, 0, 0, 1, 0, 0, 0, 17, 0, 0, 0, 118, 1, 0, 0, 62, 0, 3, 0, 111, 1, 0, 0, 119, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 121, 1, 0, 0, 102, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 122, 1, 0, 0, 111, 1, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 123, 1, 0, 0, 1, 0, 0, 0, 13, 0, 0, 0, 122, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 124, 1, 0, 0, 121, 1, 0, 0, 123, 1, 0, 0, 62, 0, 3, 0, 120, 1, 0, 0, 124, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 125, 1, 0, 0, 40, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 126, 1, 0, 0, 55, 1, 0, 0, 148, 0, 5, 0, 6, 0, 0, 0, 127, 1, 0, 0, 125, 1, 0, 0, 126, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 128, 1, 0, 0, 102, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 129, 1, 0, 0, 105, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 130, 1, 0, 0, 128, 1, 0, 0, 129, 1, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 131, 1, 0, 0, 127, 1, 0, 0, 130, 1, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 132, 1, 0, 0, 1, 0, 0, 0, 17, 0, 0, 0, 131, 1, 0, 0, 62, 0, 3, 0, 111, 1, 0, 0, 132, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 134, 1, 0, 0, 102, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 135, 1, 0, 0, 111, 1, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 136, 1, 0, 0, 1, 0, 0, 0, 13, 0, 0, 0, 135, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 137, 1, 0, 0, 134, 1, 0, 0, 136, 1, 0, 0, 62, 0, 3, 0, 133, 1, 0, 0, 137, 1, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 140, 1, 0, 0, 67, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 141, 1, 0, 0, 140, 1, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 142, 1, 0, 0, 141, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 143, 1, 0, 0, 120, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 144, 1, 0, 0, 142, 1, 0, 0, 143, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 145, 1, 0, 0, 105, 1, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 146, 1, 0, 0, 144, 1, 0, 0, 145, 1, 0, 0, 110, 0, 4, 0, 64, 0, 0, 0, 147, 1, 0, 0, 146, 1, 0, 0, 62, 0, 3, 0, 139, 1, 0, 0, 147, 1, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 150, 1, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 149, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 151, 1, 0, 0, 150, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 152, 1, 0, 0, 133, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 153, 1, 0, 0, 151, 1, 0, 0, 152, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 154, 1, 0, 0, 108, 1, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 155, 1, 0, 0, 153, 1, 0, 0, 154, 1, 0, 0, 110, 0, 4, 0, 64, 0, 0, 0, 156, 1, 0, 0, 155, 1, 0, 0, 62, 0, 3, 0, 148, 1, 0, 0, 156, 1, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 157, 1, 0, 0, 139, 1, 0, 0, 175, 0, 5, 0, 18, 0, 0, 0, 158, 1, 0, 0, 157, 1, 0, 0, 92, 0, 0, 0, 247, 0, 3, 0, 160, 1, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 158, 1, 0, 0, 159, 1, 0, 0, 160, 1, 0, 0, 248, 0, 2, 0, 159, 1, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 161, 1, 0, 0, 139, 1, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 162, 1, 0, 0, 161, 1, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 163, 1, 0, 0, 67, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 164, 1, 0, 0, 163, 1, 0, 0, 176, 0, 5, 0, 18, 0, 0, 0, 165, 1, 0, 0, 162, 1, 0, 0, 164, 1, 0, 0, 249, 0, 2, 0, 160, 1, 0, 0, 248, 0, 2, 0, 160, 1, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 166, 1, 0, 0, 158, 1, 0, 0, 99, 1, 0, 0, 165, 1, 0, 0, 159, 1, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 167, 1, 0, 0, 148, 1, 0, 0, 175, 0, 5, 0, 18, 0, 0, 0, 168, 1, 0, 0, 167, 1, 0, 0, 92, 0, 0, 0, 167, 0, 5, 0, 18, 0, 0, 0, 169, 1, 0, 0, 166, 1, 0, 0, 168, 1, 0, 0, 247, 0, 3, 0, 171, 1, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 169, 1, 0, 0, 170, 1, 0, 0, 171, 1, 0, 0, 248, 0, 2, 0, 170, 1, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 172, 1, 0, 0, 148, 1, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 173, 1, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 149, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 174, 1, 0, 0, 173, 1, 0, 0, 110, 0, 4, 0, 64, 0, 0, 0, 175, 1, 0, 0, 174, 1, 0, 0, 177, 0, 5, 0, 18, 0, 0, 0, 176, 1, 0, 0, 172, 1, 0, 0, 175, 1, 0, 0, 249, 0, 2, 0, 171, 1, 0, 0, 248, 0, 2, 0, 171, 1, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 177, 1, 0, 0, 169, 1, 0, 0, 160, 1, 0, 0, 176, 1, 0, 0, 170, 1, 0, 0, 247, 0, 3, 0, 179, 1, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 177, 1, 0, 0, 178, 1, 0, 0, 216, 1, 0, 0, 248, 0, 2, 0, 178, 1, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 181, 1, 0, 0, 67, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 182, 1, 0, 0, 181, 1, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 183, 1, 0, 0, 148, 1, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 184, 1, 0, 0, 183, 1, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 185, 1, 0, 0, 67, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 186, 1, 0, 0, 185, 1, 0, 0, 132, 0, 5, 0, 57, 0, 0, 0, 187, 1, 0, 0, 184, 1, 0, 0, 186, 1, 0, 0, 128, 0, 5, 0, 57, 0, 0, 0, 188, 1, 0, 0, 182, 1, 0, 0, 187, 1, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 189, 1, 0, 0, 139, 1, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 190, 1, 0, 0, 189, 1, 0, 0, 128, 0, 5, 0, 57, 0, 0, 0, 191, 1, 0, 0, 188, 1, 0, 0, 190, 1, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 192, 1, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 191, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 193, 1, 0, 0, 192, 1, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 194, 1, 0, 0, 193, 1, 0, 0, 62, 0, 3, 0, 180, 1, 0, 0, 194, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 195, 1, 0, 0, 180, 1, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 196, 1, 0, 0, 195, 1, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 197, 1, 0, 0, 196, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 198, 1, 0, 0, 180, 1, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 199, 1, 0, 0, 198, 1, 0, 0, 168, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 200, 1, 0, 0, 199, 1, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 201, 1, 0, 0, 200, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 202, 1, 0, 0, 180, 1, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 203, 1, 0, 0, 202, 1, 0, 0, 173, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 204, 1, 0, 0, 203, 1, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 205, 1, 0, 0, 204, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 206, 1, 0, 0, 180, 1, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 207, 1, 0, 0, 206, 1, 0, 0, 178, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 208, 1, 0, 0, 207, 1, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 209, 1, 0, 0, 208, 1, 0, 0, 65, 0, 5, 0, 183, 0, 0, 0, 210, 1, 0, 0, 67, 0, 0, 0, 182, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 211, 1, 0, 0, 210, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 212, 1, 0, 0, 209, 1, 0, 0, 211, 1, 0, 0, 80, 0, 7, 0, 8, 0, 0, 0, 213, 1, 0, 0, 197, 1, 0, 0, 201, 1, 0, 0, 205, 1, 0, 0, 212, 1, 0, 0, 142, 0, 5, 0, 8, 0, 0, 0, 214, 1, 0, 0, 213, 1, 0, 0, 188, 0, 0, 0, 254, 0, 2, 0, 214, 1, 0, 0, 248, 0, 2, 0, 216, 1, 0, 0, 254, 0, 2, 0, 100, 1, 0, 0, 248, 0, 2, 0, 179, 1, 0, 0, 249, 0, 2, 0, 39, 1, 0, 0, 248, 0, 2, 0, 218, 1, 0, 0, 65, 0, 5, 0, 69, 0, 0, 0, 219, 1, 0, 0, 67, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 220, 1, 0, 0, 219, 1, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 221, 1, 0, 0, 220, 1, 0, 0, 101, 0, 0, 0, 247, 0, 3, 0, 223, 1, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 221, 1, 0, 0, 222, 1, 0, 0, 5, 2, 0, 0, 248, 0, 2, 0, 222, 1, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 225, 1, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 226, 1, 0, 0, 225, 1, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 227, 1, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 228, 1, 0, 0, 227, 1, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 229, 1, 0, 0, 226, 1, 0, 0, 228, 1, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 230, 1, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 231, 1, 0, 0, 230, 1, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 232, 1, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 233, 1, 0, 0, 232, 1, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 234, 1, 0, 0, 231, 1, 0, 0, 233, 1, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 235, 1, 0, 0, 229, 1, 0, 0, 234, 1, 0, 0, 62, 0, 3, 0, 224, 1, 0, 0, 235, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 238, 1, 0, 0, 224, 1, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 239, 1, 0, 0, 1, 0, 0, 0, 66, 0, 0, 0, 238, 1, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 240, 1, 0, 0, 237, 1, 0, 0, 239, 1, 0, 0, 62, 0, 3, 0, 236, 1, 0, 0, 240, 1, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 241, 1, 0, 0, 42, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 242, 1, 0, 0, 241, 1, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 243, 1, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 244, 1, 0, 0, 243, 1, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 245, 1, 0, 0, 242, 1, 0, 0, 244, 1, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 246, 1, 0, 0, 42, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 247, 1, 0, 0, 246, 1, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 248, 1, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 249, 1, 0, 0, 248, 1, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 250, 1, 0, 0, 247, 1, 0, 0, 249, 1, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 251, 1, 0, 0, 245, 1, 0, 0, 250, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 252, 1, 0, 0, 224, 1, 0, 0, 148, 0, 5, 0, 6, 0, 0, 0, 253, 1, 0, 0, 251, 1, 0, 0, 252, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 254, 1, 0, 0, 236, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 255, 1, 0, 0, 253, 1, 0, 0, 254, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 0, 2, 0, 0, 236, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 1, 2, 0, 0, 255, 1, 0, 0, 0, 2, 0, 0, 62, 0, 3, 0, 2, 2, 0, 0, 1, 2, 0, 0, 57, 0, 5, 0, 8, 0, 0, 0, 3, 2, 0, 0, 11, 0, 0, 0, 2, 2, 0, 0, 254, 0, 2, 0, 3, 2, 0, 0, 248, 0, 2, 0, 5, 2, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 7, 2, 0, 0, 42, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 8, 2, 0, 0, 7, 2, 0, 0, 62, 0, 3, 0, 6, 2, 0, 0, 8, 2, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 10, 2, 0, 0, 42, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 11, 2, 0, 0, 10, 2, 0, 0, 62, 0, 3, 0, 9, 2, 0, 0, 11, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 12, 2, 0, 0, 6, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 13, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 62, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 14, 2, 0, 0, 13, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 15, 2, 0, 0, 12, 2, 0, 0, 14, 2, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 16, 2, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 15, 2, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 18, 2, 0, 0, 16, 2, 0, 0, 17, 2, 0, 0, 247, 0, 3, 0, 20, 2, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 18, 2, 0, 0, 19, 2, 0, 0, 20, 2, 0, 0, 248, 0, 2, 0, 19, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 21, 2, 0, 0, 9, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 22, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 65, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 23, 2, 0, 0, 22, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 24, 2, 0, 0, 21, 2, 0, 0, 23, 2, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 25, 2, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 24, 2, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 26, 2, 0, 0, 25, 2, 0, 0, 17, 2, 0, 0, 249, 0, 2, 0, 20, 2, 0, 0, 248, 0, 2, 0, 20, 2, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 27, 2, 0, 0, 18, 2, 0, 0, 5, 2, 0, 0, 26, 2, 0, 0, 19, 2, 0, 0, 247, 0, 3, 0, 29, 2, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 27, 2, 0, 0, 28, 2, 0, 0, 29, 2, 0, 0, 248, 0, 2, 0, 28, 2, 0, 0, 62, 0, 3, 0, 30, 2, 0, 0, 80, 1, 0, 0, 57, 0, 5, 0, 8, 0, 0, 0, 31, 2, 0, 0, 11, 0, 0, 0, 30, 2, 0, 0, 254, 0, 2, 0, 31, 2, 0, 0, 248, 0, 2, 0, 29, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 33, 2, 0, 0, 6, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 34, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 62, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 35, 2, 0, 0, 34, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 36, 2, 0, 0, 33, 2, 0, 0, 35, 2, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 37, 2, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 36, 2, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 39, 2, 0, 0, 37, 2, 0, 0, 38, 2, 0, 0, 247, 0, 3, 0, 41, 2, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 39, 2, 0, 0, 40, 2, 0, 0, 104, 2, 0, 0, 248, 0, 2, 0, 40, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 43, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 44, 2, 0, 0, 43, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 45, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 46, 2, 0, 0, 45, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 47, 2, 0, 0, 44, 2, 0, 0, 46, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 48, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 49, 2, 0, 0, 48, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 50, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 51, 2, 0, 0, 50, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 52, 2, 0, 0, 49, 2, 0, 0, 51, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 53, 2, 0, 0, 6, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 54, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 55, 2, 0, 0, 54, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 56, 2, 0, 0, 53, 2, 0, 0, 55, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 57, 2, 0, 0, 6, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 58, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 59, 2, 0, 0, 58, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 60, 2, 0, 0, 57, 2, 0, 0, 59, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 61, 2, 0, 0, 56, 2, 0, 0, 60, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 62, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 63, 2, 0, 0, 62, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 64, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 65, 2, 0, 0, 64, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 66, 2, 0, 0, 63, 2, 0, 0, 65, 2, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 67, 2, 0, 0, 61, 2, 0, 0, 66, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 68, 2, 0, 0, 67, 2, 0, 0, 237, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 69, 2, 0, 0, 52, 2, 0, 0, 68, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 70, 2, 0, 0, 47, 2, 0, 0, 69, 2, 0, 0, 62, 0, 3, 0, 42, 2, 0, 0, 70, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 72, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 73, 2, 0, 0, 72, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 74, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 75, 2, 0, 0, 74, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 76, 2, 0, 0, 73, 2, 0, 0, 75, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 77, 2, 0, 0, 42, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 78, 2, 0, 0, 76, 2, 0, 0, 77, 2, 0, 0, 62, 0, 3, 0, 71, 2, 0, 0, 78, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 79, 2, 0, 0, 71, 2, 0, 0, 190, 0, 5, 0, 18, 0, 0, 0, 80, 2, 0, 0, 79, 2, 0, 0, 80, 1, 0, 0, 247, 0, 3, 0, 82, 2, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 80, 2, 0, 0, 81, 2, 0, 0, 85, 2, 0, 0, 248, 0, 2, 0, 81, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 83, 2, 0, 0, 71, 2, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 84, 2, 0, 0, 1, 0, 0, 0, 31, 0, 0, 0, 83, 2, 0, 0, 62, 0, 3, 0, 71, 2, 0, 0, 84, 2, 0, 0, 249, 0, 2, 0, 82, 2, 0, 0, 248, 0, 2, 0, 85, 2, 0, 0, 62, 0, 3, 0, 87, 2, 0, 0, 86, 2, 0, 0, 57, 0, 5, 0, 8, 0, 0, 0, 88, 2, 0, 0, 11, 0, 0, 0, 87, 2, 0, 0, 254, 0, 2, 0, 88, 2, 0, 0, 248, 0, 2, 0, 82, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 91, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 92, 2, 0, 0, 91, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 93, 2, 0, 0, 71, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 94, 2, 0, 0, 92, 2, 0, 0, 93, 2, 0, 0, 62, 0, 3, 0, 90, 2, 0, 0, 94, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 96, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 97, 2, 0, 0, 96, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 98, 2, 0, 0, 71, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 99, 2, 0, 0, 97, 2, 0, 0, 98, 2, 0, 0, 62, 0, 3, 0, 95, 2, 0, 0, 99, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 101, 2, 0, 0, 6, 2, 0, 0, 62, 0, 3, 0, 100, 2, 0, 0, 101, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 103, 2, 0, 0, 6, 2, 0, 0, 62, 0, 3, 0, 102, 2, 0, 0, 103, 2, 0, 0, 249, 0, 2, 0, 41, 2, 0, 0, 248, 0, 2, 0, 104, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 106, 2, 0, 0, 9, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 107, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 65, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 108, 2, 0, 0, 107, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 109, 2, 0, 0, 106, 2, 0, 0, 108, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 110, 2, 0, 0, 6, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 111, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 62, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 112, 2, 0, 0, 111, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 113, 2, 0, 0, 110, 2, 0, 0, 112, 2, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 114, 2, 0, 0, 109, 2, 0, 0, 113, 2, 0, 0, 62, 0, 3, 0, 105, 2, 0, 0, 114, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 116, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 65, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 117, 2, 0, 0, 116, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 118, 2, 0, 0, 105, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 119, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 62, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 120, 2, 0, 0, 119, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 121, 2, 0, 0, 118, 2, 0, 0, 120, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 122, 2, 0, 0, 117, 2, 0, 0, 121, 2, 0, 0, 62, 0, 3, 0, 115, 2, 0, 0, 122, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 124, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 125, 2, 0, 0, 124, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 126, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 127, 2, 0, 0, 126, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 128, 2, 0, 0, 125, 2, 0, 0, 127, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 129, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 130, 2, 0, 0, 129, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 131, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 132, 2, 0, 0, 131, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 133, 2, 0, 0, 130, 2, 0, 0, 132, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 134, 2, 0, 0, 105, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 135, 2, 0, 0, 133, 2, 0, 0, 134, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 136, 2, 0, 0, 105, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 137, 2, 0, 0, 135, 2, 0, 0, 136, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 138, 2, 0, 0, 128, 2, 0, 0, 137, 2, 0, 0, 62, 0, 3, 0, 123, 2, 0, 0, 138, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 141, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 142, 2, 0, 0, 141, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 143, 2, 0, 0, 140, 2, 0, 0, 142, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 144, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 145, 2, 0, 0, 144, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 146, 2, 0, 0, 143, 2, 0, 0, 145, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 147, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 148, 2, 0, 0, 147, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 149, 2, 0, 0, 146, 2, 0, 0, 148, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 151, 2, 0, 0, 105, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 152, 2, 0, 0, 150, 2, 0, 0, 151, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 153, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 154, 2, 0, 0, 153, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 155, 2, 0, 0, 152, 2, 0, 0, 154, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 156, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 157, 2, 0, 0, 156, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 158, 2, 0, 0, 155, 2, 0, 0, 157, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 159, 2, 0, 0, 115, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 160, 2, 0, 0, 158, 2, 0, 0, 159, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 161, 2, 0, 0, 149, 2, 0, 0, 160, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 162, 2, 0, 0, 105, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 163, 2, 0, 0, 150, 2, 0, 0, 162, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 164, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 165, 2, 0, 0, 164, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 166, 2, 0, 0, 163, 2, 0, 0, 165, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 167, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 168, 2, 0, 0, 167, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 169, 2, 0, 0, 166, 2, 0, 0, 168, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 170, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 171, 2, 0, 0, 170, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 172, 2, 0, 0, 169, 2, 0, 0, 171, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 173, 2, 0, 0, 161, 2, 0, 0, 172, 2, 0, 0, 62, 0, 3, 0, 139, 2, 0, 0, 173, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 175, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 176, 2, 0, 0, 175, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 177, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 178, 2, 0, 0, 177, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 179, 2, 0, 0, 176, 2, 0, 0, 178, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 180, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 181, 2, 0, 0, 180, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 182, 2, 0, 0, 179, 2, 0, 0, 181, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 183, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 184, 2, 0, 0, 183, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 185, 2, 0, 0, 182, 2, 0, 0, 184, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 186, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 187, 2, 0, 0, 186, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 188, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 189, 2, 0, 0, 188, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 190, 2, 0, 0, 187, 2, 0, 0, 189, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 191, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 192, 2, 0, 0, 191, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 193, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 194, 2, 0, 0, 193, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 195, 2, 0, 0, 192, 2, 0, 0, 194, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 196, 2, 0, 0, 115, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 197, 2, 0, 0, 115, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 198, 2, 0, 0, 196, 2, 0, 0, 197, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 199, 2, 0, 0, 195, 2, 0, 0, 198, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 200, 2, 0, 0, 115, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 201, 2, 0, 0, 150, 2, 0, 0, 200, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 202, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 203, 2, 0, 0, 202, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 204, 2, 0, 0, 201, 2, 0, 0, 203, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 205, 2, 0, 0, 199, 2, 0, 0, 204, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 206, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 207, 2, 0, 0, 206, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 208, 2, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 209, 2, 0, 0, 208, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 210, 2, 0, 0, 207, 2, 0, 0, 209, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 211, 2, 0, 0, 205, 2, 0, 0, 210, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 212, 2, 0, 0, 190, 2, 0, 0, 211, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 213, 2, 0, 0, 185, 2, 0, 0, 212, 2, 0, 0, 62, 0, 3, 0, 174, 2, 0, 0, 213, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 215, 2, 0, 0, 139, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 216, 2, 0, 0, 139, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 217, 2, 0, 0, 215, 2, 0, 0, 216, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 219, 2, 0, 0, 123, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 220, 2, 0, 0, 218, 2, 0, 0, 219, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 221, 2, 0, 0, 174, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 222, 2, 0, 0, 220, 2, 0, 0, 221, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 223, 2, 0, 0, 217, 2, 0, 0, 222, 2, 0, 0, 62, 0, 3, 0, 214, 2, 0, 0, 223, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 224, 2, 0, 0, 214, 2, 0, 0, 190, 0, 5, 0, 18, 0, 0, 0, 225, 2, 0, 0, 224, 2, 0, 0, 80, 1, 0, 0, 247, 0, 3, 0, 227, 2, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 225, 2, 0, 0, 226, 2, 0, 0, 230, 2, 0, 0, 248, 0, 2, 0, 226, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 228, 2, 0, 0, 214, 2, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 229, 2, 0, 0, 1, 0, 0, 0, 31, 0, 0, 0, 228, 2, 0, 0, 62, 0, 3, 0, 214, 2, 0, 0, 229, 2, 0, 0, 249, 0, 2, 0, 227, 2, 0, 0, 248, 0, 2, 0, 230, 2, 0, 0, 62, 0, 3, 0, 231, 2, 0, 0, 86, 2, 0, 0, 57, 0, 5, 0, 8, 0, 0, 0, 232, 2, 0, 0, 11, 0, 0, 0, 231, 2, 0, 0, 254, 0, 2, 0, 232, 2, 0, 0, 248, 0, 2, 0, 227, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 234, 2, 0, 0, 139, 2, 0, 0, 127, 0, 4, 0, 6, 0, 0, 0, 235, 2, 0, 0, 234, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 236, 2, 0, 0, 214, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 237, 2, 0, 0, 235, 2, 0, 0, 236, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 238, 2, 0, 0, 123, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 239, 2, 0, 0, 150, 2, 0, 0, 238, 2, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 240, 2, 0, 0, 237, 2, 0, 0, 239, 2, 0, 0, 62, 0, 3, 0, 100, 2, 0, 0, 240, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 241, 2, 0, 0, 139, 2, 0, 0, 127, 0, 4, 0, 6, 0, 0, 0, 242, 2, 0, 0, 241, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 243, 2, 0, 0, 214, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 244, 2, 0, 0, 242, 2, 0, 0, 243, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 245, 2, 0, 0, 123, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 246, 2, 0, 0, 150, 2, 0, 0, 245, 2, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 247, 2, 0, 0, 244, 2, 0, 0, 246, 2, 0, 0, 62, 0, 3, 0, 102, 2, 0, 0, 247, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 248, 2, 0, 0, 105, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 249, 2, 0, 0, 100, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 250, 2, 0, 0, 248, 2, 0, 0, 249, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 251, 2, 0, 0, 115, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 252, 2, 0, 0, 250, 2, 0, 0, 251, 2, 0, 0, 62, 0, 3, 0, 90, 2, 0, 0, 252, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 253, 2, 0, 0, 105, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 254, 2, 0, 0, 102, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 255, 2, 0, 0, 253, 2, 0, 0, 254, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 0, 3, 0, 0, 115, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 1, 3, 0, 0, 255, 2, 0, 0, 0, 3, 0, 0, 62, 0, 3, 0, 95, 2, 0, 0, 1, 3, 0, 0, 249, 0, 2, 0, 41, 2, 0, 0, 248, 0, 2, 0, 41, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 3, 3, 0, 0, 6, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 4, 3, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 62, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 5, 3, 0, 0, 4, 3, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 6, 3, 0, 0, 3, 3, 0, 0, 5, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 7, 3, 0, 0, 9, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 8, 3, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 65, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 9, 3, 0, 0, 8, 3, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 10, 3, 0, 0, 7, 3, 0, 0, 9, 3, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 11, 3, 0, 0, 6, 3, 0, 0, 10, 3, 0, 0, 62, 0, 3, 0, 2, 3, 0, 0, 11, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 13, 3, 0, 0, 100, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 14, 3, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 62, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 15, 3, 0, 0, 14, 3, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 16, 3, 0, 0, 13, 3, 0, 0, 15, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 17, 3, 0, 0, 90, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 18, 3, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 65, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 19, 3, 0, 0, 18, 3, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 20, 3, 0, 0, 17, 3, 0, 0, 19, 3, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 21, 3, 0, 0, 16, 3, 0, 0, 20, 3, 0, 0, 62, 0, 3, 0, 12, 3, 0, 0, 21, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 23, 3, 0, 0, 102, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 24, 3, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 62, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 25, 3, 0, 0, 24, 3, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 26, 3, 0, 0, 23, 3, 0, 0, 25, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 27, 3, 0, 0, 95, 2, 0, 0, 65, 0, 6, 0, 183, 0, 0, 0, 28, 3, 0, 0, 67, 0, 0, 0, 23, 1, 0, 0, 65, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 29, 3, 0, 0, 28, 3, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 30, 3, 0, 0, 27, 3, 0, 0, 29, 3, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 31, 3, 0, 0, 26, 3, 0, 0, 30, 3, 0, 0, 62, 0, 3, 0, 22, 3, 0, 0, 31, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 32, 3, 0, 0, 12, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 33, 3, 0, 0, 22, 3, 0, 0, 148, 0, 5, 0, 6, 0, 0, 0, 34, 3, 0, 0, 32, 3, 0, 0, 33, 3, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 35, 3, 0, 0, 34, 3, 0, 0, 80, 1, 0, 0, 247, 0, 3, 0, 37, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 35, 3, 0, 0, 36, 3, 0, 0, 45, 3, 0, 0, 248, 0, 2, 0, 36, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 38, 3, 0, 0, 2, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 39, 3, 0, 0, 12, 3, 0, 0, 148, 0, 5, 0, 6, 0, 0, 0, 40, 3, 0, 0, 38, 3, 0, 0, 39, 3, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 41, 3, 0, 0, 40, 3, 0, 0, 80, 1, 0, 0, 247, 0, 3, 0, 43, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 41, 3, 0, 0, 42, 3, 0, 0, 43, 3, 0, 0, 248, 0, 2, 0, 42, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 44, 3, 0, 0, 22, 3, 0, 0, 62, 0, 3, 0, 12, 3, 0, 0, 44, 3, 0, 0, 249, 0, 2, 0, 43, 3, 0, 0, 248, 0, 2, 0, 43, 3, 0, 0, 249, 0, 2, 0, 37, 3, 0, 0, 248, 0, 2, 0, 45, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 46, 3, 0, 0, 12, 3, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 47, 3, 0, 0, 1, 0, 0, 0, 66, 0, 0, 0, 46, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 48, 3, 0, 0, 22, 3, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 49, 3, 0, 0, 1, 0, 0, 0, 66, 0, 0, 0, 48, 3, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 50, 3, 0, 0, 47, 3, 0, 0, 49, 3, 0, 0, 247, 0, 3, 0, 52, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 50, 3, 0, 0, 51, 3, 0, 0, 52, 3, 0, 0, 248, 0, 2, 0, 51, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 53, 3, 0, 0, 22, 3, 0, 0, 62, 0, 3, 0, 12, 3, 0, 0, 53, 3, 0, 0, 249, 0, 2, 0, 52, 3, 0, 0, 248, 0, 2, 0, 52, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 54, 3, 0, 0, 2, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 55, 3, 0, 0, 12, 3, 0, 0, 148, 0, 5, 0, 6, 0, 0, 0, 56, 3, 0, 0, 54, 3, 0, 0, 55, 3, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 57, 3, 0, 0, 56, 3, 0, 0, 80, 1, 0, 0, 247, 0, 3, 0, 59, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 57, 3, 0, 0, 58, 3, 0, 0, 59, 3, 0, 0, 248, 0, 2, 0, 58, 3, 0, 0, 62, 0, 3, 0, 60, 3, 0, 0, 86, 2, 0, 0, 57, 0, 5, 0, 8, 0, 0, 0, 61, 3, 0, 0, 11, 0, 0, 0, 60, 3, 0, 0, 254, 0, 2, 0, 61, 3, 0, 0, 248, 0, 2, 0, 59, 3, 0, 0, 249, 0, 2, 0, 37, 3, 0, 0, 248, 0, 2, 0, 37, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 63, 3, 0, 0, 2, 3, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 64, 3, 0, 0, 63, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 65, 3, 0, 0, 2, 3, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 66, 3, 0, 0, 65, 3, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 67, 3, 0, 0, 64, 3, 0, 0, 66, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 68, 3, 0, 0, 2, 3, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 69, 3, 0, 0, 68, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 70, 3, 0, 0, 2, 3, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 71, 3, 0, 0, 70, 3, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 72, 3, 0, 0, 69, 3, 0, 0, 71, 3, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 73, 3, 0, 0, 67, 3, 0, 0, 72, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 74, 3, 0, 0, 12, 3, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 75, 3, 0, 0, 74, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 76, 3, 0, 0, 12, 3, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 77, 3, 0, 0, 76, 3, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 78, 3, 0, 0, 75, 3, 0, 0, 77, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 79, 3, 0, 0, 12, 3, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 80, 3, 0, 0, 79, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 81, 3, 0, 0, 12, 3, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 82, 3, 0, 0, 81, 3, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 83, 3, 0, 0, 80, 3, 0, 0, 82, 3, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 84, 3, 0, 0, 78, 3, 0, 0, 83, 3, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 85, 3, 0, 0, 73, 3, 0, 0, 84, 3, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 86, 3, 0, 0, 1, 0, 0, 0, 31, 0, 0, 0, 85, 3, 0, 0, 62, 0, 3, 0, 87, 3, 0, 0, 86, 3, 0, 0, 57, 0, 5, 0, 8, 0, 0, 0, 88, 3, 0, 0, 11, 0, 0, 0, 87, 3, 0, 0, 254, 0, 2, 0, 88, 3, 0, 0, 248, 0, 2, 0, 223, 1, 0, 0, 249, 0, 2, 0, 39, 1, 0, 0, 248, 0, 2, 0, 39, 1, 0, 0, 249, 0, 2, 0, 22, 1, 0, 0, 248, 0, 2, 0, 22, 1, 0, 0, 1, 0, 3, 0, 8, 0, 0, 0, 90, 3, 0, 0, 254, 0, 2, 0, 90, 3, 0, 0, 56, 0, 1, 0, 54, 0, 5, 0, 18, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 20, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 21, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 22, 0, 0, 0, 248, 0, 2, 0, 24, 0, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 91, 3, 0, 0, 21, 0, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 92, 3, 0, 0, 91, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 93, 3, 0, 0, 20, 0, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 94, 3, 0, 0, 93, 3, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 95, 3, 0, 0, 92, 3, 0, 0, 94, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 96, 3, 0, 0, 22, 0, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 97, 3, 0, 0, 96, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 98, 3, 0, 0, 20, 0, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 99, 3, 0, 0, 98, 3, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 100, 3, 0, 0, 97, 3, 0, 0, 99, 3, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 101, 3, 0, 0, 95, 3, 0, 0, 100, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 102, 3, 0, 0, 22, 0, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 103, 3, 0, 0, 102, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 104, 3, 0, 0, 20, 0, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 105, 3, 0, 0, 104, 3, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 106, 3, 0, 0, 103, 3, 0, 0, 105, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 107, 3, 0, 0, 21, 0, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 108, 3, 0, 0, 107, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 109, 3, 0, 0, 20, 0, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 110, 3, 0, 0, 109, 3, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 111, 3, 0, 0, 108, 3, 0, 0, 110, 3, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 112, 3, 0, 0, 106, 3, 0, 0, 111, 3, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 113, 3, 0, 0, 101, 3, 0, 0, 112, 3, 0, 0, 188, 0, 5, 0, 18, 0, 0, 0, 114, 3, 0, 0, 113, 3, 0, 0, 80, 1, 0, 0, 254, 0, 2, 0, 114, 3, 0, 0, 56, 0, 1, 0, 54, 0, 5, 0, 18, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 26, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 27, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 28, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 29, 0, 0, 0, 248, 0, 2, 0, 31, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 117, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 136, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 137, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 138, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 149, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 150, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 151, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 163, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 164, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 165, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 177, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 178, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 179, 3, 0, 0, 7, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 118, 3, 0, 0, 28, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 119, 3, 0, 0, 27, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 120, 3, 0, 0, 26, 0, 0, 0, 131, 0, 5, 0, 16, 0, 0, 0, 121, 3, 0, 0, 119, 3, 0, 0, 120, 3, 0, 0, 12, 0, 6, 0, 16, 0, 0, 0, 122, 3, 0, 0, 1, 0, 0, 0, 69, 0, 0, 0, 121, 3, 0, 0, 142, 0, 5, 0, 16, 0, 0, 0, 123, 3, 0, 0, 122, 3, 0, 0, 118, 3, 0, 0, 62, 0, 3, 0, 117, 3, 0, 0, 123, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 124, 3, 0, 0, 117, 3, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 125, 3, 0, 0, 124, 3, 0, 0, 127, 0, 4, 0, 6, 0, 0, 0, 126, 3, 0, 0, 125, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 127, 3, 0, 0, 117, 3, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 128, 3, 0, 0, 127, 3, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 129, 3, 0, 0, 126, 3, 0, 0, 128, 3, 0, 0, 62, 0, 3, 0, 117, 3, 0, 0, 129, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 130, 3, 0, 0, 26, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 131, 3, 0, 0, 117, 3, 0, 0, 129, 0, 5, 0, 16, 0, 0, 0, 132, 3, 0, 0, 130, 3, 0, 0, 131, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 133, 3, 0, 0, 27, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 134, 3, 0, 0, 117, 3, 0, 0, 129, 0, 5, 0, 16, 0, 0, 0, 135, 3, 0, 0, 133, 3, 0, 0, 134, 3, 0, 0, 62, 0, 3, 0, 136, 3, 0, 0, 132, 3, 0, 0, 62, 0, 3, 0, 137, 3, 0, 0, 135, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 139, 3, 0, 0, 29, 0, 0, 0, 62, 0, 3, 0, 138, 3, 0, 0, 139, 3, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 140, 3, 0, 0, 23, 0, 0, 0, 136, 3, 0, 0, 137, 3, 0, 0, 138, 3, 0, 0, 247, 0, 3, 0, 142, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 140, 3, 0, 0, 141, 3, 0, 0, 142, 3, 0, 0, 248, 0, 2, 0, 141, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 143, 3, 0, 0, 27, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 144, 3, 0, 0, 117, 3, 0, 0, 129, 0, 5, 0, 16, 0, 0, 0, 145, 3, 0, 0, 143, 3, 0, 0, 144, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 146, 3, 0, 0, 27, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 147, 3, 0, 0, 117, 3, 0, 0, 131, 0, 5, 0, 16, 0, 0, 0, 148, 3, 0, 0, 146, 3, 0, 0, 147, 3, 0, 0, 62, 0, 3, 0, 149, 3, 0, 0, 145, 3, 0, 0, 62, 0, 3, 0, 150, 3, 0, 0, 148, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 152, 3, 0, 0, 29, 0, 0, 0, 62, 0, 3, 0, 151, 3, 0, 0, 152, 3, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 153, 3, 0, 0, 23, 0, 0, 0, 149, 3, 0, 0, 150, 3, 0, 0, 151, 3, 0, 0, 249, 0, 2, 0, 142, 3, 0, 0, 248, 0, 2, 0, 142, 3, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 154, 3, 0, 0, 140, 3, 0, 0, 31, 0, 0, 0, 153, 3, 0, 0, 141, 3, 0, 0, 247, 0, 3, 0, 156, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 154, 3, 0, 0, 155, 3, 0, 0, 156, 3, 0, 0, 248, 0, 2, 0, 155, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 157, 3, 0, 0, 27, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 158, 3, 0, 0, 117, 3, 0, 0, 131, 0, 5, 0, 16, 0, 0, 0, 159, 3, 0, 0, 157, 3, 0, 0, 158, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 160, 3, 0, 0, 26, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 161, 3, 0, 0, 117, 3, 0, 0, 131, 0, 5, 0, 16, 0, 0, 0, 162, 3, 0, 0, 160, 3, 0, 0, 161, 3, 0, 0, 62, 0, 3, 0, 163, 3, 0, 0, 159, 3, 0, 0, 62, 0, 3, 0, 164, 3, 0, 0, 162, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 166, 3, 0, 0, 29, 0, 0, 0, 62, 0, 3, 0, 165, 3, 0, 0, 166, 3, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 167, 3, 0, 0, 23, 0, 0, 0, 163, 3, 0, 0, 164, 3, 0, 0, 165, 3, 0, 0, 249, 0, 2, 0, 156, 3, 0, 0, 248, 0, 2, 0, 156, 3, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 168, 3, 0, 0, 154, 3, 0, 0, 142, 3, 0, 0, 167, 3, 0, 0, 155, 3, 0, 0, 247, 0, 3, 0, 170, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 168, 3, 0, 0, 169, 3, 0, 0, 170, 3, 0, 0, 248, 0, 2, 0, 169, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 171, 3, 0, 0, 26, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 172, 3, 0, 0, 117, 3, 0, 0, 131, 0, 5, 0, 16, 0, 0, 0, 173, 3, 0, 0, 171, 3, 0, 0, 172, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 174, 3, 0, 0, 26, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 175, 3, 0, 0, 117, 3, 0, 0, 129, 0, 5, 0, 16, 0, 0, 0, 176, 3, 0, 0, 174, 3, 0, 0, 175, 3, 0, 0, 62, 0, 3, 0, 177, 3, 0, 0, 173, 3, 0, 0, 62, 0, 3, 0, 178, 3, 0, 0, 176, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 180, 3, 0, 0, 29, 0, 0, 0, 62, 0, 3, 0, 179, 3, 0, 0, 180, 3, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 181, 3, 0, 0, 23, 0, 0, 0, 177, 3, 0, 0, 178, 3, 0, 0, 179, 3, 0, 0, 249, 0, 2, 0, 170, 3, 0, 0, 248, 0, 2, 0, 170, 3, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 182, 3, 0, 0, 168, 3, 0, 0, 156, 3, 0, 0, 181, 3, 0, 0, 169, 3, 0, 0, 254, 0, 2, 0, 182, 3, 0, 0, 56, 0, 1, 0, 54, 0, 5, 0, 18, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 33, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 34, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 35, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 36, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 37, 0, 0, 0, 248, 0, 2, 0, 39, 0, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 185, 3, 0, 0, 37, 0, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 186, 3, 0, 0, 185, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 187, 3, 0, 0, 33, 0, 0, 0, 190, 0, 5, 0, 18, 0, 0, 0, 188, 3, 0, 0, 186, 3, 0, 0, 187, 3, 0, 0, 247, 0, 3, 0, 190, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 188, 3, 0, 0, 189, 3, 0, 0, 190, 3, 0, 0, 248, 0, 2, 0, 189, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 191, 3, 0, 0, 37, 0, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 192, 3, 0, 0, 191, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 193, 3, 0, 0, 35, 0, 0, 0, 188, 0, 5, 0, 18, 0, 0, 0, 194, 3, 0, 0, 192, 3, 0, 0, 193, 3, 0, 0, 249, 0, 2, 0, 190, 3, 0, 0, 248, 0, 2, 0, 190, 3, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 195, 3, 0, 0, 188, 3, 0, 0, 39, 0, 0, 0, 194, 3, 0, 0, 189, 3, 0, 0, 247, 0, 3, 0, 197, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 195, 3, 0, 0, 196, 3, 0, 0, 197, 3, 0, 0, 248, 0, 2, 0, 196, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 198, 3, 0, 0, 37, 0, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 199, 3, 0, 0, 198, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 200, 3, 0, 0, 34, 0, 0, 0, 190, 0, 5, 0, 18, 0, 0, 0, 201, 3, 0, 0, 199, 3, 0, 0, 200, 3, 0, 0, 249, 0, 2, 0, 197, 3, 0, 0, 248, 0, 2, 0, 197, 3, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 202, 3, 0, 0, 195, 3, 0, 0, 190, 3, 0, 0, 201, 3, 0, 0, 196, 3, 0, 0, 247, 0, 3, 0, 204, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 202, 3, 0, 0, 203, 3, 0, 0, 204, 3, 0, 0, 248, 0, 2, 0, 203, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 205, 3, 0, 0, 37, 0, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 206, 3, 0, 0, 205, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 207, 3, 0, 0, 36, 0, 0, 0, 188, 0, 5, 0, 18, 0, 0, 0, 208, 3, 0, 0, 206, 3, 0, 0, 207, 3, 0, 0, 249, 0, 2, 0, 204, 3, 0, 0, 248, 0, 2, 0, 204, 3, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 209, 3, 0, 0, 202, 3, 0, 0, 197, 3, 0, 0, 208, 3, 0, 0, 203, 3, 0, 0, 254, 0, 2, 0, 209, 3, 0, 0, 56, 0, 1, 0, 54, 0, 5, 0, 18, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 41, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 42, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 43, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 44, 0, 0, 0, 248, 0, 2, 0, 46, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 212, 3, 0, 0, 41, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 213, 3, 0, 0, 44, 0, 0, 0, 131, 0, 5, 0, 16, 0, 0, 0, 214, 3, 0, 0, 213, 3, 0, 0, 212, 3, 0, 0, 62, 0, 3, 0, 44, 0, 0, 0, 214, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 215, 3, 0, 0, 44, 0, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 216, 3, 0, 0, 215, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 217, 3, 0, 0, 44, 0, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 218, 3, 0, 0, 217, 3, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 219, 3, 0, 0, 216, 3, 0, 0, 218, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 220, 3, 0, 0, 42, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 221, 3, 0, 0, 42, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 222, 3, 0, 0, 220, 3, 0, 0, 221, 3, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 223, 3, 0, 0, 219, 3, 0, 0, 222, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 224, 3, 0, 0, 44, 0, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 225, 3, 0, 0, 224, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 226, 3, 0, 0, 44, 0, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 227, 3, 0, 0, 226, 3, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 228, 3, 0, 0, 225, 3, 0, 0, 227, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 229, 3, 0, 0, 43, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 230, 3, 0, 0, 43, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 231, 3, 0, 0, 229, 3, 0, 0, 230, 3, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 232, 3, 0, 0, 228, 3, 0, 0, 231, 3, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 233, 3, 0, 0, 223, 3, 0, 0, 232, 3, 0, 0, 188, 0, 5, 0, 18, 0, 0, 0, 234, 3, 0, 0, 233, 3, 0, 0, 237, 1, 0, 0, 254, 0, 2, 0, 234, 3, 0, 0, 56, 0, 1, 0, 54, 0, 5, 0, 18, 0, 0, 0, 55, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 48, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 49, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 50, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 51, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 52, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 53, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 54, 0, 0, 0, 248, 0, 2, 0, 56, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 247, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 248, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 249, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 8, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 9, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 10, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 26, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 27, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 28, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 44, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 45, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 46, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 62, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 63, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 64, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 80, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 81, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 82, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 98, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 99, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 100, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 116, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 117, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 118, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 132, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 133, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 135, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 137, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 151, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 152, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 154, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 156, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 170, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 171, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 173, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 175, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 189, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 190, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 192, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 194, 4, 0, 0, 7, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 237, 3, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 238, 3, 0, 0, 52, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 239, 3, 0, 0, 237, 3, 0, 0, 238, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 240, 3, 0, 0, 49, 0, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 241, 3, 0, 0, 239, 3, 0, 0, 240, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 242, 3, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 243, 3, 0, 0, 52, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 244, 3, 0, 0, 242, 3, 0, 0, 243, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 245, 3, 0, 0, 49, 0, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 246, 3, 0, 0, 244, 3, 0, 0, 245, 3, 0, 0, 62, 0, 3, 0, 247, 3, 0, 0, 241, 3, 0, 0, 62, 0, 3, 0, 248, 3, 0, 0, 246, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 250, 3, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 249, 3, 0, 0, 250, 3, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 251, 3, 0, 0, 23, 0, 0, 0, 247, 3, 0, 0, 248, 3, 0, 0, 249, 3, 0, 0, 247, 0, 3, 0, 253, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 251, 3, 0, 0, 252, 3, 0, 0, 253, 3, 0, 0, 248, 0, 2, 0, 252, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 254, 3, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 255, 3, 0, 0, 52, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 0, 4, 0, 0, 254, 3, 0, 0, 255, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 1, 4, 0, 0, 49, 0, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 2, 4, 0, 0, 0, 4, 0, 0, 1, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 3, 4, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 4, 4, 0, 0, 49, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 5, 4, 0, 0, 53, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 6, 4, 0, 0, 4, 4, 0, 0, 5, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 7, 4, 0, 0, 3, 4, 0, 0, 6, 4, 0, 0, 62, 0, 3, 0, 8, 4, 0, 0, 2, 4, 0, 0, 62, 0, 3, 0, 9, 4, 0, 0, 7, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 11, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 10, 4, 0, 0, 11, 4, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 12, 4, 0, 0, 23, 0, 0, 0, 8, 4, 0, 0, 9, 4, 0, 0, 10, 4, 0, 0, 249, 0, 2, 0, 253, 3, 0, 0, 248, 0, 2, 0, 253, 3, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 13, 4, 0, 0, 251, 3, 0, 0, 56, 0, 0, 0, 12, 4, 0, 0, 252, 3, 0, 0, 247, 0, 3, 0, 15, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 13, 4, 0, 0, 14, 4, 0, 0, 15, 4, 0, 0, 248, 0, 2, 0, 14, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 16, 4, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 17, 4, 0, 0, 49, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 18, 4, 0, 0, 53, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 19, 4, 0, 0, 17, 4, 0, 0, 18, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 20, 4, 0, 0, 16, 4, 0, 0, 19, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 21, 4, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 22, 4, 0, 0, 51, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 23, 4, 0, 0, 53, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 24, 4, 0, 0, 22, 4, 0, 0, 23, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 25, 4, 0, 0, 21, 4, 0, 0, 24, 4, 0, 0, 62, 0, 3, 0, 26, 4, 0, 0, 20, 4, 0, 0, 62, 0, 3, 0, 27, 4, 0, 0, 25, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 29, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 28, 4, 0, 0, 29, 4, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 30, 4, 0, 0, 23, 0, 0, 0, 26, 4, 0, 0, 27, 4, 0, 0, 28, 4, 0, 0, 249, 0, 2, 0, 15, 4, 0, 0, 248, 0, 2, 0, 15, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 31, 4, 0, 0, 13, 4, 0, 0, 253, 3, 0, 0, 30, 4, 0, 0, 14, 4, 0, 0, 247, 0, 3, 0, 33, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 31, 4, 0, 0, 32, 4, 0, 0, 33, 4, 0, 0, 248, 0, 2, 0, 32, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 34, 4, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 35, 4, 0, 0, 51, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 36, 4, 0, 0, 53, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 37, 4, 0, 0, 35, 4, 0, 0, 36, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 38, 4, 0, 0, 34, 4, 0, 0, 37, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 39, 4, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 40, 4, 0, 0, 52, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 41, 4, 0, 0, 39, 4, 0, 0, 40, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 42, 4, 0, 0, 51, 0, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 43, 4, 0, 0, 41, 4, 0, 0, 42, 4, 0, 0, 62, 0, 3, 0, 44, 4, 0, 0, 38, 4, 0, 0, 62, 0, 3, 0, 45, 4, 0, 0, 43, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 47, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 46, 4, 0, 0, 47, 4, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 48, 4, 0, 0, 23, 0, 0, 0, 44, 4, 0, 0, 45, 4, 0, 0, 46, 4, 0, 0, 249, 0, 2, 0, 33, 4, 0, 0, 248, 0, 2, 0, 33, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 49, 4, 0, 0, 31, 4, 0, 0, 15, 4, 0, 0, 48, 4, 0, 0, 32, 4, 0, 0, 247, 0, 3, 0, 51, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 49, 4, 0, 0, 50, 4, 0, 0, 51, 4, 0, 0, 248, 0, 2, 0, 50, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 52, 4, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 53, 4, 0, 0, 52, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 54, 4, 0, 0, 52, 4, 0, 0, 53, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 55, 4, 0, 0, 51, 0, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 56, 4, 0, 0, 54, 4, 0, 0, 55, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 57, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 58, 4, 0, 0, 52, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 59, 4, 0, 0, 57, 4, 0, 0, 58, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 60, 4, 0, 0, 51, 0, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 61, 4, 0, 0, 59, 4, 0, 0, 60, 4, 0, 0, 62, 0, 3, 0, 62, 4, 0, 0, 56, 4, 0, 0, 62, 0, 3, 0, 63, 4, 0, 0, 61, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 65, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 64, 4, 0, 0, 65, 4, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 66, 4, 0, 0, 23, 0, 0, 0, 62, 4, 0, 0, 63, 4, 0, 0, 64, 4, 0, 0, 249, 0, 2, 0, 51, 4, 0, 0, 248, 0, 2, 0, 51, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 67, 4, 0, 0, 49, 4, 0, 0, 33, 4, 0, 0, 66, 4, 0, 0, 50, 4, 0, 0, 247, 0, 3, 0, 69, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 67, 4, 0, 0, 68, 4, 0, 0, 69, 4, 0, 0, 248, 0, 2, 0, 68, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 70, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 71, 4, 0, 0, 52, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 72, 4, 0, 0, 70, 4, 0, 0, 71, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 73, 4, 0, 0, 51, 0, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 74, 4, 0, 0, 72, 4, 0, 0, 73, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 75, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 76, 4, 0, 0, 51, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 77, 4, 0, 0, 53, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 78, 4, 0, 0, 76, 4, 0, 0, 77, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 79, 4, 0, 0, 75, 4, 0, 0, 78, 4, 0, 0, 62, 0, 3, 0, 80, 4, 0, 0, 74, 4, 0, 0, 62, 0, 3, 0, 81, 4, 0, 0, 79, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 83, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 82, 4, 0, 0, 83, 4, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 84, 4, 0, 0, 23, 0, 0, 0, 80, 4, 0, 0, 81, 4, 0, 0, 82, 4, 0, 0, 249, 0, 2, 0, 69, 4, 0, 0, 248, 0, 2, 0, 69, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 85, 4, 0, 0, 67, 4, 0, 0, 51, 4, 0, 0, 84, 4, 0, 0, 68, 4, 0, 0, 247, 0, 3, 0, 87, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 85, 4, 0, 0, 86, 4, 0, 0, 87, 4, 0, 0, 248, 0, 2, 0, 86, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 88, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 89, 4, 0, 0, 51, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 90, 4, 0, 0, 53, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 91, 4, 0, 0, 89, 4, 0, 0, 90, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 92, 4, 0, 0, 88, 4, 0, 0, 91, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 93, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 94, 4, 0, 0, 49, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 95, 4, 0, 0, 53, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 96, 4, 0, 0, 94, 4, 0, 0, 95, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 97, 4, 0, 0, 93, 4, 0, 0, 96, 4, 0, 0, 62, 0, 3, 0, 98, 4, 0, 0, 92, 4, 0, 0, 62, 0, 3, 0, 99, 4, 0, 0, 97, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 101, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 100, 4, 0, 0, 101, 4, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 102, 4, 0, 0, 23, 0, 0, 0, 98, 4, 0, 0, 99, 4, 0, 0, 100, 4, 0, 0, 249, 0, 2, 0, 87, 4, 0, 0, 248, 0, 2, 0, 87, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 103, 4, 0, 0, 85, 4, 0, 0, 69, 4, 0, 0, 102, 4, 0, 0, 86, 4, 0, 0, 247, 0, 3, 0, 105, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 103, 4, 0, 0, 104, 4, 0, 0, 105, 4, 0, 0, 248, 0, 2, 0, 104, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 106, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 107, 4, 0, 0, 49, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 108, 4, 0, 0, 53, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 109, 4, 0, 0, 107, 4, 0, 0, 108, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 110, 4, 0, 0, 106, 4, 0, 0, 109, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 111, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 112, 4, 0, 0, 52, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 113, 4, 0, 0, 111, 4, 0, 0, 112, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 114, 4, 0, 0, 49, 0, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 115, 4, 0, 0, 113, 4, 0, 0, 114, 4, 0, 0, 62, 0, 3, 0, 116, 4, 0, 0, 110, 4, 0, 0, 62, 0, 3, 0, 117, 4, 0, 0, 115, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 119, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 118, 4, 0, 0, 119, 4, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 120, 4, 0, 0, 23, 0, 0, 0, 116, 4, 0, 0, 117, 4, 0, 0, 118, 4, 0, 0, 249, 0, 2, 0, 105, 4, 0, 0, 248, 0, 2, 0, 105, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 121, 4, 0, 0, 103, 4, 0, 0, 87, 4, 0, 0, 120, 4, 0, 0, 104, 4, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 122, 4, 0, 0, 121, 4, 0, 0, 247, 0, 3, 0, 124, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 122, 4, 0, 0, 123, 4, 0, 0, 124, 4, 0, 0, 248, 0, 2, 0, 123, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 125, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 126, 4, 0, 0, 52, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 127, 4, 0, 0, 125, 4, 0, 0, 126, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 128, 4, 0, 0, 49, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 129, 4, 0, 0, 53, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 130, 4, 0, 0, 128, 4, 0, 0, 129, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 131, 4, 0, 0, 127, 4, 0, 0, 130, 4, 0, 0, 62, 0, 3, 0, 132, 4, 0, 0, 131, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 134, 4, 0, 0, 52, 0, 0, 0, 62, 0, 3, 0, 133, 4, 0, 0, 134, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 136, 4, 0, 0, 53, 0, 0, 0, 62, 0, 3, 0, 135, 4, 0, 0, 136, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 138, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 137, 4, 0, 0, 138, 4, 0, 0, 57, 0, 8, 0, 18, 0, 0, 0, 139, 4, 0, 0, 45, 0, 0, 0, 132, 4, 0, 0, 133, 4, 0, 0, 135, 4, 0, 0, 137, 4, 0, 0, 249, 0, 2, 0, 124, 4, 0, 0, 248, 0, 2, 0, 124, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 140, 4, 0, 0, 121, 4, 0, 0, 105, 4, 0, 0, 139, 4, 0, 0, 123, 4, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 141, 4, 0, 0, 140, 4, 0, 0, 247, 0, 3, 0, 143, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 141, 4, 0, 0, 142, 4, 0, 0, 143, 4, 0, 0, 248, 0, 2, 0, 142, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 144, 4, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 145, 4, 0, 0, 52, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 146, 4, 0, 0, 144, 4, 0, 0, 145, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 147, 4, 0, 0, 49, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 148, 4, 0, 0, 53, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 149, 4, 0, 0, 147, 4, 0, 0, 148, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 150, 4, 0, 0, 146, 4, 0, 0, 149, 4, 0, 0, 62, 0, 3, 0, 151, 4, 0, 0, 150, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 153, 4, 0, 0, 52, 0, 0, 0, 62, 0, 3, 0, 152, 4, 0, 0, 153, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 155, 4, 0, 0, 53, 0, 0, 0, 62, 0, 3, 0, 154, 4, 0, 0, 155, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 157, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 156, 4, 0, 0, 157, 4, 0, 0, 57, 0, 8, 0, 18, 0, 0, 0, 158, 4, 0, 0, 45, 0, 0, 0, 151, 4, 0, 0, 152, 4, 0, 0, 154, 4, 0, 0, 156, 4, 0, 0, 249, 0, 2, 0, 143, 4, 0, 0, 248, 0, 2, 0, 143, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 159, 4, 0, 0, 140, 4, 0, 0, 124, 4, 0, 0, 158, 4, 0, 0, 142, 4, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 160, 4, 0, 0, 159, 4, 0, 0, 247, 0, 3, 0, 162, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 160, 4, 0, 0, 161, 4, 0, 0, 162, 4, 0, 0, 248, 0, 2, 0, 161, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 163, 4, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 164, 4, 0, 0, 52, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 165, 4, 0, 0, 163, 4, 0, 0, 164, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 166, 4, 0, 0, 51, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 167, 4, 0, 0, 53, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 168, 4, 0, 0, 166, 4, 0, 0, 167, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 169, 4, 0, 0, 165, 4, 0, 0, 168, 4, 0, 0, 62, 0, 3, 0, 170, 4, 0, 0, 169, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 172, 4, 0, 0, 52, 0, 0, 0, 62, 0, 3, 0, 171, 4, 0, 0, 172, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 174, 4, 0, 0, 53, 0, 0, 0, 62, 0, 3, 0, 173, 4, 0, 0, 174, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 176, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 175, 4, 0, 0, 176, 4, 0, 0, 57, 0, 8, 0, 18, 0, 0, 0, 177, 4, 0, 0, 45, 0, 0, 0, 170, 4, 0, 0, 171, 4, 0, 0, 173, 4, 0, 0, 175, 4, 0, 0, 249, 0, 2, 0, 162, 4, 0, 0, 248, 0, 2, 0, 162, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 178, 4, 0, 0, 159, 4, 0, 0, 143, 4, 0, 0, 177, 4, 0, 0, 161, 4, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 179, 4, 0, 0, 178, 4, 0, 0, 247, 0, 3, 0, 181, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 179, 4, 0, 0, 180, 4, 0, 0, 181, 4, 0, 0, 248, 0, 2, 0, 180, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 182, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 183, 4, 0, 0, 52, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 184, 4, 0, 0, 182, 4, 0, 0, 183, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 185, 4, 0, 0, 51, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 186, 4, 0, 0, 53, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 187, 4, 0, 0, 185, 4, 0, 0, 186, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 188, 4, 0, 0, 184, 4, 0, 0, 187, 4, 0, 0, 62, 0, 3, 0, 189, 4, 0, 0, 188, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 191, 4, 0, 0, 52, 0, 0, 0, 62, 0, 3, 0, 190, 4, 0, 0, 191, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 193, 4, 0, 0, 53, 0, 0, 0, 62, 0, 3, 0, 192, 4, 0, 0, 193, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 195, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 194, 4, 0, 0, 195, 4, 0, 0, 57, 0, 8, 0, 18, 0, 0, 0, 196, 4, 0, 0, 45, 0, 0, 0, 189, 4, 0, 0, 190, 4, 0, 0, 192, 4, 0, 0, 194, 4, 0, 0, 249, 0, 2, 0, 181, 4, 0, 0, 248, 0, 2, 0, 181, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 197, 4, 0, 0, 178, 4, 0, 0, 162, 4, 0, 0, 196, 4, 0, 0, 180, 4, 0, 0, 254, 0, 2, 0, 197, 4, 0, 0, 56, 0, 1, 0, };
+	const uint8 vertexShaderData[] = { 3, 2, 35, 7, 0, 0, 1, 0, 7, 0, 8, 0, 66, 0, 0, 0, 0, 0, 0, 0, 17, 0, 2, 0, 1, 0, 0, 0, 11, 0, 6, 0, 1, 0, 0, 0, 71, 76, 83, 76, 46, 115, 116, 100, 46, 52, 53, 48, 0, 0, 0, 0, 14, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 15, 0, 11, 0, 0, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 13, 0, 0, 0, 36, 0, 0, 0, 37, 0, 0, 0, 38, 0, 0, 0, 39, 0, 0, 0, 40, 0, 0, 0, 3, 0, 3, 0, 2, 0, 0, 0, 194, 1, 0, 0, 5, 0, 4, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 5, 0, 6, 0, 11, 0, 0, 0, 103, 108, 95, 80, 101, 114, 86, 101, 114, 116, 101, 120, 0, 0, 0, 0, 6, 0, 6, 0, 11, 0, 0, 0, 0, 0, 0, 0, 103, 108, 95, 80, 111, 115, 105, 116, 105, 111, 110, 0, 6, 0, 7, 0, 11, 0, 0, 0, 1, 0, 0, 0, 103, 108, 95, 80, 111, 105, 110, 116, 83, 105, 122, 101, 0, 0, 0, 0, 6, 0, 7, 0, 11, 0, 0, 0, 2, 0, 0, 0, 103, 108, 95, 67, 108, 105, 112, 68, 105, 115, 116, 97, 110, 99, 101, 0, 6, 0, 7, 0, 11, 0, 0, 0, 3, 0, 0, 0, 103, 108, 95, 67, 117, 108, 108, 68, 105, 115, 116, 97, 110, 99, 101, 0, 5, 0, 3, 0, 13, 0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 0, 36, 0, 0, 0, 99, 111, 114, 110, 101, 114, 115, 48, 49, 0, 0, 0, 5, 0, 5, 0, 37, 0, 0, 0, 99, 111, 114, 110, 101, 114, 115, 50, 51, 0, 0, 0, 5, 0, 5, 0, 38, 0, 0, 0, 99, 111, 110, 115, 116, 97, 110, 116, 115, 0, 0, 0, 5, 0, 6, 0, 39, 0, 0, 0, 111, 117, 116, 67, 111, 110, 115, 116, 97, 110, 116, 115, 0, 0, 0, 0, 5, 0, 6, 0, 40, 0, 0, 0, 103, 108, 95, 86, 101, 114, 116, 101, 120, 73, 110, 100, 101, 120, 0, 0, 72, 0, 5, 0, 11, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 72, 0, 5, 0, 11, 0, 0, 0, 1, 0, 0, 0, 11, 0, 0, 0, 1, 0, 0, 0, 72, 0, 5, 0, 11, 0, 0, 0, 2, 0, 0, 0, 11, 0, 0, 0, 3, 0, 0, 0, 72, 0, 5, 0, 11, 0, 0, 0, 3, 0, 0, 0, 11, 0, 0, 0, 4, 0, 0, 0, 71, 0, 3, 0, 11, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 36, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 37, 0, 0, 0, 30, 0, 0, 0, 1, 0, 0, 0, 71, 0, 4, 0, 38, 0, 0, 0, 30, 0, 0, 0, 2, 0, 0, 0, 71, 0, 3, 0, 39, 0, 0, 0, 14, 0, 0, 0, 71, 0, 4, 0, 39, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 40, 0, 0, 0, 11, 0, 0, 0, 42, 0, 0, 0, 19, 0, 2, 0, 2, 0, 0, 0, 33, 0, 3, 0, 3, 0, 0, 0, 2, 0, 0, 0, 22, 0, 3, 0, 6, 0, 0, 0, 32, 0, 0, 0, 23, 0, 4, 0, 7, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 21, 0, 4, 0, 8, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 43, 0, 4, 0, 8, 0, 0, 0, 9, 0, 0, 0, 1, 0, 0, 0, 28, 0, 4, 0, 10, 0, 0, 0, 6, 0, 0, 0, 9, 0, 0, 0, 30, 0, 6, 0, 11, 0, 0, 0, 7, 0, 0, 0, 6, 0, 0, 0, 10, 0, 0, 0, 10, 0, 0, 0, 32, 0, 4, 0, 12, 0, 0, 0, 3, 0, 0, 0, 11, 0, 0, 0, 59, 0, 4, 0, 12, 0, 0, 0, 13, 0, 0, 0, 3, 0, 0, 0, 21, 0, 4, 0, 14, 0, 0, 0, 32, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 14, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 23, 0, 4, 0, 16, 0, 0, 0, 6, 0, 0, 0, 2, 0, 0, 0, 32, 0, 4, 0, 17, 0, 0, 0, 1, 0, 0, 0, 16, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 21, 0, 0, 0, 0, 0, 128, 63, 20, 0, 2, 0, 28, 0, 0, 0, 23, 0, 4, 0, 29, 0, 0, 0, 8, 0, 0, 0, 4, 0, 0, 0, 43, 0, 4, 0, 8, 0, 0, 0, 30, 0, 0, 0, 8, 0, 0, 0, 28, 0, 4, 0, 31, 0, 0, 0, 29, 0, 0, 0, 30, 0, 0, 0, 32, 0, 4, 0, 32, 0, 0, 0, 1, 0, 0, 0, 31, 0, 0, 0, 32, 0, 4, 0, 33, 0, 0, 0, 3, 0, 0, 0, 31, 0, 0, 0, 32, 0, 4, 0, 34, 0, 0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 32, 0, 4, 0, 35, 0, 0, 0, 1, 0, 0, 0, 14, 0, 0, 0, 32, 0, 4, 0, 25, 0, 0, 0, 3, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 34, 0, 0, 0, 36, 0, 0, 0, 1, 0, 0, 0, 59, 0, 4, 0, 34, 0, 0, 0, 37, 0, 0, 0, 1, 0, 0, 0, 59, 0, 4, 0, 32, 0, 0, 0, 38, 0, 0, 0, 1, 0, 0, 0, 59, 0, 4, 0, 33, 0, 0, 0, 39, 0, 0, 0, 3, 0, 0, 0, 59, 0, 4, 0, 35, 0, 0, 0, 40, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 14, 0, 0, 0, 41, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 14, 0, 0, 0, 42, 0, 0, 0, 2, 0, 0, 0, 54, 0, 5, 0, 2, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 248, 0, 2, 0, 5, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 43, 0, 0, 0, 36, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 44, 0, 0, 0, 37, 0, 0, 0, 61, 0, 4, 0, 14, 0, 0, 0, 45, 0, 0, 0, 40, 0, 0, 0, 175, 0, 5, 0, 28, 0, 0, 0, 46, 0, 0, 0, 45, 0, 0, 0, 42, 0, 0, 0, 199, 0, 5, 0, 14, 0, 0, 0, 47, 0, 0, 0, 45, 0, 0, 0, 41, 0, 0, 0, 171, 0, 5, 0, 28, 0, 0, 0, 48, 0, 0, 0, 47, 0, 0, 0, 15, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 49, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 50, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 169, 0, 6, 0, 6, 0, 0, 0, 51, 0, 0, 0, 46, 0, 0, 0, 49, 0, 0, 0, 50, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 52, 0, 0, 0, 44, 0, 0, 0, 1, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 53, 0, 0, 0, 43, 0, 0, 0, 1, 0, 0, 0, 169, 0, 6, 0, 6, 0, 0, 0, 54, 0, 0, 0, 46, 0, 0, 0, 52, 0, 0, 0, 53, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 55, 0, 0, 0, 44, 0, 0, 0, 2, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 56, 0, 0, 0, 43, 0, 0, 0, 2, 0, 0, 0, 169, 0, 6, 0, 6, 0, 0, 0, 57, 0, 0, 0, 46, 0, 0, 0, 55, 0, 0, 0, 56, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 58, 0, 0, 0, 44, 0, 0, 0, 3, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 59, 0, 0, 0, 43, 0, 0, 0, 3, 0, 0, 0, 169, 0, 6, 0, 6, 0, 0, 0, 60, 0, 0, 0, 46, 0, 0, 0, 58, 0, 0, 0, 59, 0, 0, 0, 169, 0, 6, 0, 6, 0, 0, 0, 61, 0, 0, 0, 48, 0, 0, 0, 57, 0, 0, 0, 51, 0, 0, 0, 169, 0, 6, 0, 6, 0, 0, 0, 62, 0, 0, 0, 48, 0, 0, 0, 60, 0, 0, 0, 54, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 63, 0, 0, 0, 61, 0, 0, 0, 62, 0, 0, 0, 20, 0, 0, 0, 21, 0, 0, 0, 65, 0, 5, 0, 25, 0, 0, 0, 64, 0, 0, 0, 13, 0, 0, 0, 15, 0, 0, 0, 62, 0, 3, 0, 64, 0, 0, 0, 63, 0, 0, 0, 61, 0, 4, 0, 31, 0, 0, 0, 65, 0, 0, 0, 38, 0, 0, 0, 62, 0, 3, 0, 39, 0, 0, 0, 65, 0, 0, 0, 253, 0, 1, 0, 56, 0, 1, 0, };
+	const uint8 fragmentShaderData[] = { 3, 2, 35, 7, 0, 0, 1, 0, 7, 0, 8, 0, 6, 8, 0, 0, 0, 0, 0, 0, 17, 0, 2, 0, 1, 0, 0, 0, 11, 0, 6, 0, 1, 0, 0, 0, 71, 76, 83, 76, 46, 115, 116, 100, 46, 52, 53, 48, 0, 0, 0, 0, 14, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 15, 0, 8, 0, 4, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 42, 1, 0, 0, 86, 5, 0, 0, 159, 6, 0, 0, 16, 0, 3, 0, 4, 0, 0, 0, 7, 0, 0, 0, 3, 0, 3, 0, 2, 0, 0, 0, 194, 1, 0, 0, 5, 0, 4, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 5, 0, 8, 0, 11, 0, 0, 0, 71, 101, 116, 71, 114, 97, 100, 105, 101, 110, 116, 67, 111, 108, 111, 114, 40, 102, 49, 59, 0, 0, 0, 0, 5, 0, 5, 0, 10, 0, 0, 0, 103, 114, 97, 100, 105, 101, 110, 116, 0, 0, 0, 0, 5, 0, 5, 0, 14, 0, 0, 0, 71, 101, 116, 67, 111, 108, 111, 114, 40, 0, 0, 0, 5, 0, 8, 0, 23, 0, 0, 0, 67, 67, 87, 84, 101, 115, 116, 40, 118, 102, 50, 59, 118, 102, 50, 59, 118, 102, 50, 59, 0, 0, 0, 0, 5, 0, 3, 0, 20, 0, 0, 0, 97, 0, 0, 0, 5, 0, 3, 0, 21, 0, 0, 0, 98, 0, 0, 0, 5, 0, 3, 0, 22, 0, 0, 0, 99, 0, 0, 0, 5, 0, 9, 0, 30, 0, 0, 0, 72, 105, 116, 84, 101, 115, 116, 76, 105, 110, 101, 40, 118, 102, 50, 59, 118, 102, 50, 59, 102, 49, 59, 118, 102, 50, 59, 0, 5, 0, 3, 0, 26, 0, 0, 0, 97, 0, 0, 0, 5, 0, 3, 0, 27, 0, 0, 0, 98, 0, 0, 0, 5, 0, 5, 0, 28, 0, 0, 0, 108, 105, 110, 101, 87, 105, 100, 116, 104, 0, 0, 0, 5, 0, 3, 0, 29, 0, 0, 0, 112, 0, 0, 0, 5, 0, 11, 0, 38, 0, 0, 0, 72, 105, 116, 84, 101, 115, 116, 82, 101, 99, 116, 97, 110, 103, 108, 101, 40, 102, 49, 59, 102, 49, 59, 102, 49, 59, 102, 49, 59, 118, 102, 50, 59, 0, 0, 0, 5, 0, 4, 0, 33, 0, 0, 0, 108, 101, 102, 116, 0, 0, 0, 0, 5, 0, 3, 0, 34, 0, 0, 0, 116, 111, 112, 0, 5, 0, 4, 0, 35, 0, 0, 0, 114, 105, 103, 104, 116, 0, 0, 0, 5, 0, 4, 0, 36, 0, 0, 0, 98, 111, 116, 116, 111, 109, 0, 0, 5, 0, 3, 0, 37, 0, 0, 0, 112, 0, 0, 0, 5, 0, 10, 0, 45, 0, 0, 0, 72, 105, 116, 84, 101, 115, 116, 69, 108, 108, 105, 112, 115, 101, 40, 118, 102, 50, 59, 102, 49, 59, 102, 49, 59, 118, 102, 50, 59, 0, 0, 0, 5, 0, 4, 0, 41, 0, 0, 0, 99, 101, 110, 116, 101, 114, 0, 0, 5, 0, 3, 0, 42, 0, 0, 0, 114, 120, 0, 0, 5, 0, 3, 0, 43, 0, 0, 0, 114, 121, 0, 0, 5, 0, 3, 0, 44, 0, 0, 0, 112, 0, 0, 0, 5, 0, 14, 0, 55, 0, 0, 0, 72, 105, 116, 84, 101, 115, 116, 82, 111, 117, 110, 100, 101, 100, 82, 101, 99, 116, 97, 110, 103, 108, 101, 40, 102, 49, 59, 102, 49, 59, 102, 49, 59, 102, 49, 59, 102, 49, 59, 102, 49, 59, 118, 102, 50, 59, 0, 0, 5, 0, 4, 0, 48, 0, 0, 0, 108, 101, 102, 116, 0, 0, 0, 0, 5, 0, 3, 0, 49, 0, 0, 0, 116, 111, 112, 0, 5, 0, 4, 0, 50, 0, 0, 0, 114, 105, 103, 104, 116, 0, 0, 0, 5, 0, 4, 0, 51, 0, 0, 0, 98, 111, 116, 116, 111, 109, 0, 0, 5, 0, 3, 0, 52, 0, 0, 0, 114, 120, 0, 0, 5, 0, 3, 0, 53, 0, 0, 0, 114, 121, 0, 0, 5, 0, 3, 0, 54, 0, 0, 0, 112, 0, 0, 0, 5, 0, 4, 0, 59, 0, 0, 0, 111, 102, 102, 115, 101, 116, 0, 0, 5, 0, 6, 0, 65, 0, 0, 0, 67, 111, 110, 115, 116, 97, 110, 116, 66, 117, 102, 102, 101, 114, 0, 0, 6, 0, 6, 0, 65, 0, 0, 0, 0, 0, 0, 0, 99, 111, 108, 111, 114, 77, 111, 100, 101, 0, 0, 0, 6, 0, 6, 0, 65, 0, 0, 0, 1, 0, 0, 0, 99, 111, 108, 111, 114, 79, 102, 102, 115, 101, 116, 0, 6, 0, 6, 0, 65, 0, 0, 0, 2, 0, 0, 0, 99, 111, 108, 111, 114, 67, 111, 117, 110, 116, 0, 0, 6, 0, 5, 0, 65, 0, 0, 0, 3, 0, 0, 0, 112, 97, 114, 97, 109, 102, 0, 0, 6, 0, 6, 0, 65, 0, 0, 0, 4, 0, 0, 0, 114, 101, 110, 100, 101, 114, 77, 111, 100, 101, 0, 0, 6, 0, 6, 0, 65, 0, 0, 0, 5, 0, 0, 0, 116, 114, 97, 110, 115, 102, 111, 114, 109, 0, 0, 0, 6, 0, 5, 0, 65, 0, 0, 0, 6, 0, 0, 0, 100, 101, 99, 97, 121, 88, 0, 0, 6, 0, 5, 0, 65, 0, 0, 0, 7, 0, 0, 0, 100, 101, 99, 97, 121, 89, 0, 0, 6, 0, 7, 0, 65, 0, 0, 0, 8, 0, 0, 0, 120, 116, 97, 98, 108, 101, 79, 102, 102, 115, 101, 116, 0, 0, 0, 0, 6, 0, 6, 0, 65, 0, 0, 0, 9, 0, 0, 0, 120, 116, 97, 98, 108, 101, 83, 116, 97, 114, 116, 0, 6, 0, 7, 0, 65, 0, 0, 0, 10, 0, 0, 0, 120, 116, 97, 98, 108, 101, 72, 101, 105, 103, 104, 116, 0, 0, 0, 0, 6, 0, 6, 0, 65, 0, 0, 0, 11, 0, 0, 0, 120, 116, 97, 98, 108, 101, 87, 105, 100, 116, 104, 0, 6, 0, 8, 0, 65, 0, 0, 0, 12, 0, 0, 0, 105, 110, 116, 101, 114, 112, 111, 108, 97, 116, 105, 111, 110, 77, 111, 100, 101, 0, 0, 0, 6, 0, 5, 0, 65, 0, 0, 0, 13, 0, 0, 0, 111, 112, 97, 99, 105, 116, 121, 0, 5, 0, 4, 0, 72, 0, 0, 0, 115, 105, 122, 101, 0, 0, 0, 0, 5, 0, 6, 0, 89, 0, 0, 0, 83, 116, 111, 114, 97, 103, 101, 66, 117, 102, 102, 101, 114, 0, 0, 0, 6, 0, 5, 0, 89, 0, 0, 0, 0, 0, 0, 0, 100, 97, 116, 97, 0, 0, 0, 0, 5, 0, 3, 0, 91, 0, 0, 0, 115, 98, 0, 0, 5, 0, 4, 0, 119, 0, 0, 0, 99, 111, 108, 111, 114, 0, 0, 0, 5, 0, 4, 0, 162, 0, 0, 0, 99, 111, 108, 111, 114, 49, 0, 0, 5, 0, 4, 0, 195, 0, 0, 0, 99, 111, 108, 111, 114, 50, 0, 0, 5, 0, 3, 0, 40, 1, 0, 0, 112, 115, 0, 0, 5, 0, 6, 0, 42, 1, 0, 0, 103, 108, 95, 70, 114, 97, 103, 67, 111, 111, 114, 100, 0, 0, 0, 0, 5, 0, 3, 0, 55, 1, 0, 0, 97, 119, 0, 0, 5, 0, 3, 0, 61, 1, 0, 0, 97, 104, 0, 0, 5, 0, 4, 0, 102, 1, 0, 0, 112, 115, 76, 101, 110, 0, 0, 0, 5, 0, 4, 0, 105, 1, 0, 0, 97, 119, 76, 101, 110, 0, 0, 0, 5, 0, 4, 0, 108, 1, 0, 0, 97, 104, 76, 101, 110, 0, 0, 0, 5, 0, 4, 0, 111, 1, 0, 0, 97, 108, 112, 104, 97, 0, 0, 0, 5, 0, 3, 0, 120, 1, 0, 0, 119, 114, 0, 0, 5, 0, 3, 0, 133, 1, 0, 0, 104, 114, 0, 0, 5, 0, 3, 0, 139, 1, 0, 0, 119, 0, 0, 0, 5, 0, 3, 0, 148, 1, 0, 0, 104, 0, 0, 0, 5, 0, 4, 0, 180, 1, 0, 0, 99, 111, 108, 111, 114, 0, 0, 0, 5, 0, 3, 0, 224, 1, 0, 0, 97, 98, 0, 0, 5, 0, 4, 0, 236, 1, 0, 0, 114, 76, 101, 110, 0, 0, 0, 0, 5, 0, 4, 0, 2, 2, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 3, 0, 6, 2, 0, 0, 112, 120, 0, 0, 5, 0, 3, 0, 9, 2, 0, 0, 112, 121, 0, 0, 5, 0, 4, 0, 30, 2, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 3, 0, 42, 2, 0, 0, 112, 0, 0, 0, 5, 0, 3, 0, 71, 2, 0, 0, 99, 49, 0, 0, 5, 0, 4, 0, 87, 2, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 3, 0, 90, 2, 0, 0, 121, 49, 0, 0, 5, 0, 3, 0, 95, 2, 0, 0, 121, 50, 0, 0, 5, 0, 3, 0, 100, 2, 0, 0, 120, 49, 0, 0, 5, 0, 3, 0, 102, 2, 0, 0, 120, 50, 0, 0, 5, 0, 3, 0, 105, 2, 0, 0, 107, 0, 0, 0, 5, 0, 3, 0, 115, 2, 0, 0, 109, 0, 0, 0, 5, 0, 3, 0, 123, 2, 0, 0, 97, 0, 0, 0, 5, 0, 3, 0, 139, 2, 0, 0, 98, 0, 0, 0, 5, 0, 3, 0, 174, 2, 0, 0, 99, 0, 0, 0, 5, 0, 3, 0, 214, 2, 0, 0, 99, 49, 0, 0, 5, 0, 4, 0, 231, 2, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 3, 0, 2, 3, 0, 0, 112, 49, 0, 0, 5, 0, 3, 0, 12, 3, 0, 0, 112, 50, 0, 0, 5, 0, 3, 0, 22, 3, 0, 0, 112, 51, 0, 0, 5, 0, 4, 0, 60, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 87, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 117, 3, 0, 0, 116, 97, 110, 103, 101, 110, 116, 0, 5, 0, 4, 0, 136, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 137, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 138, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 149, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 150, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 151, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 163, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 164, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 165, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 177, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 178, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 179, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 247, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 248, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 249, 3, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 8, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 9, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 10, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 26, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 27, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 28, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 44, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 45, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 46, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 62, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 63, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 64, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 80, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 81, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 82, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 98, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 99, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 100, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 116, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 117, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 118, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 132, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 133, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 135, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 137, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 151, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 152, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 154, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 156, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 170, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 171, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 173, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 175, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 189, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 190, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 192, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 194, 4, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 5, 0, 200, 4, 0, 0, 112, 105, 120, 101, 108, 83, 97, 109, 112, 108, 101, 0, 5, 0, 3, 0, 249, 4, 0, 0, 105, 100, 120, 0, 5, 0, 3, 0, 28, 5, 0, 0, 119, 0, 0, 0, 5, 0, 5, 0, 32, 5, 0, 0, 112, 111, 108, 97, 114, 105, 116, 121, 0, 0, 0, 0, 5, 0, 3, 0, 44, 5, 0, 0, 120, 115, 0, 0, 5, 0, 5, 0, 86, 5, 0, 0, 111, 117, 116, 67, 111, 108, 111, 114, 0, 0, 0, 0, 5, 0, 4, 0, 95, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 98, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 101, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 104, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 107, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 121, 5, 0, 0, 100, 101, 108, 116, 97, 0, 0, 0, 5, 0, 4, 0, 142, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 143, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 144, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 145, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 146, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 167, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 168, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 169, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 170, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 171, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 188, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 191, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 194, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 197, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 200, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 203, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 206, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 221, 5, 0, 0, 100, 101, 108, 116, 97, 0, 0, 0, 5, 0, 4, 0, 249, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 250, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 251, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 252, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 253, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 254, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 255, 5, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 30, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 31, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 32, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 33, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 34, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 35, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 36, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 58, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 59, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 62, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 65, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 79, 6, 0, 0, 100, 101, 108, 116, 97, 0, 0, 0, 5, 0, 4, 0, 96, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 97, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 98, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 99, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 117, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 118, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 119, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 120, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 141, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 142, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 143, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 146, 6, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 5, 0, 159, 6, 0, 0, 99, 111, 110, 115, 116, 97, 110, 116, 115, 0, 0, 0, 5, 0, 6, 0, 248, 7, 0, 0, 114, 101, 110, 100, 101, 114, 77, 111, 100, 101, 83, 112, 101, 99, 0, 0, 5, 0, 6, 0, 250, 7, 0, 0, 99, 111, 108, 111, 114, 77, 111, 100, 101, 83, 112, 101, 99, 0, 0, 0, 71, 0, 4, 0, 61, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 71, 0, 4, 0, 63, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 1, 0, 0, 0, 35, 0, 0, 0, 4, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 2, 0, 0, 0, 35, 0, 0, 0, 8, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 3, 0, 0, 0, 35, 0, 0, 0, 12, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 4, 0, 0, 0, 35, 0, 0, 0, 68, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 5, 0, 0, 0, 35, 0, 0, 0, 72, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 6, 0, 0, 0, 35, 0, 0, 0, 96, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 7, 0, 0, 0, 35, 0, 0, 0, 100, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 8, 0, 0, 0, 35, 0, 0, 0, 104, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 9, 0, 0, 0, 35, 0, 0, 0, 108, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 10, 0, 0, 0, 35, 0, 0, 0, 112, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 11, 0, 0, 0, 35, 0, 0, 0, 116, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 12, 0, 0, 0, 35, 0, 0, 0, 120, 0, 0, 0, 72, 0, 5, 0, 65, 0, 0, 0, 13, 0, 0, 0, 35, 0, 0, 0, 124, 0, 0, 0, 71, 0, 3, 0, 65, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 88, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 72, 0, 5, 0, 89, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 71, 0, 3, 0, 89, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 91, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 91, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 42, 1, 0, 0, 11, 0, 0, 0, 15, 0, 0, 0, 71, 0, 4, 0, 86, 5, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 3, 0, 159, 6, 0, 0, 14, 0, 0, 0, 71, 0, 4, 0, 159, 6, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 248, 7, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 250, 7, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 19, 0, 2, 0, 2, 0, 0, 0, 33, 0, 3, 0, 3, 0, 0, 0, 2, 0, 0, 0, 22, 0, 3, 0, 6, 0, 0, 0, 32, 0, 0, 0, 32, 0, 4, 0, 7, 0, 0, 0, 7, 0, 0, 0, 6, 0, 0, 0, 23, 0, 4, 0, 8, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 33, 0, 4, 0, 9, 0, 0, 0, 8, 0, 0, 0, 7, 0, 0, 0, 33, 0, 3, 0, 13, 0, 0, 0, 8, 0, 0, 0, 23, 0, 4, 0, 16, 0, 0, 0, 6, 0, 0, 0, 2, 0, 0, 0, 32, 0, 4, 0, 17, 0, 0, 0, 7, 0, 0, 0, 16, 0, 0, 0, 20, 0, 2, 0, 18, 0, 0, 0, 33, 0, 6, 0, 19, 0, 0, 0, 18, 0, 0, 0, 17, 0, 0, 0, 17, 0, 0, 0, 17, 0, 0, 0, 33, 0, 7, 0, 25, 0, 0, 0, 18, 0, 0, 0, 17, 0, 0, 0, 17, 0, 0, 0, 7, 0, 0, 0, 17, 0, 0, 0, 33, 0, 8, 0, 32, 0, 0, 0, 18, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 17, 0, 0, 0, 33, 0, 7, 0, 40, 0, 0, 0, 18, 0, 0, 0, 17, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 17, 0, 0, 0, 33, 0, 10, 0, 47, 0, 0, 0, 18, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 17, 0, 0, 0, 21, 0, 4, 0, 57, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 32, 0, 4, 0, 58, 0, 0, 0, 7, 0, 0, 0, 57, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 60, 0, 0, 0, 14, 0, 0, 0, 28, 0, 4, 0, 61, 0, 0, 0, 6, 0, 0, 0, 60, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 62, 0, 0, 0, 6, 0, 0, 0, 28, 0, 4, 0, 63, 0, 0, 0, 6, 0, 0, 0, 62, 0, 0, 0, 21, 0, 4, 0, 64, 0, 0, 0, 32, 0, 0, 0, 1, 0, 0, 0, 30, 0, 16, 0, 65, 0, 0, 0, 57, 0, 0, 0, 57, 0, 0, 0, 57, 0, 0, 0, 61, 0, 0, 0, 57, 0, 0, 0, 63, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0, 64, 0, 0, 0, 64, 0, 0, 0, 64, 0, 0, 0, 64, 0, 0, 0, 57, 0, 0, 0, 6, 0, 0, 0, 32, 0, 4, 0, 66, 0, 0, 0, 9, 0, 0, 0, 65, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 68, 0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 69, 0, 0, 0, 9, 0, 0, 0, 57, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 75, 0, 0, 0, 2, 0, 0, 0, 29, 0, 3, 0, 88, 0, 0, 0, 6, 0, 0, 0, 30, 0, 3, 0, 89, 0, 0, 0, 88, 0, 0, 0, 32, 0, 4, 0, 90, 0, 0, 0, 2, 0, 0, 0, 89, 0, 0, 0, 59, 0, 4, 0, 90, 0, 0, 0, 91, 0, 0, 0, 2, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 92, 0, 0, 0, 0, 0, 0, 0, 32, 0, 4, 0, 94, 0, 0, 0, 2, 0, 0, 0, 6, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 101, 0, 0, 0, 2, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 106, 0, 0, 0, 12, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 109, 0, 0, 0, 0, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 121, 0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 161, 0, 0, 0, 7, 0, 0, 0, 8, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 164, 0, 0, 0, 255, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 168, 0, 0, 0, 8, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 173, 0, 0, 0, 16, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 178, 0, 0, 0, 24, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 182, 0, 0, 0, 13, 0, 0, 0, 32, 0, 4, 0, 183, 0, 0, 0, 9, 0, 0, 0, 6, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 188, 0, 0, 0, 129, 128, 128, 59, 43, 0, 4, 0, 64, 0, 0, 0, 23, 1, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 41, 1, 0, 0, 1, 0, 0, 0, 8, 0, 0, 0, 59, 0, 4, 0, 41, 1, 0, 0, 42, 1, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 43, 1, 0, 0, 1, 0, 0, 0, 6, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 62, 1, 0, 0, 4, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 65, 1, 0, 0, 5, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 80, 1, 0, 0, 0, 0, 0, 0, 44, 0, 7, 0, 8, 0, 0, 0, 100, 1, 0, 0, 80, 1, 0, 0, 80, 1, 0, 0, 80, 1, 0, 0, 80, 1, 0, 0, 32, 0, 4, 0, 138, 1, 0, 0, 7, 0, 0, 0, 64, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 149, 1, 0, 0, 6, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 237, 1, 0, 0, 0, 0, 128, 63, 43, 0, 4, 0, 6, 0, 0, 0, 17, 2, 0, 0, 10, 215, 35, 60, 43, 0, 4, 0, 6, 0, 0, 0, 38, 2, 0, 0, 0, 0, 192, 63, 43, 0, 4, 0, 6, 0, 0, 0, 86, 2, 0, 0, 255, 255, 127, 127, 43, 0, 4, 0, 6, 0, 0, 0, 140, 2, 0, 0, 0, 0, 0, 192, 43, 0, 4, 0, 6, 0, 0, 0, 150, 2, 0, 0, 0, 0, 0, 64, 43, 0, 4, 0, 6, 0, 0, 0, 218, 2, 0, 0, 0, 0, 128, 64, 43, 0, 4, 0, 64, 0, 0, 0, 239, 4, 0, 0, 7, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 250, 4, 0, 0, 0, 0, 0, 65, 43, 0, 4, 0, 64, 0, 0, 0, 253, 4, 0, 0, 9, 0, 0, 0, 32, 0, 4, 0, 254, 4, 0, 0, 9, 0, 0, 0, 64, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 11, 5, 0, 0, 10, 0, 0, 0, 43, 0, 4, 0, 64, 0, 0, 0, 19, 5, 0, 0, 11, 0, 0, 0, 41, 0, 3, 0, 18, 0, 0, 0, 38, 5, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 58, 5, 0, 0, 0, 80, 195, 71, 32, 0, 4, 0, 85, 5, 0, 0, 3, 0, 0, 0, 8, 0, 0, 0, 59, 0, 4, 0, 85, 5, 0, 0, 86, 5, 0, 0, 3, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 91, 5, 0, 0, 3, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 122, 5, 0, 0, 0, 0, 0, 63, 43, 0, 4, 0, 57, 0, 0, 0, 184, 5, 0, 0, 5, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 217, 5, 0, 0, 4, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 49, 6, 0, 0, 7, 0, 0, 0, 23, 0, 4, 0, 155, 6, 0, 0, 57, 0, 0, 0, 4, 0, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 156, 6, 0, 0, 8, 0, 0, 0, 28, 0, 4, 0, 157, 6, 0, 0, 155, 6, 0, 0, 156, 6, 0, 0, 32, 0, 4, 0, 158, 6, 0, 0, 1, 0, 0, 0, 157, 6, 0, 0, 59, 0, 4, 0, 158, 6, 0, 0, 159, 6, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 160, 6, 0, 0, 1, 0, 0, 0, 57, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 196, 7, 0, 0, 0, 0, 127, 67, 43, 0, 4, 0, 64, 0, 0, 0, 214, 7, 0, 0, 255, 255, 255, 127, 43, 0, 4, 0, 57, 0, 0, 0, 215, 7, 0, 0, 255, 255, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 216, 7, 0, 0, 255, 127, 0, 0, 43, 0, 4, 0, 57, 0, 0, 0, 217, 7, 0, 0, 0, 128, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 218, 7, 0, 0, 0, 0, 128, 61, 43, 0, 4, 0, 57, 0, 0, 0, 247, 7, 0, 0, 255, 255, 255, 255, 50, 0, 4, 0, 57, 0, 0, 0, 248, 7, 0, 0, 255, 255, 255, 255, 52, 0, 6, 0, 18, 0, 0, 0, 249, 7, 0, 0, 170, 0, 0, 0, 248, 7, 0, 0, 247, 7, 0, 0, 50, 0, 4, 0, 57, 0, 0, 0, 250, 7, 0, 0, 255, 255, 255, 255, 52, 0, 6, 0, 18, 0, 0, 0, 251, 7, 0, 0, 170, 0, 0, 0, 250, 7, 0, 0, 247, 7, 0, 0, 54, 0, 5, 0, 2, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 248, 0, 2, 0, 5, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 200, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 138, 1, 0, 0, 249, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 138, 1, 0, 0, 28, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 138, 1, 0, 0, 32, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 44, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 95, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 98, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 101, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 104, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 107, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 121, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 142, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 143, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 144, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 145, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 146, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 167, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 168, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 169, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 170, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 171, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 188, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 191, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 194, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 197, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 200, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 203, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 206, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 221, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 249, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 250, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 251, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 252, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 253, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 254, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 255, 5, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 30, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 31, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 32, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 33, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 34, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 35, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 36, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 58, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 59, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 62, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 65, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 79, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 96, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 97, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 98, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 99, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 117, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 118, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 119, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 120, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 141, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 142, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 143, 6, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 146, 6, 0, 0, 7, 0, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 161, 6, 0, 0, 159, 6, 0, 0, 62, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 162, 6, 0, 0, 161, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 202, 4, 0, 0, 162, 6, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 203, 4, 0, 0, 42, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 204, 4, 0, 0, 203, 4, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 163, 6, 0, 0, 159, 6, 0, 0, 65, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 164, 6, 0, 0, 163, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 206, 4, 0, 0, 164, 6, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 207, 4, 0, 0, 204, 4, 0, 0, 206, 4, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 208, 4, 0, 0, 202, 4, 0, 0, 207, 4, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 165, 6, 0, 0, 159, 6, 0, 0, 65, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 166, 6, 0, 0, 165, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 210, 4, 0, 0, 166, 6, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 211, 4, 0, 0, 42, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 212, 4, 0, 0, 211, 4, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 167, 6, 0, 0, 159, 6, 0, 0, 65, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 168, 6, 0, 0, 167, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 214, 4, 0, 0, 168, 6, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 215, 4, 0, 0, 212, 4, 0, 0, 214, 4, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 216, 4, 0, 0, 210, 4, 0, 0, 215, 4, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 217, 4, 0, 0, 208, 4, 0, 0, 216, 4, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 169, 6, 0, 0, 159, 6, 0, 0, 149, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 170, 6, 0, 0, 169, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 219, 4, 0, 0, 170, 6, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 220, 4, 0, 0, 217, 4, 0, 0, 219, 4, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 171, 6, 0, 0, 159, 6, 0, 0, 62, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 172, 6, 0, 0, 171, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 222, 4, 0, 0, 172, 6, 0, 0, 127, 0, 4, 0, 6, 0, 0, 0, 223, 4, 0, 0, 222, 4, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 224, 4, 0, 0, 42, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 225, 4, 0, 0, 224, 4, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 173, 6, 0, 0, 159, 6, 0, 0, 65, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 174, 6, 0, 0, 173, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 227, 4, 0, 0, 174, 6, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 228, 4, 0, 0, 225, 4, 0, 0, 227, 4, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 229, 4, 0, 0, 223, 4, 0, 0, 228, 4, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 175, 6, 0, 0, 159, 6, 0, 0, 65, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 176, 6, 0, 0, 175, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 231, 4, 0, 0, 176, 6, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 232, 4, 0, 0, 42, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 233, 4, 0, 0, 232, 4, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 177, 6, 0, 0, 159, 6, 0, 0, 65, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 178, 6, 0, 0, 177, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 235, 4, 0, 0, 178, 6, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 236, 4, 0, 0, 233, 4, 0, 0, 235, 4, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 237, 4, 0, 0, 231, 4, 0, 0, 236, 4, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 238, 4, 0, 0, 229, 4, 0, 0, 237, 4, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 179, 6, 0, 0, 159, 6, 0, 0, 149, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 180, 6, 0, 0, 179, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 241, 4, 0, 0, 180, 6, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 242, 4, 0, 0, 238, 4, 0, 0, 241, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 243, 4, 0, 0, 220, 4, 0, 0, 242, 4, 0, 0, 62, 0, 3, 0, 200, 4, 0, 0, 243, 4, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 181, 6, 0, 0, 159, 6, 0, 0, 62, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 252, 7, 0, 0, 181, 6, 0, 0, 169, 0, 6, 0, 57, 0, 0, 0, 245, 4, 0, 0, 249, 7, 0, 0, 252, 7, 0, 0, 248, 7, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 246, 4, 0, 0, 245, 4, 0, 0, 109, 0, 0, 0, 247, 0, 3, 0, 248, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 246, 4, 0, 0, 247, 4, 0, 0, 88, 5, 0, 0, 248, 0, 2, 0, 247, 4, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 251, 4, 0, 0, 200, 4, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 252, 4, 0, 0, 251, 4, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 182, 6, 0, 0, 159, 6, 0, 0, 149, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 183, 6, 0, 0, 182, 6, 0, 0, 124, 0, 4, 0, 64, 0, 0, 0, 0, 5, 0, 0, 183, 6, 0, 0, 111, 0, 4, 0, 6, 0, 0, 0, 1, 5, 0, 0, 0, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 2, 5, 0, 0, 252, 4, 0, 0, 1, 5, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 3, 5, 0, 0, 250, 4, 0, 0, 2, 5, 0, 0, 110, 0, 4, 0, 64, 0, 0, 0, 4, 5, 0, 0, 3, 5, 0, 0, 62, 0, 3, 0, 249, 4, 0, 0, 4, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 5, 5, 0, 0, 249, 4, 0, 0, 177, 0, 5, 0, 18, 0, 0, 0, 6, 5, 0, 0, 5, 5, 0, 0, 92, 0, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 7, 5, 0, 0, 6, 5, 0, 0, 247, 0, 3, 0, 9, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 7, 5, 0, 0, 8, 5, 0, 0, 9, 5, 0, 0, 248, 0, 2, 0, 8, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 10, 5, 0, 0, 249, 4, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 184, 6, 0, 0, 159, 6, 0, 0, 239, 4, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 185, 6, 0, 0, 184, 6, 0, 0, 124, 0, 4, 0, 64, 0, 0, 0, 13, 5, 0, 0, 185, 6, 0, 0, 175, 0, 5, 0, 18, 0, 0, 0, 14, 5, 0, 0, 10, 5, 0, 0, 13, 5, 0, 0, 249, 0, 2, 0, 9, 5, 0, 0, 248, 0, 2, 0, 9, 5, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 15, 5, 0, 0, 6, 5, 0, 0, 247, 4, 0, 0, 14, 5, 0, 0, 8, 5, 0, 0, 247, 0, 3, 0, 17, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 15, 5, 0, 0, 16, 5, 0, 0, 17, 5, 0, 0, 248, 0, 2, 0, 16, 5, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 17, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 186, 6, 0, 0, 159, 6, 0, 0, 239, 4, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 187, 6, 0, 0, 186, 6, 0, 0, 124, 0, 4, 0, 64, 0, 0, 0, 21, 5, 0, 0, 187, 6, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 22, 5, 0, 0, 249, 4, 0, 0, 132, 0, 5, 0, 64, 0, 0, 0, 23, 5, 0, 0, 22, 5, 0, 0, 21, 5, 0, 0, 62, 0, 3, 0, 249, 4, 0, 0, 23, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 188, 6, 0, 0, 159, 6, 0, 0, 149, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 189, 6, 0, 0, 188, 6, 0, 0, 124, 0, 4, 0, 64, 0, 0, 0, 25, 5, 0, 0, 189, 6, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 26, 5, 0, 0, 249, 4, 0, 0, 177, 0, 5, 0, 18, 0, 0, 0, 219, 7, 0, 0, 25, 5, 0, 0, 92, 0, 0, 0, 199, 0, 5, 0, 64, 0, 0, 0, 220, 7, 0, 0, 25, 5, 0, 0, 214, 7, 0, 0, 128, 0, 5, 0, 64, 0, 0, 0, 221, 7, 0, 0, 26, 5, 0, 0, 220, 7, 0, 0, 195, 0, 5, 0, 64, 0, 0, 0, 222, 7, 0, 0, 26, 5, 0, 0, 68, 0, 0, 0, 128, 0, 5, 0, 64, 0, 0, 0, 223, 7, 0, 0, 222, 7, 0, 0, 220, 7, 0, 0, 128, 0, 5, 0, 64, 0, 0, 0, 224, 7, 0, 0, 223, 7, 0, 0, 68, 0, 0, 0, 169, 0, 6, 0, 64, 0, 0, 0, 27, 5, 0, 0, 219, 7, 0, 0, 224, 7, 0, 0, 221, 7, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 225, 7, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 220, 7, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 226, 7, 0, 0, 225, 7, 0, 0, 62, 0, 3, 0, 249, 4, 0, 0, 27, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 190, 6, 0, 0, 159, 6, 0, 0, 239, 4, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 191, 6, 0, 0, 190, 6, 0, 0, 124, 0, 4, 0, 64, 0, 0, 0, 30, 5, 0, 0, 191, 6, 0, 0, 130, 0, 5, 0, 64, 0, 0, 0, 31, 5, 0, 0, 30, 5, 0, 0, 68, 0, 0, 0, 62, 0, 3, 0, 28, 5, 0, 0, 31, 5, 0, 0, 62, 0, 3, 0, 32, 5, 0, 0, 92, 0, 0, 0, 249, 0, 2, 0, 33, 5, 0, 0, 248, 0, 2, 0, 33, 5, 0, 0, 246, 0, 4, 0, 35, 5, 0, 0, 36, 5, 0, 0, 0, 0, 0, 0, 249, 0, 2, 0, 37, 5, 0, 0, 248, 0, 2, 0, 37, 5, 0, 0, 250, 0, 4, 0, 38, 5, 0, 0, 34, 5, 0, 0, 35, 5, 0, 0, 248, 0, 2, 0, 34, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 39, 5, 0, 0, 28, 5, 0, 0, 177, 0, 5, 0, 18, 0, 0, 0, 40, 5, 0, 0, 39, 5, 0, 0, 92, 0, 0, 0, 247, 0, 3, 0, 42, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 40, 5, 0, 0, 41, 5, 0, 0, 42, 5, 0, 0, 248, 0, 2, 0, 41, 5, 0, 0, 249, 0, 2, 0, 35, 5, 0, 0, 248, 0, 2, 0, 42, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 45, 5, 0, 0, 249, 4, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 46, 5, 0, 0, 28, 5, 0, 0, 128, 0, 5, 0, 64, 0, 0, 0, 227, 7, 0, 0, 45, 5, 0, 0, 46, 5, 0, 0, 195, 0, 5, 0, 64, 0, 0, 0, 228, 7, 0, 0, 46, 5, 0, 0, 68, 0, 0, 0, 128, 0, 5, 0, 64, 0, 0, 0, 229, 7, 0, 0, 45, 5, 0, 0, 228, 7, 0, 0, 169, 0, 6, 0, 64, 0, 0, 0, 47, 5, 0, 0, 219, 7, 0, 0, 229, 7, 0, 0, 227, 7, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 48, 5, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 47, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 230, 7, 0, 0, 48, 5, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 231, 7, 0, 0, 230, 7, 0, 0, 199, 0, 5, 0, 64, 0, 0, 0, 232, 7, 0, 0, 46, 5, 0, 0, 68, 0, 0, 0, 196, 0, 5, 0, 64, 0, 0, 0, 233, 7, 0, 0, 232, 7, 0, 0, 62, 1, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 234, 7, 0, 0, 231, 7, 0, 0, 233, 7, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 235, 7, 0, 0, 234, 7, 0, 0, 215, 7, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 236, 7, 0, 0, 235, 7, 0, 0, 216, 7, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 237, 7, 0, 0, 235, 7, 0, 0, 217, 7, 0, 0, 171, 0, 5, 0, 18, 0, 0, 0, 238, 7, 0, 0, 237, 7, 0, 0, 109, 0, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 239, 7, 0, 0, 236, 7, 0, 0, 216, 7, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 240, 7, 0, 0, 236, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 241, 7, 0, 0, 240, 7, 0, 0, 218, 7, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 242, 7, 0, 0, 226, 7, 0, 0, 241, 7, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 243, 7, 0, 0, 242, 7, 0, 0, 58, 5, 0, 0, 127, 0, 4, 0, 6, 0, 0, 0, 244, 7, 0, 0, 243, 7, 0, 0, 169, 0, 6, 0, 6, 0, 0, 0, 245, 7, 0, 0, 238, 7, 0, 0, 244, 7, 0, 0, 243, 7, 0, 0, 169, 0, 6, 0, 6, 0, 0, 0, 246, 7, 0, 0, 239, 7, 0, 0, 86, 2, 0, 0, 245, 7, 0, 0, 169, 0, 6, 0, 6, 0, 0, 0, 49, 5, 0, 0, 219, 7, 0, 0, 246, 7, 0, 0, 230, 7, 0, 0, 62, 0, 3, 0, 44, 5, 0, 0, 49, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 50, 5, 0, 0, 44, 5, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 51, 5, 0, 0, 50, 5, 0, 0, 80, 1, 0, 0, 247, 0, 3, 0, 53, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 51, 5, 0, 0, 52, 5, 0, 0, 66, 5, 0, 0, 248, 0, 2, 0, 52, 5, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 54, 5, 0, 0, 200, 4, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 55, 5, 0, 0, 54, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 56, 5, 0, 0, 44, 5, 0, 0, 127, 0, 4, 0, 6, 0, 0, 0, 57, 5, 0, 0, 56, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 59, 5, 0, 0, 57, 5, 0, 0, 58, 5, 0, 0, 188, 0, 5, 0, 18, 0, 0, 0, 60, 5, 0, 0, 55, 5, 0, 0, 59, 5, 0, 0, 247, 0, 3, 0, 62, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 60, 5, 0, 0, 61, 5, 0, 0, 62, 5, 0, 0, 248, 0, 2, 0, 61, 5, 0, 0, 249, 0, 2, 0, 35, 5, 0, 0, 248, 0, 2, 0, 62, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 64, 5, 0, 0, 32, 5, 0, 0, 130, 0, 5, 0, 64, 0, 0, 0, 65, 5, 0, 0, 64, 5, 0, 0, 68, 0, 0, 0, 62, 0, 3, 0, 32, 5, 0, 0, 65, 5, 0, 0, 249, 0, 2, 0, 53, 5, 0, 0, 248, 0, 2, 0, 66, 5, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 67, 5, 0, 0, 200, 4, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 68, 5, 0, 0, 67, 5, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 69, 5, 0, 0, 44, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 70, 5, 0, 0, 69, 5, 0, 0, 58, 5, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 71, 5, 0, 0, 68, 5, 0, 0, 70, 5, 0, 0, 247, 0, 3, 0, 73, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 71, 5, 0, 0, 72, 5, 0, 0, 73, 5, 0, 0, 248, 0, 2, 0, 72, 5, 0, 0, 249, 0, 2, 0, 35, 5, 0, 0, 248, 0, 2, 0, 73, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 75, 5, 0, 0, 32, 5, 0, 0, 128, 0, 5, 0, 64, 0, 0, 0, 76, 5, 0, 0, 75, 5, 0, 0, 68, 0, 0, 0, 62, 0, 3, 0, 32, 5, 0, 0, 76, 5, 0, 0, 249, 0, 2, 0, 53, 5, 0, 0, 248, 0, 2, 0, 53, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 77, 5, 0, 0, 28, 5, 0, 0, 130, 0, 5, 0, 64, 0, 0, 0, 78, 5, 0, 0, 77, 5, 0, 0, 68, 0, 0, 0, 62, 0, 3, 0, 28, 5, 0, 0, 78, 5, 0, 0, 249, 0, 2, 0, 36, 5, 0, 0, 248, 0, 2, 0, 36, 5, 0, 0, 249, 0, 2, 0, 33, 5, 0, 0, 248, 0, 2, 0, 35, 5, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 79, 5, 0, 0, 32, 5, 0, 0, 179, 0, 5, 0, 18, 0, 0, 0, 80, 5, 0, 0, 79, 5, 0, 0, 92, 0, 0, 0, 247, 0, 3, 0, 82, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 80, 5, 0, 0, 81, 5, 0, 0, 84, 5, 0, 0, 248, 0, 2, 0, 81, 5, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 84, 5, 0, 0, 57, 0, 4, 0, 8, 0, 0, 0, 87, 5, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 86, 5, 0, 0, 87, 5, 0, 0, 249, 0, 2, 0, 82, 5, 0, 0, 248, 0, 2, 0, 82, 5, 0, 0, 249, 0, 2, 0, 248, 4, 0, 0, 248, 0, 2, 0, 88, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 192, 6, 0, 0, 159, 6, 0, 0, 62, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 253, 7, 0, 0, 192, 6, 0, 0, 169, 0, 6, 0, 57, 0, 0, 0, 90, 5, 0, 0, 249, 7, 0, 0, 253, 7, 0, 0, 248, 7, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 92, 5, 0, 0, 90, 5, 0, 0, 91, 5, 0, 0, 247, 0, 3, 0, 94, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 92, 5, 0, 0, 93, 5, 0, 0, 115, 5, 0, 0, 248, 0, 2, 0, 93, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 193, 6, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 194, 6, 0, 0, 193, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 97, 5, 0, 0, 194, 6, 0, 0, 62, 0, 3, 0, 95, 5, 0, 0, 97, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 195, 6, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 196, 6, 0, 0, 195, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 100, 5, 0, 0, 196, 6, 0, 0, 62, 0, 3, 0, 98, 5, 0, 0, 100, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 197, 6, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 198, 6, 0, 0, 197, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 103, 5, 0, 0, 198, 6, 0, 0, 62, 0, 3, 0, 101, 5, 0, 0, 103, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 199, 6, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 200, 6, 0, 0, 199, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 106, 5, 0, 0, 200, 6, 0, 0, 62, 0, 3, 0, 104, 5, 0, 0, 106, 5, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 108, 5, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 107, 5, 0, 0, 108, 5, 0, 0, 57, 0, 9, 0, 18, 0, 0, 0, 109, 5, 0, 0, 38, 0, 0, 0, 95, 5, 0, 0, 98, 5, 0, 0, 101, 5, 0, 0, 104, 5, 0, 0, 107, 5, 0, 0, 247, 0, 3, 0, 111, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 109, 5, 0, 0, 110, 5, 0, 0, 113, 5, 0, 0, 248, 0, 2, 0, 110, 5, 0, 0, 57, 0, 4, 0, 8, 0, 0, 0, 112, 5, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 86, 5, 0, 0, 112, 5, 0, 0, 249, 0, 2, 0, 111, 5, 0, 0, 248, 0, 2, 0, 113, 5, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 111, 5, 0, 0, 249, 0, 2, 0, 94, 5, 0, 0, 248, 0, 2, 0, 115, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 201, 6, 0, 0, 159, 6, 0, 0, 62, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 254, 7, 0, 0, 201, 6, 0, 0, 169, 0, 6, 0, 57, 0, 0, 0, 117, 5, 0, 0, 249, 7, 0, 0, 254, 7, 0, 0, 248, 7, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 118, 5, 0, 0, 117, 5, 0, 0, 101, 0, 0, 0, 247, 0, 3, 0, 120, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 118, 5, 0, 0, 119, 5, 0, 0, 181, 5, 0, 0, 248, 0, 2, 0, 119, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 202, 6, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 203, 6, 0, 0, 202, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 124, 5, 0, 0, 203, 6, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 125, 5, 0, 0, 122, 5, 0, 0, 124, 5, 0, 0, 62, 0, 3, 0, 121, 5, 0, 0, 125, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 204, 6, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 205, 6, 0, 0, 204, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 127, 5, 0, 0, 205, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 128, 5, 0, 0, 121, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 129, 5, 0, 0, 127, 5, 0, 0, 128, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 206, 6, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 207, 6, 0, 0, 206, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 131, 5, 0, 0, 207, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 132, 5, 0, 0, 121, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 133, 5, 0, 0, 131, 5, 0, 0, 132, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 208, 6, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 209, 6, 0, 0, 208, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 135, 5, 0, 0, 209, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 136, 5, 0, 0, 121, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 137, 5, 0, 0, 135, 5, 0, 0, 136, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 210, 6, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 211, 6, 0, 0, 210, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 139, 5, 0, 0, 211, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 140, 5, 0, 0, 121, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 141, 5, 0, 0, 139, 5, 0, 0, 140, 5, 0, 0, 62, 0, 3, 0, 142, 5, 0, 0, 129, 5, 0, 0, 62, 0, 3, 0, 143, 5, 0, 0, 133, 5, 0, 0, 62, 0, 3, 0, 144, 5, 0, 0, 137, 5, 0, 0, 62, 0, 3, 0, 145, 5, 0, 0, 141, 5, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 147, 5, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 146, 5, 0, 0, 147, 5, 0, 0, 57, 0, 9, 0, 18, 0, 0, 0, 148, 5, 0, 0, 38, 0, 0, 0, 142, 5, 0, 0, 143, 5, 0, 0, 144, 5, 0, 0, 145, 5, 0, 0, 146, 5, 0, 0, 247, 0, 3, 0, 150, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 148, 5, 0, 0, 149, 5, 0, 0, 150, 5, 0, 0, 248, 0, 2, 0, 149, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 212, 6, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 213, 6, 0, 0, 212, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 152, 5, 0, 0, 213, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 153, 5, 0, 0, 121, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 154, 5, 0, 0, 152, 5, 0, 0, 153, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 214, 6, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 215, 6, 0, 0, 214, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 156, 5, 0, 0, 215, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 157, 5, 0, 0, 121, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 158, 5, 0, 0, 156, 5, 0, 0, 157, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 216, 6, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 217, 6, 0, 0, 216, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 160, 5, 0, 0, 217, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 161, 5, 0, 0, 121, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 162, 5, 0, 0, 160, 5, 0, 0, 161, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 218, 6, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 219, 6, 0, 0, 218, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 164, 5, 0, 0, 219, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 165, 5, 0, 0, 121, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 166, 5, 0, 0, 164, 5, 0, 0, 165, 5, 0, 0, 62, 0, 3, 0, 167, 5, 0, 0, 154, 5, 0, 0, 62, 0, 3, 0, 168, 5, 0, 0, 158, 5, 0, 0, 62, 0, 3, 0, 169, 5, 0, 0, 162, 5, 0, 0, 62, 0, 3, 0, 170, 5, 0, 0, 166, 5, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 172, 5, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 171, 5, 0, 0, 172, 5, 0, 0, 57, 0, 9, 0, 18, 0, 0, 0, 173, 5, 0, 0, 38, 0, 0, 0, 167, 5, 0, 0, 168, 5, 0, 0, 169, 5, 0, 0, 170, 5, 0, 0, 171, 5, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 174, 5, 0, 0, 173, 5, 0, 0, 249, 0, 2, 0, 150, 5, 0, 0, 248, 0, 2, 0, 150, 5, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 175, 5, 0, 0, 148, 5, 0, 0, 119, 5, 0, 0, 174, 5, 0, 0, 149, 5, 0, 0, 247, 0, 3, 0, 177, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 175, 5, 0, 0, 176, 5, 0, 0, 179, 5, 0, 0, 248, 0, 2, 0, 176, 5, 0, 0, 57, 0, 4, 0, 8, 0, 0, 0, 178, 5, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 86, 5, 0, 0, 178, 5, 0, 0, 249, 0, 2, 0, 177, 5, 0, 0, 248, 0, 2, 0, 179, 5, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 177, 5, 0, 0, 249, 0, 2, 0, 120, 5, 0, 0, 248, 0, 2, 0, 181, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 220, 6, 0, 0, 159, 6, 0, 0, 62, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 255, 7, 0, 0, 220, 6, 0, 0, 169, 0, 6, 0, 57, 0, 0, 0, 183, 5, 0, 0, 249, 7, 0, 0, 255, 7, 0, 0, 248, 7, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 185, 5, 0, 0, 183, 5, 0, 0, 184, 5, 0, 0, 247, 0, 3, 0, 187, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 185, 5, 0, 0, 186, 5, 0, 0, 214, 5, 0, 0, 248, 0, 2, 0, 186, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 221, 6, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 222, 6, 0, 0, 221, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 190, 5, 0, 0, 222, 6, 0, 0, 62, 0, 3, 0, 188, 5, 0, 0, 190, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 223, 6, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 224, 6, 0, 0, 223, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 193, 5, 0, 0, 224, 6, 0, 0, 62, 0, 3, 0, 191, 5, 0, 0, 193, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 225, 6, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 226, 6, 0, 0, 225, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 196, 5, 0, 0, 226, 6, 0, 0, 62, 0, 3, 0, 194, 5, 0, 0, 196, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 227, 6, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 228, 6, 0, 0, 227, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 199, 5, 0, 0, 228, 6, 0, 0, 62, 0, 3, 0, 197, 5, 0, 0, 199, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 229, 6, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 230, 6, 0, 0, 229, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 202, 5, 0, 0, 230, 6, 0, 0, 62, 0, 3, 0, 200, 5, 0, 0, 202, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 231, 6, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 232, 6, 0, 0, 231, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 205, 5, 0, 0, 232, 6, 0, 0, 62, 0, 3, 0, 203, 5, 0, 0, 205, 5, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 207, 5, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 206, 5, 0, 0, 207, 5, 0, 0, 57, 0, 11, 0, 18, 0, 0, 0, 208, 5, 0, 0, 55, 0, 0, 0, 188, 5, 0, 0, 191, 5, 0, 0, 194, 5, 0, 0, 197, 5, 0, 0, 200, 5, 0, 0, 203, 5, 0, 0, 206, 5, 0, 0, 247, 0, 3, 0, 210, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 208, 5, 0, 0, 209, 5, 0, 0, 212, 5, 0, 0, 248, 0, 2, 0, 209, 5, 0, 0, 57, 0, 4, 0, 8, 0, 0, 0, 211, 5, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 86, 5, 0, 0, 211, 5, 0, 0, 249, 0, 2, 0, 210, 5, 0, 0, 248, 0, 2, 0, 212, 5, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 210, 5, 0, 0, 249, 0, 2, 0, 187, 5, 0, 0, 248, 0, 2, 0, 214, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 233, 6, 0, 0, 159, 6, 0, 0, 62, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 0, 8, 0, 0, 233, 6, 0, 0, 169, 0, 6, 0, 57, 0, 0, 0, 216, 5, 0, 0, 249, 7, 0, 0, 0, 8, 0, 0, 248, 7, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 218, 5, 0, 0, 216, 5, 0, 0, 217, 5, 0, 0, 247, 0, 3, 0, 220, 5, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 218, 5, 0, 0, 219, 5, 0, 0, 46, 6, 0, 0, 248, 0, 2, 0, 219, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 234, 6, 0, 0, 159, 6, 0, 0, 62, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 235, 6, 0, 0, 234, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 223, 5, 0, 0, 235, 6, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 224, 5, 0, 0, 122, 5, 0, 0, 223, 5, 0, 0, 62, 0, 3, 0, 221, 5, 0, 0, 224, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 236, 6, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 237, 6, 0, 0, 236, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 226, 5, 0, 0, 237, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 227, 5, 0, 0, 221, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 228, 5, 0, 0, 226, 5, 0, 0, 227, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 238, 6, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 239, 6, 0, 0, 238, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 230, 5, 0, 0, 239, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 231, 5, 0, 0, 221, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 232, 5, 0, 0, 230, 5, 0, 0, 231, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 240, 6, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 241, 6, 0, 0, 240, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 234, 5, 0, 0, 241, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 235, 5, 0, 0, 221, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 236, 5, 0, 0, 234, 5, 0, 0, 235, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 242, 6, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 243, 6, 0, 0, 242, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 238, 5, 0, 0, 243, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 239, 5, 0, 0, 221, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 240, 5, 0, 0, 238, 5, 0, 0, 239, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 244, 6, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 245, 6, 0, 0, 244, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 242, 5, 0, 0, 245, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 243, 5, 0, 0, 221, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 244, 5, 0, 0, 242, 5, 0, 0, 243, 5, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 246, 6, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 247, 6, 0, 0, 246, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 246, 5, 0, 0, 247, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 247, 5, 0, 0, 221, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 248, 5, 0, 0, 246, 5, 0, 0, 247, 5, 0, 0, 62, 0, 3, 0, 249, 5, 0, 0, 228, 5, 0, 0, 62, 0, 3, 0, 250, 5, 0, 0, 232, 5, 0, 0, 62, 0, 3, 0, 251, 5, 0, 0, 236, 5, 0, 0, 62, 0, 3, 0, 252, 5, 0, 0, 240, 5, 0, 0, 62, 0, 3, 0, 253, 5, 0, 0, 244, 5, 0, 0, 62, 0, 3, 0, 254, 5, 0, 0, 248, 5, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 0, 6, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 255, 5, 0, 0, 0, 6, 0, 0, 57, 0, 11, 0, 18, 0, 0, 0, 1, 6, 0, 0, 55, 0, 0, 0, 249, 5, 0, 0, 250, 5, 0, 0, 251, 5, 0, 0, 252, 5, 0, 0, 253, 5, 0, 0, 254, 5, 0, 0, 255, 5, 0, 0, 247, 0, 3, 0, 3, 6, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 1, 6, 0, 0, 2, 6, 0, 0, 3, 6, 0, 0, 248, 0, 2, 0, 2, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 248, 6, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 249, 6, 0, 0, 248, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 5, 6, 0, 0, 249, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 6, 6, 0, 0, 221, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 7, 6, 0, 0, 5, 6, 0, 0, 6, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 250, 6, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 251, 6, 0, 0, 250, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 9, 6, 0, 0, 251, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 10, 6, 0, 0, 221, 5, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 11, 6, 0, 0, 9, 6, 0, 0, 10, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 252, 6, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 253, 6, 0, 0, 252, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 13, 6, 0, 0, 253, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 14, 6, 0, 0, 221, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 15, 6, 0, 0, 13, 6, 0, 0, 14, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 254, 6, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 255, 6, 0, 0, 254, 6, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 17, 6, 0, 0, 255, 6, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 18, 6, 0, 0, 221, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 19, 6, 0, 0, 17, 6, 0, 0, 18, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 0, 7, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 1, 7, 0, 0, 0, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 21, 6, 0, 0, 1, 7, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 22, 6, 0, 0, 221, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 23, 6, 0, 0, 21, 6, 0, 0, 22, 6, 0, 0, 12, 0, 7, 0, 6, 0, 0, 0, 24, 6, 0, 0, 1, 0, 0, 0, 40, 0, 0, 0, 80, 1, 0, 0, 23, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 2, 7, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 3, 7, 0, 0, 2, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 26, 6, 0, 0, 3, 7, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 27, 6, 0, 0, 221, 5, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 28, 6, 0, 0, 26, 6, 0, 0, 27, 6, 0, 0, 12, 0, 7, 0, 6, 0, 0, 0, 29, 6, 0, 0, 1, 0, 0, 0, 40, 0, 0, 0, 80, 1, 0, 0, 28, 6, 0, 0, 62, 0, 3, 0, 30, 6, 0, 0, 7, 6, 0, 0, 62, 0, 3, 0, 31, 6, 0, 0, 11, 6, 0, 0, 62, 0, 3, 0, 32, 6, 0, 0, 15, 6, 0, 0, 62, 0, 3, 0, 33, 6, 0, 0, 19, 6, 0, 0, 62, 0, 3, 0, 34, 6, 0, 0, 24, 6, 0, 0, 62, 0, 3, 0, 35, 6, 0, 0, 29, 6, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 37, 6, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 36, 6, 0, 0, 37, 6, 0, 0, 57, 0, 11, 0, 18, 0, 0, 0, 38, 6, 0, 0, 55, 0, 0, 0, 30, 6, 0, 0, 31, 6, 0, 0, 32, 6, 0, 0, 33, 6, 0, 0, 34, 6, 0, 0, 35, 6, 0, 0, 36, 6, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 39, 6, 0, 0, 38, 6, 0, 0, 249, 0, 2, 0, 3, 6, 0, 0, 248, 0, 2, 0, 3, 6, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 40, 6, 0, 0, 1, 6, 0, 0, 219, 5, 0, 0, 39, 6, 0, 0, 2, 6, 0, 0, 247, 0, 3, 0, 42, 6, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 40, 6, 0, 0, 41, 6, 0, 0, 44, 6, 0, 0, 248, 0, 2, 0, 41, 6, 0, 0, 57, 0, 4, 0, 8, 0, 0, 0, 43, 6, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 86, 5, 0, 0, 43, 6, 0, 0, 249, 0, 2, 0, 42, 6, 0, 0, 248, 0, 2, 0, 44, 6, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 42, 6, 0, 0, 249, 0, 2, 0, 220, 5, 0, 0, 248, 0, 2, 0, 46, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 4, 7, 0, 0, 159, 6, 0, 0, 62, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 1, 8, 0, 0, 4, 7, 0, 0, 169, 0, 6, 0, 57, 0, 0, 0, 48, 6, 0, 0, 249, 7, 0, 0, 1, 8, 0, 0, 248, 7, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 50, 6, 0, 0, 48, 6, 0, 0, 49, 6, 0, 0, 247, 0, 3, 0, 52, 6, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 50, 6, 0, 0, 51, 6, 0, 0, 73, 6, 0, 0, 248, 0, 2, 0, 51, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 5, 7, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 6, 7, 0, 0, 5, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 54, 6, 0, 0, 6, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 7, 7, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 8, 7, 0, 0, 7, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 56, 6, 0, 0, 8, 7, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 57, 6, 0, 0, 54, 6, 0, 0, 56, 6, 0, 0, 62, 0, 3, 0, 58, 6, 0, 0, 57, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 9, 7, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 10, 7, 0, 0, 9, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 61, 6, 0, 0, 10, 7, 0, 0, 62, 0, 3, 0, 59, 6, 0, 0, 61, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 11, 7, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 12, 7, 0, 0, 11, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 64, 6, 0, 0, 12, 7, 0, 0, 62, 0, 3, 0, 62, 6, 0, 0, 64, 6, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 66, 6, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 65, 6, 0, 0, 66, 6, 0, 0, 57, 0, 8, 0, 18, 0, 0, 0, 67, 6, 0, 0, 45, 0, 0, 0, 58, 6, 0, 0, 59, 6, 0, 0, 62, 6, 0, 0, 65, 6, 0, 0, 247, 0, 3, 0, 69, 6, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 67, 6, 0, 0, 68, 6, 0, 0, 71, 6, 0, 0, 248, 0, 2, 0, 68, 6, 0, 0, 57, 0, 4, 0, 8, 0, 0, 0, 70, 6, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 86, 5, 0, 0, 70, 6, 0, 0, 249, 0, 2, 0, 69, 6, 0, 0, 248, 0, 2, 0, 71, 6, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 69, 6, 0, 0, 249, 0, 2, 0, 52, 6, 0, 0, 248, 0, 2, 0, 73, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 13, 7, 0, 0, 159, 6, 0, 0, 62, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 2, 8, 0, 0, 13, 7, 0, 0, 169, 0, 6, 0, 57, 0, 0, 0, 75, 6, 0, 0, 249, 7, 0, 0, 2, 8, 0, 0, 248, 7, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 76, 6, 0, 0, 75, 6, 0, 0, 62, 0, 0, 0, 247, 0, 3, 0, 78, 6, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 76, 6, 0, 0, 77, 6, 0, 0, 130, 6, 0, 0, 248, 0, 2, 0, 77, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 14, 7, 0, 0, 159, 6, 0, 0, 62, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 15, 7, 0, 0, 14, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 81, 6, 0, 0, 15, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 82, 6, 0, 0, 122, 5, 0, 0, 81, 6, 0, 0, 62, 0, 3, 0, 79, 6, 0, 0, 82, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 16, 7, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 17, 7, 0, 0, 16, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 84, 6, 0, 0, 17, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 18, 7, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 19, 7, 0, 0, 18, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 86, 6, 0, 0, 19, 7, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 87, 6, 0, 0, 84, 6, 0, 0, 86, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 20, 7, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 21, 7, 0, 0, 20, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 89, 6, 0, 0, 21, 7, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 90, 6, 0, 0, 79, 6, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 91, 6, 0, 0, 89, 6, 0, 0, 90, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 22, 7, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 23, 7, 0, 0, 22, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 93, 6, 0, 0, 23, 7, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 94, 6, 0, 0, 79, 6, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 95, 6, 0, 0, 93, 6, 0, 0, 94, 6, 0, 0, 62, 0, 3, 0, 96, 6, 0, 0, 87, 6, 0, 0, 62, 0, 3, 0, 97, 6, 0, 0, 91, 6, 0, 0, 62, 0, 3, 0, 98, 6, 0, 0, 95, 6, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 100, 6, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 99, 6, 0, 0, 100, 6, 0, 0, 57, 0, 8, 0, 18, 0, 0, 0, 101, 6, 0, 0, 45, 0, 0, 0, 96, 6, 0, 0, 97, 6, 0, 0, 98, 6, 0, 0, 99, 6, 0, 0, 247, 0, 3, 0, 103, 6, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 101, 6, 0, 0, 102, 6, 0, 0, 103, 6, 0, 0, 248, 0, 2, 0, 102, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 24, 7, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 25, 7, 0, 0, 24, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 105, 6, 0, 0, 25, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 26, 7, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 27, 7, 0, 0, 26, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 107, 6, 0, 0, 27, 7, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 108, 6, 0, 0, 105, 6, 0, 0, 107, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 28, 7, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 29, 7, 0, 0, 28, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 110, 6, 0, 0, 29, 7, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 111, 6, 0, 0, 79, 6, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 112, 6, 0, 0, 110, 6, 0, 0, 111, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 30, 7, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 31, 7, 0, 0, 30, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 114, 6, 0, 0, 31, 7, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 115, 6, 0, 0, 79, 6, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 116, 6, 0, 0, 114, 6, 0, 0, 115, 6, 0, 0, 62, 0, 3, 0, 117, 6, 0, 0, 108, 6, 0, 0, 62, 0, 3, 0, 118, 6, 0, 0, 112, 6, 0, 0, 62, 0, 3, 0, 119, 6, 0, 0, 116, 6, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 121, 6, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 120, 6, 0, 0, 121, 6, 0, 0, 57, 0, 8, 0, 18, 0, 0, 0, 122, 6, 0, 0, 45, 0, 0, 0, 117, 6, 0, 0, 118, 6, 0, 0, 119, 6, 0, 0, 120, 6, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 123, 6, 0, 0, 122, 6, 0, 0, 249, 0, 2, 0, 103, 6, 0, 0, 248, 0, 2, 0, 103, 6, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 124, 6, 0, 0, 101, 6, 0, 0, 77, 6, 0, 0, 123, 6, 0, 0, 102, 6, 0, 0, 247, 0, 3, 0, 126, 6, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 124, 6, 0, 0, 125, 6, 0, 0, 128, 6, 0, 0, 248, 0, 2, 0, 125, 6, 0, 0, 57, 0, 4, 0, 8, 0, 0, 0, 127, 6, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 86, 5, 0, 0, 127, 6, 0, 0, 249, 0, 2, 0, 126, 6, 0, 0, 248, 0, 2, 0, 128, 6, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 126, 6, 0, 0, 249, 0, 2, 0, 78, 6, 0, 0, 248, 0, 2, 0, 130, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 32, 7, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 33, 7, 0, 0, 32, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 132, 6, 0, 0, 33, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 34, 7, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 35, 7, 0, 0, 34, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 134, 6, 0, 0, 35, 7, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 135, 6, 0, 0, 132, 6, 0, 0, 134, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 36, 7, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 37, 7, 0, 0, 36, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 137, 6, 0, 0, 37, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 38, 7, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 39, 7, 0, 0, 38, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 139, 6, 0, 0, 39, 7, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 140, 6, 0, 0, 137, 6, 0, 0, 139, 6, 0, 0, 62, 0, 3, 0, 141, 6, 0, 0, 135, 6, 0, 0, 62, 0, 3, 0, 142, 6, 0, 0, 140, 6, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 40, 7, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 41, 7, 0, 0, 40, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 145, 6, 0, 0, 41, 7, 0, 0, 62, 0, 3, 0, 143, 6, 0, 0, 145, 6, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 147, 6, 0, 0, 200, 4, 0, 0, 62, 0, 3, 0, 146, 6, 0, 0, 147, 6, 0, 0, 57, 0, 8, 0, 18, 0, 0, 0, 148, 6, 0, 0, 30, 0, 0, 0, 141, 6, 0, 0, 142, 6, 0, 0, 143, 6, 0, 0, 146, 6, 0, 0, 247, 0, 3, 0, 150, 6, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 148, 6, 0, 0, 149, 6, 0, 0, 152, 6, 0, 0, 248, 0, 2, 0, 149, 6, 0, 0, 57, 0, 4, 0, 8, 0, 0, 0, 151, 6, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 86, 5, 0, 0, 151, 6, 0, 0, 249, 0, 2, 0, 150, 6, 0, 0, 248, 0, 2, 0, 152, 6, 0, 0, 252, 0, 1, 0, 248, 0, 2, 0, 150, 6, 0, 0, 249, 0, 2, 0, 78, 6, 0, 0, 248, 0, 2, 0, 78, 6, 0, 0, 249, 0, 2, 0, 52, 6, 0, 0, 248, 0, 2, 0, 52, 6, 0, 0, 249, 0, 2, 0, 220, 5, 0, 0, 248, 0, 2, 0, 220, 5, 0, 0, 249, 0, 2, 0, 187, 5, 0, 0, 248, 0, 2, 0, 187, 5, 0, 0, 249, 0, 2, 0, 120, 5, 0, 0, 248, 0, 2, 0, 120, 5, 0, 0, 249, 0, 2, 0, 94, 5, 0, 0, 248, 0, 2, 0, 94, 5, 0, 0, 249, 0, 2, 0, 248, 4, 0, 0, 248, 0, 2, 0, 248, 4, 0, 0, 253, 0, 1, 0, 56, 0, 1, 0, 54, 0, 5, 0, 8, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 10, 0, 0, 0, 248, 0, 2, 0, 12, 0, 0, 0, 59, 0, 4, 0, 58, 0, 0, 0, 59, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 58, 0, 0, 0, 72, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 58, 0, 0, 0, 119, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 161, 0, 0, 0, 162, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 161, 0, 0, 0, 195, 0, 0, 0, 7, 0, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 42, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 71, 0, 0, 0, 42, 7, 0, 0, 62, 0, 3, 0, 59, 0, 0, 0, 71, 0, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 43, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 74, 0, 0, 0, 43, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 44, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 77, 0, 0, 0, 44, 7, 0, 0, 196, 0, 5, 0, 57, 0, 0, 0, 78, 0, 0, 0, 77, 0, 0, 0, 68, 0, 0, 0, 128, 0, 5, 0, 57, 0, 0, 0, 79, 0, 0, 0, 74, 0, 0, 0, 78, 0, 0, 0, 62, 0, 3, 0, 72, 0, 0, 0, 79, 0, 0, 0, 249, 0, 2, 0, 80, 0, 0, 0, 248, 0, 2, 0, 80, 0, 0, 0, 246, 0, 4, 0, 82, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 249, 0, 2, 0, 84, 0, 0, 0, 248, 0, 2, 0, 84, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 85, 0, 0, 0, 59, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 86, 0, 0, 0, 72, 0, 0, 0, 171, 0, 5, 0, 18, 0, 0, 0, 87, 0, 0, 0, 85, 0, 0, 0, 86, 0, 0, 0, 250, 0, 4, 0, 87, 0, 0, 0, 81, 0, 0, 0, 82, 0, 0, 0, 248, 0, 2, 0, 81, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 93, 0, 0, 0, 59, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 95, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 93, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 96, 0, 0, 0, 95, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 97, 0, 0, 0, 10, 0, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 98, 0, 0, 0, 96, 0, 0, 0, 97, 0, 0, 0, 247, 0, 3, 0, 100, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 98, 0, 0, 0, 99, 0, 0, 0, 104, 0, 0, 0, 248, 0, 2, 0, 99, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 102, 0, 0, 0, 59, 0, 0, 0, 128, 0, 5, 0, 57, 0, 0, 0, 103, 0, 0, 0, 102, 0, 0, 0, 101, 0, 0, 0, 62, 0, 3, 0, 59, 0, 0, 0, 103, 0, 0, 0, 249, 0, 2, 0, 100, 0, 0, 0, 248, 0, 2, 0, 104, 0, 0, 0, 249, 0, 2, 0, 82, 0, 0, 0, 248, 0, 2, 0, 100, 0, 0, 0, 249, 0, 2, 0, 83, 0, 0, 0, 248, 0, 2, 0, 83, 0, 0, 0, 249, 0, 2, 0, 80, 0, 0, 0, 248, 0, 2, 0, 82, 0, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 45, 7, 0, 0, 159, 6, 0, 0, 239, 4, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 108, 0, 0, 0, 45, 7, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 110, 0, 0, 0, 108, 0, 0, 0, 109, 0, 0, 0, 247, 0, 3, 0, 112, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 110, 0, 0, 0, 111, 0, 0, 0, 132, 0, 0, 0, 248, 0, 2, 0, 111, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 113, 0, 0, 0, 59, 0, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 46, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 115, 0, 0, 0, 46, 7, 0, 0, 171, 0, 5, 0, 18, 0, 0, 0, 116, 0, 0, 0, 113, 0, 0, 0, 115, 0, 0, 0, 247, 0, 3, 0, 118, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 116, 0, 0, 0, 117, 0, 0, 0, 126, 0, 0, 0, 248, 0, 2, 0, 117, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 120, 0, 0, 0, 59, 0, 0, 0, 130, 0, 5, 0, 57, 0, 0, 0, 122, 0, 0, 0, 120, 0, 0, 0, 121, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 123, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 122, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 124, 0, 0, 0, 123, 0, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 125, 0, 0, 0, 124, 0, 0, 0, 62, 0, 3, 0, 119, 0, 0, 0, 125, 0, 0, 0, 249, 0, 2, 0, 118, 0, 0, 0, 248, 0, 2, 0, 126, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 127, 0, 0, 0, 59, 0, 0, 0, 128, 0, 5, 0, 57, 0, 0, 0, 128, 0, 0, 0, 127, 0, 0, 0, 121, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 129, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 128, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 130, 0, 0, 0, 129, 0, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 131, 0, 0, 0, 130, 0, 0, 0, 62, 0, 3, 0, 119, 0, 0, 0, 131, 0, 0, 0, 249, 0, 2, 0, 118, 0, 0, 0, 248, 0, 2, 0, 118, 0, 0, 0, 249, 0, 2, 0, 112, 0, 0, 0, 248, 0, 2, 0, 132, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 133, 0, 0, 0, 59, 0, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 47, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 135, 0, 0, 0, 47, 7, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 136, 0, 0, 0, 133, 0, 0, 0, 135, 0, 0, 0, 247, 0, 3, 0, 138, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 136, 0, 0, 0, 137, 0, 0, 0, 144, 0, 0, 0, 248, 0, 2, 0, 137, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 139, 0, 0, 0, 59, 0, 0, 0, 128, 0, 5, 0, 57, 0, 0, 0, 140, 0, 0, 0, 139, 0, 0, 0, 121, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 141, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 140, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 142, 0, 0, 0, 141, 0, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 143, 0, 0, 0, 142, 0, 0, 0, 62, 0, 3, 0, 119, 0, 0, 0, 143, 0, 0, 0, 249, 0, 2, 0, 138, 0, 0, 0, 248, 0, 2, 0, 144, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 145, 0, 0, 0, 59, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 146, 0, 0, 0, 72, 0, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 147, 0, 0, 0, 145, 0, 0, 0, 146, 0, 0, 0, 247, 0, 3, 0, 149, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 147, 0, 0, 0, 148, 0, 0, 0, 155, 0, 0, 0, 248, 0, 2, 0, 148, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 150, 0, 0, 0, 59, 0, 0, 0, 130, 0, 5, 0, 57, 0, 0, 0, 151, 0, 0, 0, 150, 0, 0, 0, 121, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 152, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 151, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 153, 0, 0, 0, 152, 0, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 154, 0, 0, 0, 153, 0, 0, 0, 62, 0, 3, 0, 119, 0, 0, 0, 154, 0, 0, 0, 249, 0, 2, 0, 149, 0, 0, 0, 248, 0, 2, 0, 155, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 156, 0, 0, 0, 59, 0, 0, 0, 130, 0, 5, 0, 57, 0, 0, 0, 157, 0, 0, 0, 156, 0, 0, 0, 121, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 158, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 157, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 159, 0, 0, 0, 158, 0, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 160, 0, 0, 0, 159, 0, 0, 0, 62, 0, 3, 0, 119, 0, 0, 0, 160, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 163, 0, 0, 0, 119, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 165, 0, 0, 0, 163, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 166, 0, 0, 0, 165, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 167, 0, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 169, 0, 0, 0, 167, 0, 0, 0, 168, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 170, 0, 0, 0, 169, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 171, 0, 0, 0, 170, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 172, 0, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 174, 0, 0, 0, 172, 0, 0, 0, 173, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 175, 0, 0, 0, 174, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 176, 0, 0, 0, 175, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 177, 0, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 179, 0, 0, 0, 177, 0, 0, 0, 178, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 180, 0, 0, 0, 179, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 181, 0, 0, 0, 180, 0, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 48, 7, 0, 0, 159, 6, 0, 0, 239, 4, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 49, 7, 0, 0, 48, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 185, 0, 0, 0, 49, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 186, 0, 0, 0, 181, 0, 0, 0, 185, 0, 0, 0, 80, 0, 7, 0, 8, 0, 0, 0, 187, 0, 0, 0, 166, 0, 0, 0, 171, 0, 0, 0, 176, 0, 0, 0, 186, 0, 0, 0, 142, 0, 5, 0, 8, 0, 0, 0, 189, 0, 0, 0, 187, 0, 0, 0, 188, 0, 0, 0, 62, 0, 3, 0, 162, 0, 0, 0, 189, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 190, 0, 0, 0, 59, 0, 0, 0, 128, 0, 5, 0, 57, 0, 0, 0, 191, 0, 0, 0, 190, 0, 0, 0, 121, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 192, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 191, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 193, 0, 0, 0, 192, 0, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 194, 0, 0, 0, 193, 0, 0, 0, 62, 0, 3, 0, 119, 0, 0, 0, 194, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 196, 0, 0, 0, 119, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 197, 0, 0, 0, 196, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 198, 0, 0, 0, 197, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 199, 0, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 200, 0, 0, 0, 199, 0, 0, 0, 168, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 201, 0, 0, 0, 200, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 202, 0, 0, 0, 201, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 203, 0, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 204, 0, 0, 0, 203, 0, 0, 0, 173, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 205, 0, 0, 0, 204, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 206, 0, 0, 0, 205, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 207, 0, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 208, 0, 0, 0, 207, 0, 0, 0, 178, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 209, 0, 0, 0, 208, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 210, 0, 0, 0, 209, 0, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 50, 7, 0, 0, 159, 6, 0, 0, 239, 4, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 51, 7, 0, 0, 50, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 212, 0, 0, 0, 51, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 213, 0, 0, 0, 210, 0, 0, 0, 212, 0, 0, 0, 80, 0, 7, 0, 8, 0, 0, 0, 214, 0, 0, 0, 198, 0, 0, 0, 202, 0, 0, 0, 206, 0, 0, 0, 213, 0, 0, 0, 142, 0, 5, 0, 8, 0, 0, 0, 215, 0, 0, 0, 214, 0, 0, 0, 188, 0, 0, 0, 62, 0, 3, 0, 195, 0, 0, 0, 215, 0, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 52, 7, 0, 0, 159, 6, 0, 0, 239, 4, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 217, 0, 0, 0, 52, 7, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 218, 0, 0, 0, 217, 0, 0, 0, 121, 0, 0, 0, 247, 0, 3, 0, 220, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 218, 0, 0, 0, 219, 0, 0, 0, 236, 0, 0, 0, 248, 0, 2, 0, 219, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 221, 0, 0, 0, 10, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 222, 0, 0, 0, 59, 0, 0, 0, 130, 0, 5, 0, 57, 0, 0, 0, 223, 0, 0, 0, 222, 0, 0, 0, 101, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 224, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 223, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 225, 0, 0, 0, 224, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 226, 0, 0, 0, 221, 0, 0, 0, 225, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 227, 0, 0, 0, 59, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 228, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 227, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 229, 0, 0, 0, 228, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 230, 0, 0, 0, 59, 0, 0, 0, 130, 0, 5, 0, 57, 0, 0, 0, 231, 0, 0, 0, 230, 0, 0, 0, 101, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 232, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 231, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 233, 0, 0, 0, 232, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 234, 0, 0, 0, 229, 0, 0, 0, 233, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 235, 0, 0, 0, 226, 0, 0, 0, 234, 0, 0, 0, 62, 0, 3, 0, 10, 0, 0, 0, 235, 0, 0, 0, 249, 0, 2, 0, 220, 0, 0, 0, 248, 0, 2, 0, 236, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 237, 0, 0, 0, 59, 0, 0, 0, 130, 0, 5, 0, 57, 0, 0, 0, 238, 0, 0, 0, 237, 0, 0, 0, 101, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 239, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 238, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 240, 0, 0, 0, 239, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 241, 0, 0, 0, 59, 0, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 242, 0, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 241, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 243, 0, 0, 0, 242, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 244, 0, 0, 0, 10, 0, 0, 0, 12, 0, 8, 0, 6, 0, 0, 0, 245, 0, 0, 0, 1, 0, 0, 0, 49, 0, 0, 0, 240, 0, 0, 0, 243, 0, 0, 0, 244, 0, 0, 0, 62, 0, 3, 0, 10, 0, 0, 0, 245, 0, 0, 0, 249, 0, 2, 0, 220, 0, 0, 0, 248, 0, 2, 0, 220, 0, 0, 0, 61, 0, 4, 0, 8, 0, 0, 0, 246, 0, 0, 0, 162, 0, 0, 0, 61, 0, 4, 0, 8, 0, 0, 0, 247, 0, 0, 0, 195, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 248, 0, 0, 0, 10, 0, 0, 0, 80, 0, 7, 0, 8, 0, 0, 0, 249, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 12, 0, 8, 0, 8, 0, 0, 0, 250, 0, 0, 0, 1, 0, 0, 0, 46, 0, 0, 0, 246, 0, 0, 0, 247, 0, 0, 0, 249, 0, 0, 0, 254, 0, 2, 0, 250, 0, 0, 0, 248, 0, 2, 0, 149, 0, 0, 0, 249, 0, 2, 0, 138, 0, 0, 0, 248, 0, 2, 0, 138, 0, 0, 0, 249, 0, 2, 0, 112, 0, 0, 0, 248, 0, 2, 0, 112, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 252, 0, 0, 0, 119, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 253, 0, 0, 0, 252, 0, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 254, 0, 0, 0, 253, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 255, 0, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 0, 1, 0, 0, 255, 0, 0, 0, 168, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 2, 1, 0, 0, 1, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 3, 1, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 4, 1, 0, 0, 3, 1, 0, 0, 173, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 5, 1, 0, 0, 4, 1, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 6, 1, 0, 0, 5, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 7, 1, 0, 0, 119, 0, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 8, 1, 0, 0, 7, 1, 0, 0, 178, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 9, 1, 0, 0, 8, 1, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 10, 1, 0, 0, 9, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 53, 7, 0, 0, 159, 6, 0, 0, 239, 4, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 54, 7, 0, 0, 53, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 12, 1, 0, 0, 54, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 13, 1, 0, 0, 10, 1, 0, 0, 12, 1, 0, 0, 80, 0, 7, 0, 8, 0, 0, 0, 14, 1, 0, 0, 254, 0, 0, 0, 2, 1, 0, 0, 6, 1, 0, 0, 13, 1, 0, 0, 142, 0, 5, 0, 8, 0, 0, 0, 15, 1, 0, 0, 14, 1, 0, 0, 188, 0, 0, 0, 254, 0, 2, 0, 15, 1, 0, 0, 56, 0, 1, 0, 54, 0, 5, 0, 8, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 248, 0, 2, 0, 15, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 40, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 55, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 61, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 102, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 105, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 108, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 111, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 120, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 133, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 138, 1, 0, 0, 139, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 138, 1, 0, 0, 148, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 58, 0, 0, 0, 180, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 224, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 236, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 2, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 6, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 9, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 30, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 42, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 71, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 87, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 90, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 95, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 100, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 102, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 105, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 115, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 123, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 139, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 174, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 214, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 231, 2, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 2, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 12, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 22, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 60, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 87, 3, 0, 0, 7, 0, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 55, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 3, 8, 0, 0, 55, 7, 0, 0, 169, 0, 6, 0, 57, 0, 0, 0, 19, 1, 0, 0, 251, 7, 0, 0, 3, 8, 0, 0, 250, 7, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 20, 1, 0, 0, 19, 1, 0, 0, 109, 0, 0, 0, 247, 0, 3, 0, 22, 1, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 20, 1, 0, 0, 21, 1, 0, 0, 34, 1, 0, 0, 248, 0, 2, 0, 21, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 56, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 57, 7, 0, 0, 56, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 25, 1, 0, 0, 57, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 58, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 59, 7, 0, 0, 58, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 27, 1, 0, 0, 59, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 60, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 61, 7, 0, 0, 60, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 29, 1, 0, 0, 61, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 62, 7, 0, 0, 159, 6, 0, 0, 239, 4, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 63, 7, 0, 0, 62, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 31, 1, 0, 0, 63, 7, 0, 0, 80, 0, 7, 0, 8, 0, 0, 0, 32, 1, 0, 0, 25, 1, 0, 0, 27, 1, 0, 0, 29, 1, 0, 0, 31, 1, 0, 0, 254, 0, 2, 0, 32, 1, 0, 0, 248, 0, 2, 0, 34, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 64, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 4, 8, 0, 0, 64, 7, 0, 0, 169, 0, 6, 0, 57, 0, 0, 0, 36, 1, 0, 0, 251, 7, 0, 0, 4, 8, 0, 0, 250, 7, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 197, 7, 0, 0, 36, 1, 0, 0, 121, 0, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 198, 7, 0, 0, 36, 1, 0, 0, 217, 5, 0, 0, 166, 0, 5, 0, 18, 0, 0, 0, 37, 1, 0, 0, 197, 7, 0, 0, 198, 7, 0, 0, 247, 0, 3, 0, 39, 1, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 37, 1, 0, 0, 38, 1, 0, 0, 218, 1, 0, 0, 248, 0, 2, 0, 38, 1, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 44, 1, 0, 0, 42, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 45, 1, 0, 0, 44, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 65, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 66, 7, 0, 0, 65, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 47, 1, 0, 0, 66, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 48, 1, 0, 0, 45, 1, 0, 0, 47, 1, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 49, 1, 0, 0, 42, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 50, 1, 0, 0, 49, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 67, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 68, 7, 0, 0, 67, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 52, 1, 0, 0, 68, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 53, 1, 0, 0, 50, 1, 0, 0, 52, 1, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 54, 1, 0, 0, 48, 1, 0, 0, 53, 1, 0, 0, 62, 0, 3, 0, 40, 1, 0, 0, 54, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 69, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 70, 7, 0, 0, 69, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 57, 1, 0, 0, 70, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 71, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 72, 7, 0, 0, 71, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 59, 1, 0, 0, 72, 7, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 60, 1, 0, 0, 57, 1, 0, 0, 59, 1, 0, 0, 62, 0, 3, 0, 55, 1, 0, 0, 60, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 73, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 74, 7, 0, 0, 73, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 64, 1, 0, 0, 74, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 75, 7, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 76, 7, 0, 0, 75, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 67, 1, 0, 0, 76, 7, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 68, 1, 0, 0, 64, 1, 0, 0, 67, 1, 0, 0, 62, 0, 3, 0, 61, 1, 0, 0, 68, 1, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 69, 1, 0, 0, 40, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 70, 1, 0, 0, 69, 1, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 71, 1, 0, 0, 55, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 72, 1, 0, 0, 71, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 73, 1, 0, 0, 70, 1, 0, 0, 72, 1, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 74, 1, 0, 0, 55, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 75, 1, 0, 0, 74, 1, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 76, 1, 0, 0, 40, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 77, 1, 0, 0, 76, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 78, 1, 0, 0, 75, 1, 0, 0, 77, 1, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 79, 1, 0, 0, 73, 1, 0, 0, 78, 1, 0, 0, 190, 0, 5, 0, 18, 0, 0, 0, 81, 1, 0, 0, 79, 1, 0, 0, 80, 1, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 82, 1, 0, 0, 81, 1, 0, 0, 247, 0, 3, 0, 84, 1, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 82, 1, 0, 0, 83, 1, 0, 0, 84, 1, 0, 0, 248, 0, 2, 0, 83, 1, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 85, 1, 0, 0, 61, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 86, 1, 0, 0, 85, 1, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 87, 1, 0, 0, 40, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 88, 1, 0, 0, 87, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 89, 1, 0, 0, 86, 1, 0, 0, 88, 1, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 90, 1, 0, 0, 40, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 91, 1, 0, 0, 90, 1, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 92, 1, 0, 0, 61, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 93, 1, 0, 0, 92, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 94, 1, 0, 0, 91, 1, 0, 0, 93, 1, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 95, 1, 0, 0, 89, 1, 0, 0, 94, 1, 0, 0, 190, 0, 5, 0, 18, 0, 0, 0, 96, 1, 0, 0, 95, 1, 0, 0, 80, 1, 0, 0, 249, 0, 2, 0, 84, 1, 0, 0, 248, 0, 2, 0, 84, 1, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 97, 1, 0, 0, 81, 1, 0, 0, 38, 1, 0, 0, 96, 1, 0, 0, 83, 1, 0, 0, 247, 0, 3, 0, 99, 1, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 97, 1, 0, 0, 98, 1, 0, 0, 99, 1, 0, 0, 248, 0, 2, 0, 98, 1, 0, 0, 254, 0, 2, 0, 100, 1, 0, 0, 248, 0, 2, 0, 99, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 103, 1, 0, 0, 40, 1, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 104, 1, 0, 0, 1, 0, 0, 0, 66, 0, 0, 0, 103, 1, 0, 0, 62, 0, 3, 0, 102, 1, 0, 0, 104, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 106, 1, 0, 0, 55, 1, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 107, 1, 0, 0, 1, 0, 0, 0, 66, 0, 0, 0, 106, 1, 0, 0, 62, 0, 3, 0, 105, 1, 0, 0, 107, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 109, 1, 0, 0, 61, 1, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 110, 1, 0, 0, 1, 0, 0, 0, 66, 0, 0, 0, 109, 1, 0, 0, 62, 0, 3, 0, 108, 1, 0, 0, 110, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 112, 1, 0, 0, 40, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 113, 1, 0, 0, 61, 1, 0, 0, 148, 0, 5, 0, 6, 0, 0, 0, 114, 1, 0, 0, 112, 1, 0, 0, 113, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 115, 1, 0, 0, 102, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 116, 1, 0, 0, 108, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 117, 1, 0, 0, 115, 1, 0, 0, 116, 1, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 118, 1, 0, 0, 114, 1, 0, 0, 117, 1, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 119, 1, 0, 0, 1, 0, 0, 0, 17, 0, 0, 0, 118, 1, 0, 0, 62, 0, 3, 0, 111, 1, 0, 0, 119, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 121, 1, 0, 0, 102, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 122, 1, 0, 0, 111, 1, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 123, 1, 0, 0, 1, 0, 0, 0, 13, 0, 0, 0, 122, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 124, 1, 0, 0, 121, 1, 0, 0, 123, 1, 0, 0, 62, 0, 3, 0, 120, 1, 0, 0, 124, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 125, 1, 0, 0, 40, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 126, 1, 0, 0, 55, 1, 0, 0, 148, 0, 5, 0, 6, 0, 0, 0, 127, 1, 0, 0, 125, 1, 0, 0, 126, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 128, 1, 0, 0, 102, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 129, 1, 0, 0, 105, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 130, 1, 0, 0, 128, 1, 0, 0, 129, 1, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 131, 1, 0, 0, 127, 1, 0, 0, 130, 1, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 132, 1, 0, 0, 1, 0, 0, 0, 17, 0, 0, 0, 131, 1, 0, 0, 62, 0, 3, 0, 111, 1, 0, 0, 132, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 134, 1, 0, 0, 102, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 135, 1, 0, 0, 111, 1, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 136, 1, 0, 0, 1, 0, 0, 0, 13, 0, 0, 0, 135, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 137, 1, 0, 0, 134, 1, 0, 0, 136, 1, 0, 0, 62, 0, 3, 0, 133, 1, 0, 0, 137, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 77, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 141, 1, 0, 0, 77, 7, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 142, 1, 0, 0, 141, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 143, 1, 0, 0, 120, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 144, 1, 0, 0, 142, 1, 0, 0, 143, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 145, 1, 0, 0, 105, 1, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 146, 1, 0, 0, 144, 1, 0, 0, 145, 1, 0, 0, 110, 0, 4, 0, 64, 0, 0, 0, 147, 1, 0, 0, 146, 1, 0, 0, 62, 0, 3, 0, 139, 1, 0, 0, 147, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 78, 7, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 79, 7, 0, 0, 78, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 151, 1, 0, 0, 79, 7, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 152, 1, 0, 0, 133, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 153, 1, 0, 0, 151, 1, 0, 0, 152, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 154, 1, 0, 0, 108, 1, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 155, 1, 0, 0, 153, 1, 0, 0, 154, 1, 0, 0, 110, 0, 4, 0, 64, 0, 0, 0, 156, 1, 0, 0, 155, 1, 0, 0, 62, 0, 3, 0, 148, 1, 0, 0, 156, 1, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 157, 1, 0, 0, 139, 1, 0, 0, 175, 0, 5, 0, 18, 0, 0, 0, 158, 1, 0, 0, 157, 1, 0, 0, 92, 0, 0, 0, 247, 0, 3, 0, 160, 1, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 158, 1, 0, 0, 159, 1, 0, 0, 160, 1, 0, 0, 248, 0, 2, 0, 159, 1, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 161, 1, 0, 0, 139, 1, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 162, 1, 0, 0, 161, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 80, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 164, 1, 0, 0, 80, 7, 0, 0, 176, 0, 5, 0, 18, 0, 0, 0, 165, 1, 0, 0, 162, 1, 0, 0, 164, 1, 0, 0, 249, 0, 2, 0, 160, 1, 0, 0, 248, 0, 2, 0, 160, 1, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 166, 1, 0, 0, 158, 1, 0, 0, 99, 1, 0, 0, 165, 1, 0, 0, 159, 1, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 167, 1, 0, 0, 148, 1, 0, 0, 175, 0, 5, 0, 18, 0, 0, 0, 168, 1, 0, 0, 167, 1, 0, 0, 92, 0, 0, 0, 167, 0, 5, 0, 18, 0, 0, 0, 169, 1, 0, 0, 166, 1, 0, 0, 168, 1, 0, 0, 247, 0, 3, 0, 171, 1, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 169, 1, 0, 0, 170, 1, 0, 0, 171, 1, 0, 0, 248, 0, 2, 0, 170, 1, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 172, 1, 0, 0, 148, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 81, 7, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 82, 7, 0, 0, 81, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 174, 1, 0, 0, 82, 7, 0, 0, 110, 0, 4, 0, 64, 0, 0, 0, 175, 1, 0, 0, 174, 1, 0, 0, 177, 0, 5, 0, 18, 0, 0, 0, 176, 1, 0, 0, 172, 1, 0, 0, 175, 1, 0, 0, 249, 0, 2, 0, 171, 1, 0, 0, 248, 0, 2, 0, 171, 1, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 177, 1, 0, 0, 169, 1, 0, 0, 160, 1, 0, 0, 176, 1, 0, 0, 170, 1, 0, 0, 247, 0, 3, 0, 179, 1, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 177, 1, 0, 0, 178, 1, 0, 0, 216, 1, 0, 0, 248, 0, 2, 0, 178, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 83, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 182, 1, 0, 0, 83, 7, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 183, 1, 0, 0, 148, 1, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 184, 1, 0, 0, 183, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 84, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 186, 1, 0, 0, 84, 7, 0, 0, 132, 0, 5, 0, 57, 0, 0, 0, 187, 1, 0, 0, 184, 1, 0, 0, 186, 1, 0, 0, 128, 0, 5, 0, 57, 0, 0, 0, 188, 1, 0, 0, 182, 1, 0, 0, 187, 1, 0, 0, 61, 0, 4, 0, 64, 0, 0, 0, 189, 1, 0, 0, 139, 1, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 190, 1, 0, 0, 189, 1, 0, 0, 128, 0, 5, 0, 57, 0, 0, 0, 191, 1, 0, 0, 188, 1, 0, 0, 190, 1, 0, 0, 65, 0, 6, 0, 94, 0, 0, 0, 192, 1, 0, 0, 91, 0, 0, 0, 92, 0, 0, 0, 191, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 193, 1, 0, 0, 192, 1, 0, 0, 124, 0, 4, 0, 57, 0, 0, 0, 194, 1, 0, 0, 193, 1, 0, 0, 62, 0, 3, 0, 180, 1, 0, 0, 194, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 195, 1, 0, 0, 180, 1, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 196, 1, 0, 0, 195, 1, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 197, 1, 0, 0, 196, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 198, 1, 0, 0, 180, 1, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 199, 1, 0, 0, 198, 1, 0, 0, 168, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 200, 1, 0, 0, 199, 1, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 201, 1, 0, 0, 200, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 202, 1, 0, 0, 180, 1, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 203, 1, 0, 0, 202, 1, 0, 0, 173, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 204, 1, 0, 0, 203, 1, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 205, 1, 0, 0, 204, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 206, 1, 0, 0, 180, 1, 0, 0, 194, 0, 5, 0, 57, 0, 0, 0, 207, 1, 0, 0, 206, 1, 0, 0, 178, 0, 0, 0, 199, 0, 5, 0, 57, 0, 0, 0, 208, 1, 0, 0, 207, 1, 0, 0, 164, 0, 0, 0, 112, 0, 4, 0, 6, 0, 0, 0, 209, 1, 0, 0, 208, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 85, 7, 0, 0, 159, 6, 0, 0, 239, 4, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 86, 7, 0, 0, 85, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 211, 1, 0, 0, 86, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 212, 1, 0, 0, 209, 1, 0, 0, 211, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 199, 7, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 200, 7, 0, 0, 199, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 201, 7, 0, 0, 200, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 202, 7, 0, 0, 201, 7, 0, 0, 196, 7, 0, 0, 169, 0, 6, 0, 6, 0, 0, 0, 203, 7, 0, 0, 198, 7, 0, 0, 202, 7, 0, 0, 197, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 204, 7, 0, 0, 159, 6, 0, 0, 23, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 205, 7, 0, 0, 204, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 206, 7, 0, 0, 205, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 207, 7, 0, 0, 206, 7, 0, 0, 196, 7, 0, 0, 169, 0, 6, 0, 6, 0, 0, 0, 208, 7, 0, 0, 198, 7, 0, 0, 207, 7, 0, 0, 201, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 209, 7, 0, 0, 159, 6, 0, 0, 62, 1, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 210, 7, 0, 0, 209, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 211, 7, 0, 0, 210, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 212, 7, 0, 0, 211, 7, 0, 0, 196, 7, 0, 0, 169, 0, 6, 0, 6, 0, 0, 0, 213, 7, 0, 0, 198, 7, 0, 0, 212, 7, 0, 0, 205, 1, 0, 0, 80, 0, 7, 0, 8, 0, 0, 0, 213, 1, 0, 0, 203, 7, 0, 0, 208, 7, 0, 0, 213, 7, 0, 0, 212, 1, 0, 0, 142, 0, 5, 0, 8, 0, 0, 0, 214, 1, 0, 0, 213, 1, 0, 0, 188, 0, 0, 0, 254, 0, 2, 0, 214, 1, 0, 0, 248, 0, 2, 0, 216, 1, 0, 0, 254, 0, 2, 0, 100, 1, 0, 0, 248, 0, 2, 0, 179, 1, 0, 0, 249, 0, 2, 0, 39, 1, 0, 0, 248, 0, 2, 0, 218, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 87, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 5, 8, 0, 0, 87, 7, 0, 0, 169, 0, 6, 0, 57, 0, 0, 0, 220, 1, 0, 0, 251, 7, 0, 0, 5, 8, 0, 0, 250, 7, 0, 0, 170, 0, 5, 0, 18, 0, 0, 0, 221, 1, 0, 0, 220, 1, 0, 0, 101, 0, 0, 0, 247, 0, 3, 0, 223, 1, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 221, 1, 0, 0, 222, 1, 0, 0, 5, 2, 0, 0, 248, 0, 2, 0, 222, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 88, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 89, 7, 0, 0, 88, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 226, 1, 0, 0, 89, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 90, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 91, 7, 0, 0, 90, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 228, 1, 0, 0, 91, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 229, 1, 0, 0, 226, 1, 0, 0, 228, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 92, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 93, 7, 0, 0, 92, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 231, 1, 0, 0, 93, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 94, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 95, 7, 0, 0, 94, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 233, 1, 0, 0, 95, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 234, 1, 0, 0, 231, 1, 0, 0, 233, 1, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 235, 1, 0, 0, 229, 1, 0, 0, 234, 1, 0, 0, 62, 0, 3, 0, 224, 1, 0, 0, 235, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 238, 1, 0, 0, 224, 1, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 239, 1, 0, 0, 1, 0, 0, 0, 66, 0, 0, 0, 238, 1, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 240, 1, 0, 0, 237, 1, 0, 0, 239, 1, 0, 0, 62, 0, 3, 0, 236, 1, 0, 0, 240, 1, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 241, 1, 0, 0, 42, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 242, 1, 0, 0, 241, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 96, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 97, 7, 0, 0, 96, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 244, 1, 0, 0, 97, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 245, 1, 0, 0, 242, 1, 0, 0, 244, 1, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 246, 1, 0, 0, 42, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 247, 1, 0, 0, 246, 1, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 98, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 99, 7, 0, 0, 98, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 249, 1, 0, 0, 99, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 250, 1, 0, 0, 247, 1, 0, 0, 249, 1, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 251, 1, 0, 0, 245, 1, 0, 0, 250, 1, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 252, 1, 0, 0, 224, 1, 0, 0, 148, 0, 5, 0, 6, 0, 0, 0, 253, 1, 0, 0, 251, 1, 0, 0, 252, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 254, 1, 0, 0, 236, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 255, 1, 0, 0, 253, 1, 0, 0, 254, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 0, 2, 0, 0, 236, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 1, 2, 0, 0, 255, 1, 0, 0, 0, 2, 0, 0, 62, 0, 3, 0, 2, 2, 0, 0, 1, 2, 0, 0, 57, 0, 5, 0, 8, 0, 0, 0, 3, 2, 0, 0, 11, 0, 0, 0, 2, 2, 0, 0, 254, 0, 2, 0, 3, 2, 0, 0, 248, 0, 2, 0, 5, 2, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 7, 2, 0, 0, 42, 1, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 8, 2, 0, 0, 7, 2, 0, 0, 62, 0, 3, 0, 6, 2, 0, 0, 8, 2, 0, 0, 65, 0, 5, 0, 43, 1, 0, 0, 10, 2, 0, 0, 42, 1, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 11, 2, 0, 0, 10, 2, 0, 0, 62, 0, 3, 0, 9, 2, 0, 0, 11, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 12, 2, 0, 0, 6, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 100, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 101, 7, 0, 0, 100, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 14, 2, 0, 0, 101, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 15, 2, 0, 0, 12, 2, 0, 0, 14, 2, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 16, 2, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 15, 2, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 18, 2, 0, 0, 16, 2, 0, 0, 17, 2, 0, 0, 247, 0, 3, 0, 20, 2, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 18, 2, 0, 0, 19, 2, 0, 0, 20, 2, 0, 0, 248, 0, 2, 0, 19, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 21, 2, 0, 0, 9, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 102, 7, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 103, 7, 0, 0, 102, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 23, 2, 0, 0, 103, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 24, 2, 0, 0, 21, 2, 0, 0, 23, 2, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 25, 2, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 24, 2, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 26, 2, 0, 0, 25, 2, 0, 0, 17, 2, 0, 0, 249, 0, 2, 0, 20, 2, 0, 0, 248, 0, 2, 0, 20, 2, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 27, 2, 0, 0, 18, 2, 0, 0, 5, 2, 0, 0, 26, 2, 0, 0, 19, 2, 0, 0, 247, 0, 3, 0, 29, 2, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 27, 2, 0, 0, 28, 2, 0, 0, 29, 2, 0, 0, 248, 0, 2, 0, 28, 2, 0, 0, 62, 0, 3, 0, 30, 2, 0, 0, 80, 1, 0, 0, 57, 0, 5, 0, 8, 0, 0, 0, 31, 2, 0, 0, 11, 0, 0, 0, 30, 2, 0, 0, 254, 0, 2, 0, 31, 2, 0, 0, 248, 0, 2, 0, 29, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 33, 2, 0, 0, 6, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 104, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 105, 7, 0, 0, 104, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 35, 2, 0, 0, 105, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 36, 2, 0, 0, 33, 2, 0, 0, 35, 2, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 37, 2, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 36, 2, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 39, 2, 0, 0, 37, 2, 0, 0, 38, 2, 0, 0, 247, 0, 3, 0, 41, 2, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 39, 2, 0, 0, 40, 2, 0, 0, 104, 2, 0, 0, 248, 0, 2, 0, 40, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 106, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 107, 7, 0, 0, 106, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 44, 2, 0, 0, 107, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 108, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 109, 7, 0, 0, 108, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 46, 2, 0, 0, 109, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 47, 2, 0, 0, 44, 2, 0, 0, 46, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 110, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 111, 7, 0, 0, 110, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 49, 2, 0, 0, 111, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 112, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 113, 7, 0, 0, 112, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 51, 2, 0, 0, 113, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 52, 2, 0, 0, 49, 2, 0, 0, 51, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 53, 2, 0, 0, 6, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 114, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 115, 7, 0, 0, 114, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 55, 2, 0, 0, 115, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 56, 2, 0, 0, 53, 2, 0, 0, 55, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 57, 2, 0, 0, 6, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 116, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 117, 7, 0, 0, 116, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 59, 2, 0, 0, 117, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 60, 2, 0, 0, 57, 2, 0, 0, 59, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 61, 2, 0, 0, 56, 2, 0, 0, 60, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 118, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 119, 7, 0, 0, 118, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 63, 2, 0, 0, 119, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 120, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 121, 7, 0, 0, 120, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 65, 2, 0, 0, 121, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 66, 2, 0, 0, 63, 2, 0, 0, 65, 2, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 67, 2, 0, 0, 61, 2, 0, 0, 66, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 68, 2, 0, 0, 67, 2, 0, 0, 237, 1, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 69, 2, 0, 0, 52, 2, 0, 0, 68, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 70, 2, 0, 0, 47, 2, 0, 0, 69, 2, 0, 0, 62, 0, 3, 0, 42, 2, 0, 0, 70, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 122, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 123, 7, 0, 0, 122, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 73, 2, 0, 0, 123, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 124, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 125, 7, 0, 0, 124, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 75, 2, 0, 0, 125, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 76, 2, 0, 0, 73, 2, 0, 0, 75, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 77, 2, 0, 0, 42, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 78, 2, 0, 0, 76, 2, 0, 0, 77, 2, 0, 0, 62, 0, 3, 0, 71, 2, 0, 0, 78, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 79, 2, 0, 0, 71, 2, 0, 0, 190, 0, 5, 0, 18, 0, 0, 0, 80, 2, 0, 0, 79, 2, 0, 0, 80, 1, 0, 0, 247, 0, 3, 0, 82, 2, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 80, 2, 0, 0, 81, 2, 0, 0, 85, 2, 0, 0, 248, 0, 2, 0, 81, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 83, 2, 0, 0, 71, 2, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 84, 2, 0, 0, 1, 0, 0, 0, 31, 0, 0, 0, 83, 2, 0, 0, 62, 0, 3, 0, 71, 2, 0, 0, 84, 2, 0, 0, 249, 0, 2, 0, 82, 2, 0, 0, 248, 0, 2, 0, 85, 2, 0, 0, 62, 0, 3, 0, 87, 2, 0, 0, 86, 2, 0, 0, 57, 0, 5, 0, 8, 0, 0, 0, 88, 2, 0, 0, 11, 0, 0, 0, 87, 2, 0, 0, 254, 0, 2, 0, 88, 2, 0, 0, 248, 0, 2, 0, 82, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 126, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 127, 7, 0, 0, 126, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 92, 2, 0, 0, 127, 7, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 93, 2, 0, 0, 71, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 94, 2, 0, 0, 92, 2, 0, 0, 93, 2, 0, 0, 62, 0, 3, 0, 90, 2, 0, 0, 94, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 128, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 129, 7, 0, 0, 128, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 97, 2, 0, 0, 129, 7, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 98, 2, 0, 0, 71, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 99, 2, 0, 0, 97, 2, 0, 0, 98, 2, 0, 0, 62, 0, 3, 0, 95, 2, 0, 0, 99, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 101, 2, 0, 0, 6, 2, 0, 0, 62, 0, 3, 0, 100, 2, 0, 0, 101, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 103, 2, 0, 0, 6, 2, 0, 0, 62, 0, 3, 0, 102, 2, 0, 0, 103, 2, 0, 0, 249, 0, 2, 0, 41, 2, 0, 0, 248, 0, 2, 0, 104, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 106, 2, 0, 0, 9, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 130, 7, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 131, 7, 0, 0, 130, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 108, 2, 0, 0, 131, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 109, 2, 0, 0, 106, 2, 0, 0, 108, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 110, 2, 0, 0, 6, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 132, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 133, 7, 0, 0, 132, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 112, 2, 0, 0, 133, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 113, 2, 0, 0, 110, 2, 0, 0, 112, 2, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 114, 2, 0, 0, 109, 2, 0, 0, 113, 2, 0, 0, 62, 0, 3, 0, 105, 2, 0, 0, 114, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 134, 7, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 135, 7, 0, 0, 134, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 117, 2, 0, 0, 135, 7, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 118, 2, 0, 0, 105, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 136, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 137, 7, 0, 0, 136, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 120, 2, 0, 0, 137, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 121, 2, 0, 0, 118, 2, 0, 0, 120, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 122, 2, 0, 0, 117, 2, 0, 0, 121, 2, 0, 0, 62, 0, 3, 0, 115, 2, 0, 0, 122, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 138, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 139, 7, 0, 0, 138, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 125, 2, 0, 0, 139, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 140, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 141, 7, 0, 0, 140, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 127, 2, 0, 0, 141, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 128, 2, 0, 0, 125, 2, 0, 0, 127, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 142, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 143, 7, 0, 0, 142, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 130, 2, 0, 0, 143, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 144, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 145, 7, 0, 0, 144, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 132, 2, 0, 0, 145, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 133, 2, 0, 0, 130, 2, 0, 0, 132, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 134, 2, 0, 0, 105, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 135, 2, 0, 0, 133, 2, 0, 0, 134, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 136, 2, 0, 0, 105, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 137, 2, 0, 0, 135, 2, 0, 0, 136, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 138, 2, 0, 0, 128, 2, 0, 0, 137, 2, 0, 0, 62, 0, 3, 0, 123, 2, 0, 0, 138, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 146, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 147, 7, 0, 0, 146, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 142, 2, 0, 0, 147, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 143, 2, 0, 0, 140, 2, 0, 0, 142, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 148, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 149, 7, 0, 0, 148, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 145, 2, 0, 0, 149, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 146, 2, 0, 0, 143, 2, 0, 0, 145, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 150, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 151, 7, 0, 0, 150, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 148, 2, 0, 0, 151, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 149, 2, 0, 0, 146, 2, 0, 0, 148, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 151, 2, 0, 0, 105, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 152, 2, 0, 0, 150, 2, 0, 0, 151, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 152, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 153, 7, 0, 0, 152, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 154, 2, 0, 0, 153, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 155, 2, 0, 0, 152, 2, 0, 0, 154, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 154, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 155, 7, 0, 0, 154, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 157, 2, 0, 0, 155, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 158, 2, 0, 0, 155, 2, 0, 0, 157, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 159, 2, 0, 0, 115, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 160, 2, 0, 0, 158, 2, 0, 0, 159, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 161, 2, 0, 0, 149, 2, 0, 0, 160, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 162, 2, 0, 0, 105, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 163, 2, 0, 0, 150, 2, 0, 0, 162, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 156, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 157, 7, 0, 0, 156, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 165, 2, 0, 0, 157, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 166, 2, 0, 0, 163, 2, 0, 0, 165, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 158, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 159, 7, 0, 0, 158, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 168, 2, 0, 0, 159, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 169, 2, 0, 0, 166, 2, 0, 0, 168, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 160, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 161, 7, 0, 0, 160, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 171, 2, 0, 0, 161, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 172, 2, 0, 0, 169, 2, 0, 0, 171, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 173, 2, 0, 0, 161, 2, 0, 0, 172, 2, 0, 0, 62, 0, 3, 0, 139, 2, 0, 0, 173, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 162, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 163, 7, 0, 0, 162, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 176, 2, 0, 0, 163, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 164, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 165, 7, 0, 0, 164, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 178, 2, 0, 0, 165, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 179, 2, 0, 0, 176, 2, 0, 0, 178, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 166, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 167, 7, 0, 0, 166, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 181, 2, 0, 0, 167, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 182, 2, 0, 0, 179, 2, 0, 0, 181, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 168, 7, 0, 0, 159, 6, 0, 0, 92, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 169, 7, 0, 0, 168, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 184, 2, 0, 0, 169, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 185, 2, 0, 0, 182, 2, 0, 0, 184, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 170, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 171, 7, 0, 0, 170, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 187, 2, 0, 0, 171, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 172, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 68, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 173, 7, 0, 0, 172, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 189, 2, 0, 0, 173, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 190, 2, 0, 0, 187, 2, 0, 0, 189, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 174, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 175, 7, 0, 0, 174, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 192, 2, 0, 0, 175, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 176, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 177, 7, 0, 0, 176, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 194, 2, 0, 0, 177, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 195, 2, 0, 0, 192, 2, 0, 0, 194, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 196, 2, 0, 0, 115, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 197, 2, 0, 0, 115, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 198, 2, 0, 0, 196, 2, 0, 0, 197, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 199, 2, 0, 0, 195, 2, 0, 0, 198, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 200, 2, 0, 0, 115, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 201, 2, 0, 0, 150, 2, 0, 0, 200, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 178, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 179, 7, 0, 0, 178, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 203, 2, 0, 0, 179, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 204, 2, 0, 0, 201, 2, 0, 0, 203, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 205, 2, 0, 0, 199, 2, 0, 0, 204, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 180, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 181, 7, 0, 0, 180, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 207, 2, 0, 0, 181, 7, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 182, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 183, 7, 0, 0, 182, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 209, 2, 0, 0, 183, 7, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 210, 2, 0, 0, 207, 2, 0, 0, 209, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 211, 2, 0, 0, 205, 2, 0, 0, 210, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 212, 2, 0, 0, 190, 2, 0, 0, 211, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 213, 2, 0, 0, 185, 2, 0, 0, 212, 2, 0, 0, 62, 0, 3, 0, 174, 2, 0, 0, 213, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 215, 2, 0, 0, 139, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 216, 2, 0, 0, 139, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 217, 2, 0, 0, 215, 2, 0, 0, 216, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 219, 2, 0, 0, 123, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 220, 2, 0, 0, 218, 2, 0, 0, 219, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 221, 2, 0, 0, 174, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 222, 2, 0, 0, 220, 2, 0, 0, 221, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 223, 2, 0, 0, 217, 2, 0, 0, 222, 2, 0, 0, 62, 0, 3, 0, 214, 2, 0, 0, 223, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 224, 2, 0, 0, 214, 2, 0, 0, 190, 0, 5, 0, 18, 0, 0, 0, 225, 2, 0, 0, 224, 2, 0, 0, 80, 1, 0, 0, 247, 0, 3, 0, 227, 2, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 225, 2, 0, 0, 226, 2, 0, 0, 230, 2, 0, 0, 248, 0, 2, 0, 226, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 228, 2, 0, 0, 214, 2, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 229, 2, 0, 0, 1, 0, 0, 0, 31, 0, 0, 0, 228, 2, 0, 0, 62, 0, 3, 0, 214, 2, 0, 0, 229, 2, 0, 0, 249, 0, 2, 0, 227, 2, 0, 0, 248, 0, 2, 0, 230, 2, 0, 0, 62, 0, 3, 0, 231, 2, 0, 0, 86, 2, 0, 0, 57, 0, 5, 0, 8, 0, 0, 0, 232, 2, 0, 0, 11, 0, 0, 0, 231, 2, 0, 0, 254, 0, 2, 0, 232, 2, 0, 0, 248, 0, 2, 0, 227, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 234, 2, 0, 0, 139, 2, 0, 0, 127, 0, 4, 0, 6, 0, 0, 0, 235, 2, 0, 0, 234, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 236, 2, 0, 0, 214, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 237, 2, 0, 0, 235, 2, 0, 0, 236, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 238, 2, 0, 0, 123, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 239, 2, 0, 0, 150, 2, 0, 0, 238, 2, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 240, 2, 0, 0, 237, 2, 0, 0, 239, 2, 0, 0, 62, 0, 3, 0, 100, 2, 0, 0, 240, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 241, 2, 0, 0, 139, 2, 0, 0, 127, 0, 4, 0, 6, 0, 0, 0, 242, 2, 0, 0, 241, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 243, 2, 0, 0, 214, 2, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 244, 2, 0, 0, 242, 2, 0, 0, 243, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 245, 2, 0, 0, 123, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 246, 2, 0, 0, 150, 2, 0, 0, 245, 2, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 247, 2, 0, 0, 244, 2, 0, 0, 246, 2, 0, 0, 62, 0, 3, 0, 102, 2, 0, 0, 247, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 248, 2, 0, 0, 105, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 249, 2, 0, 0, 100, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 250, 2, 0, 0, 248, 2, 0, 0, 249, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 251, 2, 0, 0, 115, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 252, 2, 0, 0, 250, 2, 0, 0, 251, 2, 0, 0, 62, 0, 3, 0, 90, 2, 0, 0, 252, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 253, 2, 0, 0, 105, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 254, 2, 0, 0, 102, 2, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 255, 2, 0, 0, 253, 2, 0, 0, 254, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 0, 3, 0, 0, 115, 2, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 1, 3, 0, 0, 255, 2, 0, 0, 0, 3, 0, 0, 62, 0, 3, 0, 95, 2, 0, 0, 1, 3, 0, 0, 249, 0, 2, 0, 41, 2, 0, 0, 248, 0, 2, 0, 41, 2, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 3, 3, 0, 0, 6, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 184, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 185, 7, 0, 0, 184, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 5, 3, 0, 0, 185, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 6, 3, 0, 0, 3, 3, 0, 0, 5, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 7, 3, 0, 0, 9, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 186, 7, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 187, 7, 0, 0, 186, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 9, 3, 0, 0, 187, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 10, 3, 0, 0, 7, 3, 0, 0, 9, 3, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 11, 3, 0, 0, 6, 3, 0, 0, 10, 3, 0, 0, 62, 0, 3, 0, 2, 3, 0, 0, 11, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 13, 3, 0, 0, 100, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 188, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 189, 7, 0, 0, 188, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 15, 3, 0, 0, 189, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 16, 3, 0, 0, 13, 3, 0, 0, 15, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 17, 3, 0, 0, 90, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 190, 7, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 191, 7, 0, 0, 190, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 19, 3, 0, 0, 191, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 20, 3, 0, 0, 17, 3, 0, 0, 19, 3, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 21, 3, 0, 0, 16, 3, 0, 0, 20, 3, 0, 0, 62, 0, 3, 0, 12, 3, 0, 0, 21, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 23, 3, 0, 0, 102, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 192, 7, 0, 0, 159, 6, 0, 0, 68, 0, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 193, 7, 0, 0, 192, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 25, 3, 0, 0, 193, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 26, 3, 0, 0, 23, 3, 0, 0, 25, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 27, 3, 0, 0, 95, 2, 0, 0, 65, 0, 6, 0, 160, 6, 0, 0, 194, 7, 0, 0, 159, 6, 0, 0, 75, 0, 0, 0, 92, 0, 0, 0, 61, 0, 4, 0, 57, 0, 0, 0, 195, 7, 0, 0, 194, 7, 0, 0, 124, 0, 4, 0, 6, 0, 0, 0, 29, 3, 0, 0, 195, 7, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 30, 3, 0, 0, 27, 3, 0, 0, 29, 3, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 31, 3, 0, 0, 26, 3, 0, 0, 30, 3, 0, 0, 62, 0, 3, 0, 22, 3, 0, 0, 31, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 32, 3, 0, 0, 12, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 33, 3, 0, 0, 22, 3, 0, 0, 148, 0, 5, 0, 6, 0, 0, 0, 34, 3, 0, 0, 32, 3, 0, 0, 33, 3, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 35, 3, 0, 0, 34, 3, 0, 0, 80, 1, 0, 0, 247, 0, 3, 0, 37, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 35, 3, 0, 0, 36, 3, 0, 0, 45, 3, 0, 0, 248, 0, 2, 0, 36, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 38, 3, 0, 0, 2, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 39, 3, 0, 0, 12, 3, 0, 0, 148, 0, 5, 0, 6, 0, 0, 0, 40, 3, 0, 0, 38, 3, 0, 0, 39, 3, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 41, 3, 0, 0, 40, 3, 0, 0, 80, 1, 0, 0, 247, 0, 3, 0, 43, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 41, 3, 0, 0, 42, 3, 0, 0, 43, 3, 0, 0, 248, 0, 2, 0, 42, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 44, 3, 0, 0, 22, 3, 0, 0, 62, 0, 3, 0, 12, 3, 0, 0, 44, 3, 0, 0, 249, 0, 2, 0, 43, 3, 0, 0, 248, 0, 2, 0, 43, 3, 0, 0, 249, 0, 2, 0, 37, 3, 0, 0, 248, 0, 2, 0, 45, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 46, 3, 0, 0, 12, 3, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 47, 3, 0, 0, 1, 0, 0, 0, 66, 0, 0, 0, 46, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 48, 3, 0, 0, 22, 3, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 49, 3, 0, 0, 1, 0, 0, 0, 66, 0, 0, 0, 48, 3, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 50, 3, 0, 0, 47, 3, 0, 0, 49, 3, 0, 0, 247, 0, 3, 0, 52, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 50, 3, 0, 0, 51, 3, 0, 0, 52, 3, 0, 0, 248, 0, 2, 0, 51, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 53, 3, 0, 0, 22, 3, 0, 0, 62, 0, 3, 0, 12, 3, 0, 0, 53, 3, 0, 0, 249, 0, 2, 0, 52, 3, 0, 0, 248, 0, 2, 0, 52, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 54, 3, 0, 0, 2, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 55, 3, 0, 0, 12, 3, 0, 0, 148, 0, 5, 0, 6, 0, 0, 0, 56, 3, 0, 0, 54, 3, 0, 0, 55, 3, 0, 0, 184, 0, 5, 0, 18, 0, 0, 0, 57, 3, 0, 0, 56, 3, 0, 0, 80, 1, 0, 0, 247, 0, 3, 0, 59, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 57, 3, 0, 0, 58, 3, 0, 0, 59, 3, 0, 0, 248, 0, 2, 0, 58, 3, 0, 0, 62, 0, 3, 0, 60, 3, 0, 0, 86, 2, 0, 0, 57, 0, 5, 0, 8, 0, 0, 0, 61, 3, 0, 0, 11, 0, 0, 0, 60, 3, 0, 0, 254, 0, 2, 0, 61, 3, 0, 0, 248, 0, 2, 0, 59, 3, 0, 0, 249, 0, 2, 0, 37, 3, 0, 0, 248, 0, 2, 0, 37, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 63, 3, 0, 0, 2, 3, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 64, 3, 0, 0, 63, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 65, 3, 0, 0, 2, 3, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 66, 3, 0, 0, 65, 3, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 67, 3, 0, 0, 64, 3, 0, 0, 66, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 68, 3, 0, 0, 2, 3, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 69, 3, 0, 0, 68, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 70, 3, 0, 0, 2, 3, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 71, 3, 0, 0, 70, 3, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 72, 3, 0, 0, 69, 3, 0, 0, 71, 3, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 73, 3, 0, 0, 67, 3, 0, 0, 72, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 74, 3, 0, 0, 12, 3, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 75, 3, 0, 0, 74, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 76, 3, 0, 0, 12, 3, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 77, 3, 0, 0, 76, 3, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 78, 3, 0, 0, 75, 3, 0, 0, 77, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 79, 3, 0, 0, 12, 3, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 80, 3, 0, 0, 79, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 81, 3, 0, 0, 12, 3, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 82, 3, 0, 0, 81, 3, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 83, 3, 0, 0, 80, 3, 0, 0, 82, 3, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 84, 3, 0, 0, 78, 3, 0, 0, 83, 3, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 85, 3, 0, 0, 73, 3, 0, 0, 84, 3, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 86, 3, 0, 0, 1, 0, 0, 0, 31, 0, 0, 0, 85, 3, 0, 0, 62, 0, 3, 0, 87, 3, 0, 0, 86, 3, 0, 0, 57, 0, 5, 0, 8, 0, 0, 0, 88, 3, 0, 0, 11, 0, 0, 0, 87, 3, 0, 0, 254, 0, 2, 0, 88, 3, 0, 0, 248, 0, 2, 0, 223, 1, 0, 0, 249, 0, 2, 0, 39, 1, 0, 0, 248, 0, 2, 0, 39, 1, 0, 0, 249, 0, 2, 0, 22, 1, 0, 0, 248, 0, 2, 0, 22, 1, 0, 0, 1, 0, 3, 0, 8, 0, 0, 0, 90, 3, 0, 0, 254, 0, 2, 0, 90, 3, 0, 0, 56, 0, 1, 0, 54, 0, 5, 0, 18, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 20, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 21, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 22, 0, 0, 0, 248, 0, 2, 0, 24, 0, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 91, 3, 0, 0, 21, 0, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 92, 3, 0, 0, 91, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 93, 3, 0, 0, 20, 0, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 94, 3, 0, 0, 93, 3, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 95, 3, 0, 0, 92, 3, 0, 0, 94, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 96, 3, 0, 0, 22, 0, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 97, 3, 0, 0, 96, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 98, 3, 0, 0, 20, 0, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 99, 3, 0, 0, 98, 3, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 100, 3, 0, 0, 97, 3, 0, 0, 99, 3, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 101, 3, 0, 0, 95, 3, 0, 0, 100, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 102, 3, 0, 0, 22, 0, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 103, 3, 0, 0, 102, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 104, 3, 0, 0, 20, 0, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 105, 3, 0, 0, 104, 3, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 106, 3, 0, 0, 103, 3, 0, 0, 105, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 107, 3, 0, 0, 21, 0, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 108, 3, 0, 0, 107, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 109, 3, 0, 0, 20, 0, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 110, 3, 0, 0, 109, 3, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 111, 3, 0, 0, 108, 3, 0, 0, 110, 3, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 112, 3, 0, 0, 106, 3, 0, 0, 111, 3, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 113, 3, 0, 0, 101, 3, 0, 0, 112, 3, 0, 0, 188, 0, 5, 0, 18, 0, 0, 0, 114, 3, 0, 0, 113, 3, 0, 0, 80, 1, 0, 0, 254, 0, 2, 0, 114, 3, 0, 0, 56, 0, 1, 0, 54, 0, 5, 0, 18, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 26, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 27, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 28, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 29, 0, 0, 0, 248, 0, 2, 0, 31, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 117, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 136, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 137, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 138, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 149, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 150, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 151, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 163, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 164, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 165, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 177, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 178, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 179, 3, 0, 0, 7, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 118, 3, 0, 0, 28, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 119, 3, 0, 0, 27, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 120, 3, 0, 0, 26, 0, 0, 0, 131, 0, 5, 0, 16, 0, 0, 0, 121, 3, 0, 0, 119, 3, 0, 0, 120, 3, 0, 0, 12, 0, 6, 0, 16, 0, 0, 0, 122, 3, 0, 0, 1, 0, 0, 0, 69, 0, 0, 0, 121, 3, 0, 0, 142, 0, 5, 0, 16, 0, 0, 0, 123, 3, 0, 0, 122, 3, 0, 0, 118, 3, 0, 0, 62, 0, 3, 0, 117, 3, 0, 0, 123, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 124, 3, 0, 0, 117, 3, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 125, 3, 0, 0, 124, 3, 0, 0, 127, 0, 4, 0, 6, 0, 0, 0, 126, 3, 0, 0, 125, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 127, 3, 0, 0, 117, 3, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 128, 3, 0, 0, 127, 3, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 129, 3, 0, 0, 126, 3, 0, 0, 128, 3, 0, 0, 62, 0, 3, 0, 117, 3, 0, 0, 129, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 130, 3, 0, 0, 26, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 131, 3, 0, 0, 117, 3, 0, 0, 129, 0, 5, 0, 16, 0, 0, 0, 132, 3, 0, 0, 130, 3, 0, 0, 131, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 133, 3, 0, 0, 27, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 134, 3, 0, 0, 117, 3, 0, 0, 129, 0, 5, 0, 16, 0, 0, 0, 135, 3, 0, 0, 133, 3, 0, 0, 134, 3, 0, 0, 62, 0, 3, 0, 136, 3, 0, 0, 132, 3, 0, 0, 62, 0, 3, 0, 137, 3, 0, 0, 135, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 139, 3, 0, 0, 29, 0, 0, 0, 62, 0, 3, 0, 138, 3, 0, 0, 139, 3, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 140, 3, 0, 0, 23, 0, 0, 0, 136, 3, 0, 0, 137, 3, 0, 0, 138, 3, 0, 0, 247, 0, 3, 0, 142, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 140, 3, 0, 0, 141, 3, 0, 0, 142, 3, 0, 0, 248, 0, 2, 0, 141, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 143, 3, 0, 0, 27, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 144, 3, 0, 0, 117, 3, 0, 0, 129, 0, 5, 0, 16, 0, 0, 0, 145, 3, 0, 0, 143, 3, 0, 0, 144, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 146, 3, 0, 0, 27, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 147, 3, 0, 0, 117, 3, 0, 0, 131, 0, 5, 0, 16, 0, 0, 0, 148, 3, 0, 0, 146, 3, 0, 0, 147, 3, 0, 0, 62, 0, 3, 0, 149, 3, 0, 0, 145, 3, 0, 0, 62, 0, 3, 0, 150, 3, 0, 0, 148, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 152, 3, 0, 0, 29, 0, 0, 0, 62, 0, 3, 0, 151, 3, 0, 0, 152, 3, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 153, 3, 0, 0, 23, 0, 0, 0, 149, 3, 0, 0, 150, 3, 0, 0, 151, 3, 0, 0, 249, 0, 2, 0, 142, 3, 0, 0, 248, 0, 2, 0, 142, 3, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 154, 3, 0, 0, 140, 3, 0, 0, 31, 0, 0, 0, 153, 3, 0, 0, 141, 3, 0, 0, 247, 0, 3, 0, 156, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 154, 3, 0, 0, 155, 3, 0, 0, 156, 3, 0, 0, 248, 0, 2, 0, 155, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 157, 3, 0, 0, 27, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 158, 3, 0, 0, 117, 3, 0, 0, 131, 0, 5, 0, 16, 0, 0, 0, 159, 3, 0, 0, 157, 3, 0, 0, 158, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 160, 3, 0, 0, 26, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 161, 3, 0, 0, 117, 3, 0, 0, 131, 0, 5, 0, 16, 0, 0, 0, 162, 3, 0, 0, 160, 3, 0, 0, 161, 3, 0, 0, 62, 0, 3, 0, 163, 3, 0, 0, 159, 3, 0, 0, 62, 0, 3, 0, 164, 3, 0, 0, 162, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 166, 3, 0, 0, 29, 0, 0, 0, 62, 0, 3, 0, 165, 3, 0, 0, 166, 3, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 167, 3, 0, 0, 23, 0, 0, 0, 163, 3, 0, 0, 164, 3, 0, 0, 165, 3, 0, 0, 249, 0, 2, 0, 156, 3, 0, 0, 248, 0, 2, 0, 156, 3, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 168, 3, 0, 0, 154, 3, 0, 0, 142, 3, 0, 0, 167, 3, 0, 0, 155, 3, 0, 0, 247, 0, 3, 0, 170, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 168, 3, 0, 0, 169, 3, 0, 0, 170, 3, 0, 0, 248, 0, 2, 0, 169, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 171, 3, 0, 0, 26, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 172, 3, 0, 0, 117, 3, 0, 0, 131, 0, 5, 0, 16, 0, 0, 0, 173, 3, 0, 0, 171, 3, 0, 0, 172, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 174, 3, 0, 0, 26, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 175, 3, 0, 0, 117, 3, 0, 0, 129, 0, 5, 0, 16, 0, 0, 0, 176, 3, 0, 0, 174, 3, 0, 0, 175, 3, 0, 0, 62, 0, 3, 0, 177, 3, 0, 0, 173, 3, 0, 0, 62, 0, 3, 0, 178, 3, 0, 0, 176, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 180, 3, 0, 0, 29, 0, 0, 0, 62, 0, 3, 0, 179, 3, 0, 0, 180, 3, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 181, 3, 0, 0, 23, 0, 0, 0, 177, 3, 0, 0, 178, 3, 0, 0, 179, 3, 0, 0, 249, 0, 2, 0, 170, 3, 0, 0, 248, 0, 2, 0, 170, 3, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 182, 3, 0, 0, 168, 3, 0, 0, 156, 3, 0, 0, 181, 3, 0, 0, 169, 3, 0, 0, 254, 0, 2, 0, 182, 3, 0, 0, 56, 0, 1, 0, 54, 0, 5, 0, 18, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 33, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 34, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 35, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 36, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 37, 0, 0, 0, 248, 0, 2, 0, 39, 0, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 185, 3, 0, 0, 37, 0, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 186, 3, 0, 0, 185, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 187, 3, 0, 0, 33, 0, 0, 0, 190, 0, 5, 0, 18, 0, 0, 0, 188, 3, 0, 0, 186, 3, 0, 0, 187, 3, 0, 0, 247, 0, 3, 0, 190, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 188, 3, 0, 0, 189, 3, 0, 0, 190, 3, 0, 0, 248, 0, 2, 0, 189, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 191, 3, 0, 0, 37, 0, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 192, 3, 0, 0, 191, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 193, 3, 0, 0, 35, 0, 0, 0, 188, 0, 5, 0, 18, 0, 0, 0, 194, 3, 0, 0, 192, 3, 0, 0, 193, 3, 0, 0, 249, 0, 2, 0, 190, 3, 0, 0, 248, 0, 2, 0, 190, 3, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 195, 3, 0, 0, 188, 3, 0, 0, 39, 0, 0, 0, 194, 3, 0, 0, 189, 3, 0, 0, 247, 0, 3, 0, 197, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 195, 3, 0, 0, 196, 3, 0, 0, 197, 3, 0, 0, 248, 0, 2, 0, 196, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 198, 3, 0, 0, 37, 0, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 199, 3, 0, 0, 198, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 200, 3, 0, 0, 34, 0, 0, 0, 190, 0, 5, 0, 18, 0, 0, 0, 201, 3, 0, 0, 199, 3, 0, 0, 200, 3, 0, 0, 249, 0, 2, 0, 197, 3, 0, 0, 248, 0, 2, 0, 197, 3, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 202, 3, 0, 0, 195, 3, 0, 0, 190, 3, 0, 0, 201, 3, 0, 0, 196, 3, 0, 0, 247, 0, 3, 0, 204, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 202, 3, 0, 0, 203, 3, 0, 0, 204, 3, 0, 0, 248, 0, 2, 0, 203, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 205, 3, 0, 0, 37, 0, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 206, 3, 0, 0, 205, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 207, 3, 0, 0, 36, 0, 0, 0, 188, 0, 5, 0, 18, 0, 0, 0, 208, 3, 0, 0, 206, 3, 0, 0, 207, 3, 0, 0, 249, 0, 2, 0, 204, 3, 0, 0, 248, 0, 2, 0, 204, 3, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 209, 3, 0, 0, 202, 3, 0, 0, 197, 3, 0, 0, 208, 3, 0, 0, 203, 3, 0, 0, 254, 0, 2, 0, 209, 3, 0, 0, 56, 0, 1, 0, 54, 0, 5, 0, 18, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 41, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 42, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 43, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 44, 0, 0, 0, 248, 0, 2, 0, 46, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 212, 3, 0, 0, 41, 0, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 213, 3, 0, 0, 44, 0, 0, 0, 131, 0, 5, 0, 16, 0, 0, 0, 214, 3, 0, 0, 213, 3, 0, 0, 212, 3, 0, 0, 62, 0, 3, 0, 44, 0, 0, 0, 214, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 215, 3, 0, 0, 44, 0, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 216, 3, 0, 0, 215, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 217, 3, 0, 0, 44, 0, 0, 0, 109, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 218, 3, 0, 0, 217, 3, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 219, 3, 0, 0, 216, 3, 0, 0, 218, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 220, 3, 0, 0, 42, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 221, 3, 0, 0, 42, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 222, 3, 0, 0, 220, 3, 0, 0, 221, 3, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 223, 3, 0, 0, 219, 3, 0, 0, 222, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 224, 3, 0, 0, 44, 0, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 225, 3, 0, 0, 224, 3, 0, 0, 65, 0, 5, 0, 7, 0, 0, 0, 226, 3, 0, 0, 44, 0, 0, 0, 121, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 227, 3, 0, 0, 226, 3, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 228, 3, 0, 0, 225, 3, 0, 0, 227, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 229, 3, 0, 0, 43, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 230, 3, 0, 0, 43, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 231, 3, 0, 0, 229, 3, 0, 0, 230, 3, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 232, 3, 0, 0, 228, 3, 0, 0, 231, 3, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 233, 3, 0, 0, 223, 3, 0, 0, 232, 3, 0, 0, 188, 0, 5, 0, 18, 0, 0, 0, 234, 3, 0, 0, 233, 3, 0, 0, 237, 1, 0, 0, 254, 0, 2, 0, 234, 3, 0, 0, 56, 0, 1, 0, 54, 0, 5, 0, 18, 0, 0, 0, 55, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 48, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 49, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 50, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 51, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 52, 0, 0, 0, 55, 0, 3, 0, 7, 0, 0, 0, 53, 0, 0, 0, 55, 0, 3, 0, 17, 0, 0, 0, 54, 0, 0, 0, 248, 0, 2, 0, 56, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 247, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 248, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 249, 3, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 8, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 9, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 10, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 26, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 27, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 28, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 44, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 45, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 46, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 62, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 63, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 64, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 80, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 81, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 82, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 98, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 99, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 100, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 116, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 117, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 118, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 132, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 133, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 135, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 137, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 151, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 152, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 154, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 156, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 170, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 171, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 173, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 175, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 189, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 190, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 7, 0, 0, 0, 192, 4, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 17, 0, 0, 0, 194, 4, 0, 0, 7, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 237, 3, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 238, 3, 0, 0, 52, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 239, 3, 0, 0, 237, 3, 0, 0, 238, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 240, 3, 0, 0, 49, 0, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 241, 3, 0, 0, 239, 3, 0, 0, 240, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 242, 3, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 243, 3, 0, 0, 52, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 244, 3, 0, 0, 242, 3, 0, 0, 243, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 245, 3, 0, 0, 49, 0, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 246, 3, 0, 0, 244, 3, 0, 0, 245, 3, 0, 0, 62, 0, 3, 0, 247, 3, 0, 0, 241, 3, 0, 0, 62, 0, 3, 0, 248, 3, 0, 0, 246, 3, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 250, 3, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 249, 3, 0, 0, 250, 3, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 251, 3, 0, 0, 23, 0, 0, 0, 247, 3, 0, 0, 248, 3, 0, 0, 249, 3, 0, 0, 247, 0, 3, 0, 253, 3, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 251, 3, 0, 0, 252, 3, 0, 0, 253, 3, 0, 0, 248, 0, 2, 0, 252, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 254, 3, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 255, 3, 0, 0, 52, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 0, 4, 0, 0, 254, 3, 0, 0, 255, 3, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 1, 4, 0, 0, 49, 0, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 2, 4, 0, 0, 0, 4, 0, 0, 1, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 3, 4, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 4, 4, 0, 0, 49, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 5, 4, 0, 0, 53, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 6, 4, 0, 0, 4, 4, 0, 0, 5, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 7, 4, 0, 0, 3, 4, 0, 0, 6, 4, 0, 0, 62, 0, 3, 0, 8, 4, 0, 0, 2, 4, 0, 0, 62, 0, 3, 0, 9, 4, 0, 0, 7, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 11, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 10, 4, 0, 0, 11, 4, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 12, 4, 0, 0, 23, 0, 0, 0, 8, 4, 0, 0, 9, 4, 0, 0, 10, 4, 0, 0, 249, 0, 2, 0, 253, 3, 0, 0, 248, 0, 2, 0, 253, 3, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 13, 4, 0, 0, 251, 3, 0, 0, 56, 0, 0, 0, 12, 4, 0, 0, 252, 3, 0, 0, 247, 0, 3, 0, 15, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 13, 4, 0, 0, 14, 4, 0, 0, 15, 4, 0, 0, 248, 0, 2, 0, 14, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 16, 4, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 17, 4, 0, 0, 49, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 18, 4, 0, 0, 53, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 19, 4, 0, 0, 17, 4, 0, 0, 18, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 20, 4, 0, 0, 16, 4, 0, 0, 19, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 21, 4, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 22, 4, 0, 0, 51, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 23, 4, 0, 0, 53, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 24, 4, 0, 0, 22, 4, 0, 0, 23, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 25, 4, 0, 0, 21, 4, 0, 0, 24, 4, 0, 0, 62, 0, 3, 0, 26, 4, 0, 0, 20, 4, 0, 0, 62, 0, 3, 0, 27, 4, 0, 0, 25, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 29, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 28, 4, 0, 0, 29, 4, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 30, 4, 0, 0, 23, 0, 0, 0, 26, 4, 0, 0, 27, 4, 0, 0, 28, 4, 0, 0, 249, 0, 2, 0, 15, 4, 0, 0, 248, 0, 2, 0, 15, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 31, 4, 0, 0, 13, 4, 0, 0, 253, 3, 0, 0, 30, 4, 0, 0, 14, 4, 0, 0, 247, 0, 3, 0, 33, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 31, 4, 0, 0, 32, 4, 0, 0, 33, 4, 0, 0, 248, 0, 2, 0, 32, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 34, 4, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 35, 4, 0, 0, 51, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 36, 4, 0, 0, 53, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 37, 4, 0, 0, 35, 4, 0, 0, 36, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 38, 4, 0, 0, 34, 4, 0, 0, 37, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 39, 4, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 40, 4, 0, 0, 52, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 41, 4, 0, 0, 39, 4, 0, 0, 40, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 42, 4, 0, 0, 51, 0, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 43, 4, 0, 0, 41, 4, 0, 0, 42, 4, 0, 0, 62, 0, 3, 0, 44, 4, 0, 0, 38, 4, 0, 0, 62, 0, 3, 0, 45, 4, 0, 0, 43, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 47, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 46, 4, 0, 0, 47, 4, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 48, 4, 0, 0, 23, 0, 0, 0, 44, 4, 0, 0, 45, 4, 0, 0, 46, 4, 0, 0, 249, 0, 2, 0, 33, 4, 0, 0, 248, 0, 2, 0, 33, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 49, 4, 0, 0, 31, 4, 0, 0, 15, 4, 0, 0, 48, 4, 0, 0, 32, 4, 0, 0, 247, 0, 3, 0, 51, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 49, 4, 0, 0, 50, 4, 0, 0, 51, 4, 0, 0, 248, 0, 2, 0, 50, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 52, 4, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 53, 4, 0, 0, 52, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 54, 4, 0, 0, 52, 4, 0, 0, 53, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 55, 4, 0, 0, 51, 0, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 56, 4, 0, 0, 54, 4, 0, 0, 55, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 57, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 58, 4, 0, 0, 52, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 59, 4, 0, 0, 57, 4, 0, 0, 58, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 60, 4, 0, 0, 51, 0, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 61, 4, 0, 0, 59, 4, 0, 0, 60, 4, 0, 0, 62, 0, 3, 0, 62, 4, 0, 0, 56, 4, 0, 0, 62, 0, 3, 0, 63, 4, 0, 0, 61, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 65, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 64, 4, 0, 0, 65, 4, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 66, 4, 0, 0, 23, 0, 0, 0, 62, 4, 0, 0, 63, 4, 0, 0, 64, 4, 0, 0, 249, 0, 2, 0, 51, 4, 0, 0, 248, 0, 2, 0, 51, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 67, 4, 0, 0, 49, 4, 0, 0, 33, 4, 0, 0, 66, 4, 0, 0, 50, 4, 0, 0, 247, 0, 3, 0, 69, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 67, 4, 0, 0, 68, 4, 0, 0, 69, 4, 0, 0, 248, 0, 2, 0, 68, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 70, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 71, 4, 0, 0, 52, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 72, 4, 0, 0, 70, 4, 0, 0, 71, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 73, 4, 0, 0, 51, 0, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 74, 4, 0, 0, 72, 4, 0, 0, 73, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 75, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 76, 4, 0, 0, 51, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 77, 4, 0, 0, 53, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 78, 4, 0, 0, 76, 4, 0, 0, 77, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 79, 4, 0, 0, 75, 4, 0, 0, 78, 4, 0, 0, 62, 0, 3, 0, 80, 4, 0, 0, 74, 4, 0, 0, 62, 0, 3, 0, 81, 4, 0, 0, 79, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 83, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 82, 4, 0, 0, 83, 4, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 84, 4, 0, 0, 23, 0, 0, 0, 80, 4, 0, 0, 81, 4, 0, 0, 82, 4, 0, 0, 249, 0, 2, 0, 69, 4, 0, 0, 248, 0, 2, 0, 69, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 85, 4, 0, 0, 67, 4, 0, 0, 51, 4, 0, 0, 84, 4, 0, 0, 68, 4, 0, 0, 247, 0, 3, 0, 87, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 85, 4, 0, 0, 86, 4, 0, 0, 87, 4, 0, 0, 248, 0, 2, 0, 86, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 88, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 89, 4, 0, 0, 51, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 90, 4, 0, 0, 53, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 91, 4, 0, 0, 89, 4, 0, 0, 90, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 92, 4, 0, 0, 88, 4, 0, 0, 91, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 93, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 94, 4, 0, 0, 49, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 95, 4, 0, 0, 53, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 96, 4, 0, 0, 94, 4, 0, 0, 95, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 97, 4, 0, 0, 93, 4, 0, 0, 96, 4, 0, 0, 62, 0, 3, 0, 98, 4, 0, 0, 92, 4, 0, 0, 62, 0, 3, 0, 99, 4, 0, 0, 97, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 101, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 100, 4, 0, 0, 101, 4, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 102, 4, 0, 0, 23, 0, 0, 0, 98, 4, 0, 0, 99, 4, 0, 0, 100, 4, 0, 0, 249, 0, 2, 0, 87, 4, 0, 0, 248, 0, 2, 0, 87, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 103, 4, 0, 0, 85, 4, 0, 0, 69, 4, 0, 0, 102, 4, 0, 0, 86, 4, 0, 0, 247, 0, 3, 0, 105, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 103, 4, 0, 0, 104, 4, 0, 0, 105, 4, 0, 0, 248, 0, 2, 0, 104, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 106, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 107, 4, 0, 0, 49, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 108, 4, 0, 0, 53, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 109, 4, 0, 0, 107, 4, 0, 0, 108, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 110, 4, 0, 0, 106, 4, 0, 0, 109, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 111, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 112, 4, 0, 0, 52, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 113, 4, 0, 0, 111, 4, 0, 0, 112, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 114, 4, 0, 0, 49, 0, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 115, 4, 0, 0, 113, 4, 0, 0, 114, 4, 0, 0, 62, 0, 3, 0, 116, 4, 0, 0, 110, 4, 0, 0, 62, 0, 3, 0, 117, 4, 0, 0, 115, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 119, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 118, 4, 0, 0, 119, 4, 0, 0, 57, 0, 7, 0, 18, 0, 0, 0, 120, 4, 0, 0, 23, 0, 0, 0, 116, 4, 0, 0, 117, 4, 0, 0, 118, 4, 0, 0, 249, 0, 2, 0, 105, 4, 0, 0, 248, 0, 2, 0, 105, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 121, 4, 0, 0, 103, 4, 0, 0, 87, 4, 0, 0, 120, 4, 0, 0, 104, 4, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 122, 4, 0, 0, 121, 4, 0, 0, 247, 0, 3, 0, 124, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 122, 4, 0, 0, 123, 4, 0, 0, 124, 4, 0, 0, 248, 0, 2, 0, 123, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 125, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 126, 4, 0, 0, 52, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 127, 4, 0, 0, 125, 4, 0, 0, 126, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 128, 4, 0, 0, 49, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 129, 4, 0, 0, 53, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 130, 4, 0, 0, 128, 4, 0, 0, 129, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 131, 4, 0, 0, 127, 4, 0, 0, 130, 4, 0, 0, 62, 0, 3, 0, 132, 4, 0, 0, 131, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 134, 4, 0, 0, 52, 0, 0, 0, 62, 0, 3, 0, 133, 4, 0, 0, 134, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 136, 4, 0, 0, 53, 0, 0, 0, 62, 0, 3, 0, 135, 4, 0, 0, 136, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 138, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 137, 4, 0, 0, 138, 4, 0, 0, 57, 0, 8, 0, 18, 0, 0, 0, 139, 4, 0, 0, 45, 0, 0, 0, 132, 4, 0, 0, 133, 4, 0, 0, 135, 4, 0, 0, 137, 4, 0, 0, 249, 0, 2, 0, 124, 4, 0, 0, 248, 0, 2, 0, 124, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 140, 4, 0, 0, 121, 4, 0, 0, 105, 4, 0, 0, 139, 4, 0, 0, 123, 4, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 141, 4, 0, 0, 140, 4, 0, 0, 247, 0, 3, 0, 143, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 141, 4, 0, 0, 142, 4, 0, 0, 143, 4, 0, 0, 248, 0, 2, 0, 142, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 144, 4, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 145, 4, 0, 0, 52, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 146, 4, 0, 0, 144, 4, 0, 0, 145, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 147, 4, 0, 0, 49, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 148, 4, 0, 0, 53, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 149, 4, 0, 0, 147, 4, 0, 0, 148, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 150, 4, 0, 0, 146, 4, 0, 0, 149, 4, 0, 0, 62, 0, 3, 0, 151, 4, 0, 0, 150, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 153, 4, 0, 0, 52, 0, 0, 0, 62, 0, 3, 0, 152, 4, 0, 0, 153, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 155, 4, 0, 0, 53, 0, 0, 0, 62, 0, 3, 0, 154, 4, 0, 0, 155, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 157, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 156, 4, 0, 0, 157, 4, 0, 0, 57, 0, 8, 0, 18, 0, 0, 0, 158, 4, 0, 0, 45, 0, 0, 0, 151, 4, 0, 0, 152, 4, 0, 0, 154, 4, 0, 0, 156, 4, 0, 0, 249, 0, 2, 0, 143, 4, 0, 0, 248, 0, 2, 0, 143, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 159, 4, 0, 0, 140, 4, 0, 0, 124, 4, 0, 0, 158, 4, 0, 0, 142, 4, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 160, 4, 0, 0, 159, 4, 0, 0, 247, 0, 3, 0, 162, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 160, 4, 0, 0, 161, 4, 0, 0, 162, 4, 0, 0, 248, 0, 2, 0, 161, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 163, 4, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 164, 4, 0, 0, 52, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 165, 4, 0, 0, 163, 4, 0, 0, 164, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 166, 4, 0, 0, 51, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 167, 4, 0, 0, 53, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 168, 4, 0, 0, 166, 4, 0, 0, 167, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 169, 4, 0, 0, 165, 4, 0, 0, 168, 4, 0, 0, 62, 0, 3, 0, 170, 4, 0, 0, 169, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 172, 4, 0, 0, 52, 0, 0, 0, 62, 0, 3, 0, 171, 4, 0, 0, 172, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 174, 4, 0, 0, 53, 0, 0, 0, 62, 0, 3, 0, 173, 4, 0, 0, 174, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 176, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 175, 4, 0, 0, 176, 4, 0, 0, 57, 0, 8, 0, 18, 0, 0, 0, 177, 4, 0, 0, 45, 0, 0, 0, 170, 4, 0, 0, 171, 4, 0, 0, 173, 4, 0, 0, 175, 4, 0, 0, 249, 0, 2, 0, 162, 4, 0, 0, 248, 0, 2, 0, 162, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 178, 4, 0, 0, 159, 4, 0, 0, 143, 4, 0, 0, 177, 4, 0, 0, 161, 4, 0, 0, 168, 0, 4, 0, 18, 0, 0, 0, 179, 4, 0, 0, 178, 4, 0, 0, 247, 0, 3, 0, 181, 4, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 179, 4, 0, 0, 180, 4, 0, 0, 181, 4, 0, 0, 248, 0, 2, 0, 180, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 182, 4, 0, 0, 50, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 183, 4, 0, 0, 52, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 184, 4, 0, 0, 182, 4, 0, 0, 183, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 185, 4, 0, 0, 51, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 186, 4, 0, 0, 53, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 187, 4, 0, 0, 185, 4, 0, 0, 186, 4, 0, 0, 80, 0, 5, 0, 16, 0, 0, 0, 188, 4, 0, 0, 184, 4, 0, 0, 187, 4, 0, 0, 62, 0, 3, 0, 189, 4, 0, 0, 188, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 191, 4, 0, 0, 52, 0, 0, 0, 62, 0, 3, 0, 190, 4, 0, 0, 191, 4, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 193, 4, 0, 0, 53, 0, 0, 0, 62, 0, 3, 0, 192, 4, 0, 0, 193, 4, 0, 0, 61, 0, 4, 0, 16, 0, 0, 0, 195, 4, 0, 0, 54, 0, 0, 0, 62, 0, 3, 0, 194, 4, 0, 0, 195, 4, 0, 0, 57, 0, 8, 0, 18, 0, 0, 0, 196, 4, 0, 0, 45, 0, 0, 0, 189, 4, 0, 0, 190, 4, 0, 0, 192, 4, 0, 0, 194, 4, 0, 0, 249, 0, 2, 0, 181, 4, 0, 0, 248, 0, 2, 0, 181, 4, 0, 0, 245, 0, 7, 0, 18, 0, 0, 0, 197, 4, 0, 0, 178, 4, 0, 0, 162, 4, 0, 0, 196, 4, 0, 0, 180, 4, 0, 0, 254, 0, 2, 0, 197, 4, 0, 0, 56, 0, 1, 0, };
 }
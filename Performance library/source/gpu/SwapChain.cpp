@@ -17,135 +17,107 @@ namespace gpu
 		VkQueue vkGraphicsQueue,
 		VkQueue vkPresentQueue,
 		VkFormat vkFormat,
-		uint32 vkImageCount,
-		std::vector<VkImage> &vkImages,
-		std::vector<VkImageView> &vkViews,
-		VkFormat vkDepthFormat,
-		VkImage vkDepthImage,
-		VkImageView vkDepthView,
-		VkDeviceMemory vkDepthMemory,
-		VkImage msaaColorImage,
-		VkDeviceMemory msaaColorMemory,
-		VkImageView msaaImageView,
-		VkImage msaaDepthImage,
-		VkDeviceMemory msaaDepthMemory,
-		VkImageView msaaDepthView,
-		VkRenderPass vkRenderPass,
-		std::vector<VkFramebuffer> vkFramebuffers,
-		uint32 currentBuffer)
+		std::vector<VkImage> &vkImages)
 	{
 		device->AddRef();
 		this->device = device;
-		surface->AddRef();
+		if (surface != nullptr) surface->AddRef();
 		this->surface = surface;
 		this->vkSwapChainCreateInfo = vkSwapChainCreateInfo;
 		this->vkSwapChain = vkSwapChain;
 		this->vkGraphicsQueue = vkGraphicsQueue;
 		this->vkPresentQueue = vkPresentQueue;
 		this->vkFormat = vkFormat;
-		this->imageCount = vkImageCount;
+		this->imageCount = (uint32)vkImages.size();
 		this->vkImages = vkImages;
-		this->vkViews = vkViews;
-		this->vkDepthFormat = vkDepthFormat;
-		this->vkDepthImage = vkDepthImage;
-		this->vkDepthView = vkDepthView;
-		this->vkDepthMemory = vkDepthMemory;
-		this->msaaColorImage = msaaColorImage;
-		this->msaaColorMemory = msaaColorMemory;
-		this->msaaImageView = msaaImageView;
-		this->msaaDepthImage = msaaDepthImage;
-		this->msaaDepthMemory = msaaDepthMemory;
-		this->msaaDepthView = msaaDepthView;
-		this->vkRenderPass = vkRenderPass;
-		this->vkFramebuffers = vkFramebuffers;
-		this->currentBuffer = currentBuffer;
+		vkViews.resize(imageCount, VK_NULL_HANDLE);
+		vkDepthImage = VK_NULL_HANDLE;
+		vkDepthView = VK_NULL_HANDLE;
+		vkDepthMemory = VK_NULL_HANDLE;
+		msaaColorImage = VK_NULL_HANDLE;
+		msaaColorMemory = VK_NULL_HANDLE;
+		msaaImageView = VK_NULL_HANDLE;
+		msaaDepthImage = VK_NULL_HANDLE;
+		msaaDepthMemory = VK_NULL_HANDLE;
+		msaaDepthView = VK_NULL_HANDLE;
+		vkRenderPass = VK_NULL_HANDLE;
+		vkFramebuffers.resize(imageCount, VK_NULL_HANDLE);
+		currentBuffer = 0;
 	}
 	SwapChain::~SwapChain()
 	{
-		for (uint32 i = 0; i < imageCount; i++)
-			vkDestroyFramebuffer(device->vkDevice, vkFramebuffers[i], nullptr);
-		vkDestroyRenderPass(device->vkDevice, vkRenderPass, nullptr);
-		vkDestroyImageView(device->vkDevice, msaaDepthView, nullptr);
-		vkFreeMemory(device->vkDevice, msaaDepthMemory, nullptr);
-		vkDestroyImage(device->vkDevice, msaaDepthImage, nullptr);
-		vkFreeMemory(device->vkDevice, msaaColorMemory, nullptr);
-		vkDestroyImage(device->vkDevice, msaaColorImage, nullptr);
-		vkDestroyImageView(device->vkDevice, vkDepthView, nullptr);
-		vkDestroyImage(device->vkDevice, vkDepthImage, nullptr);
-		vkFreeMemory(device->vkDevice, vkDepthMemory, nullptr);
-		for (uint32 i = 0; i < imageCount; i++)
-			vkDestroyImageView(device->vkDevice, vkViews[i], nullptr);
-		vkDestroySwapchainKHR(device->vkDevice, vkSwapChain, nullptr);
-		surface->Unref();
+		DestroyAttachments();
+		if (IsOffscreen()) DestroyOffscreenImages();
+		else vkDestroySwapchainKHR(device->vkDevice, vkSwapChain, nullptr);
+		if (surface != nullptr) surface->Unref();
 		device->Unref();
 	}
-	uint32 SwapChain::GetWidth()
+	HResult SwapChain::CreateOffscreenImages()
 	{
-		return vkSwapChainCreateInfo.imageExtent.width;
-	}
-	uint32 SwapChain::GetHeight()
-	{
-		return vkSwapChainCreateInfo.imageExtent.height;
-	}
-	uint32 SwapChain::GetCurrentBuffer()
-	{
-		return currentBuffer;
+		VkImageCreateInfo imageCreateInfo = {};
+		imageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+		imageCreateInfo.pNext = nullptr;
+		imageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
+		imageCreateInfo.format = vkFormat;
+		imageCreateInfo.extent.width = vkSwapChainCreateInfo.imageExtent.width;
+		imageCreateInfo.extent.height = vkSwapChainCreateInfo.imageExtent.height;
+		imageCreateInfo.extent.depth = 1;
+		imageCreateInfo.mipLevels = 1;
+		imageCreateInfo.arrayLayers = 1;
+		imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		imageCreateInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+		imageCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+		imageCreateInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+		imageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+		VkMemoryAllocateInfo memAlloc;
+		memAlloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		memAlloc.pNext = nullptr;
+		vkImageMemories.resize(imageCount, VK_NULL_HANDLE);
+		for (uint32 i = 0; i < imageCount; i++)
+		{
+			CheckReturnFail(vkCreateImage(
+				device->vkDevice,
+				&imageCreateInfo,
+				nullptr,
+				&vkImages[i]));
+
+			VkMemoryRequirements memReqs;
+			vkGetImageMemoryRequirements(device->vkDevice, vkImages[i], &memReqs);
+			if (!device->GetMemoryTypeFromRequirements(
+				device->vkPhysicalDevice,
+				memReqs.memoryTypeBits,
+				VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+				&memAlloc.memoryTypeIndex))
+				return HResultFail;
+			memAlloc.allocationSize = memReqs.size;
+			CheckReturnFail(vkAllocateMemory(
+				device->vkDevice,
+				&memAlloc,
+				nullptr,
+				&vkImageMemories[i]));
+			CheckReturnFail(vkBindImageMemory(
+				device->vkDevice,
+				vkImages[i],
+				vkImageMemories[i],
+				0));
+		}
+		return HResultSuccess;
 	}
-	HResult SwapChain::Resize(uint32 width, uint32 height)
+	void SwapChain::DestroyOffscreenImages()
 	{
 		for (uint32 i = 0; i < imageCount; i++)
-			vkDestroyFramebuffer(device->vkDevice, vkFramebuffers[i], nullptr);
-		vkDestroyRenderPass(device->vkDevice, vkRenderPass, nullptr);
-		vkDestroyImageView(device->vkDevice, msaaDepthView, nullptr);
-		vkFreeMemory(device->vkDevice, msaaDepthMemory, nullptr);
-		vkDestroyImage(device->vkDevice, msaaDepthImage, nullptr);
-		vkFreeMemory(device->vkDevice, msaaColorMemory, nullptr);
-		vkDestroyImage(device->vkDevice, msaaColorImage, nullptr);
-		vkDestroyImageView(device->vkDevice, vkDepthView, nullptr);
-		vkDestroyImage(device->vkDevice, vkDepthImage, nullptr);
-		vkFreeMemory(device->vkDevice, vkDepthMemory, nullptr);
-		for (uint32 i = 0; i < imageCount; i++)
-			vkDestroyImageView(device->vkDevice, vkViews[i], nullptr);
-
-		VkSurfaceCapabilitiesKHR surfaceCapabilities;
-		vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
-			device->vkPhysicalDevice,
-			surface->vkSurface,
-			&surfaceCapabilities);
-		VkExtent2D swapChainExtent;
-		if (surfaceCapabilities.currentExtent.width == UINT32_MAX)
 		{
-			swapChainExtent.width = width;
-			swapChainExtent.height = height;
-			if (swapChainExtent.width < surfaceCapabilities.minImageExtent.width)
-				swapChainExtent.width = surfaceCapabilities.minImageExtent.width;
-			else if (swapChainExtent.width > surfaceCapabilities.maxImageExtent.width)
-				swapChainExtent.width = surfaceCapabilities.maxImageExtent.width;
-			if (swapChainExtent.height < surfaceCapabilities.minImageExtent.height)
-				swapChainExtent.height = surfaceCapabilities.minImageExtent.height;
-			else if (swapChainExtent.height > surfaceCapabilities.maxImageExtent.height)
-				swapChainExtent.height = surfaceCapabilities.maxImageExtent.height;
+			vkDestroyImage(device->vkDevice, vkImages[i], nullptr);
+			vkImages[i] = VK_NULL_HANDLE;
+			if (i < vkImageMemories.size())
+				vkFreeMemory(device->vkDevice, vkImageMemories[i], nullptr);
 		}
-		else swapChainExtent = surfaceCapabilities.currentExtent;
-		vkSwapChainCreateInfo.imageExtent = swapChainExtent;
-		vkSwapChainCreateInfo.oldSwapchain = vkSwapChain;
-		VkSwapchainKHR vkNewSwapChain;
-		CheckReturnFail(vkCreateSwapchainKHR(
-			device->vkDevice,
-			&vkSwapChainCreateInfo,
-			nullptr,
-			&vkNewSwapChain));
-		vkDestroySwapchainKHR(device->vkDevice, vkSwapChain, nullptr);
-		vkSwapChain = vkNewSwapChain;
-
-		uint32 vkImageCount = vkImages.size();
-		CheckReturnFail(vkGetSwapchainImagesKHR(
-			device->vkDevice,
-			vkSwapChain,
-			&vkImageCount,
-			vkImages.data()));
-
-		for (uint32 i = 0; i < vkImageCount; i++)
+		vkImageMemories.clear();
+	}
+	HResult SwapChain::CreateAttachments()
+	{
+		for (uint32 i = 0; i < imageCount; i++)
 		{
 			VkImageViewCreateInfo viewCreateInfo;
 			viewCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
@@ -170,7 +142,7 @@ namespace gpu
 				&vkViews[i]));
 		}
 
-		VkFormat vkDepthFormat = VK_FORMAT_D16_UNORM;
+		vkDepthFormat = VK_FORMAT_D16_UNORM;
 		VkImageCreateInfo imageCreateInfo;
 		VkFormatProperties formatProps;
 		vkGetPhysicalDeviceFormatProperties(
@@ -185,8 +157,8 @@ namespace gpu
 		imageCreateInfo.pNext = nullptr;
 		imageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
 		imageCreateInfo.format = vkDepthFormat;
-		imageCreateInfo.extent.width = swapChainExtent.width;
-		imageCreateInfo.extent.height = swapChainExtent.height;
+		imageCreateInfo.extent.width = vkSwapChainCreateInfo.imageExtent.width;
+		imageCreateInfo.extent.height = vkSwapChainCreateInfo.imageExtent.height;
 		imageCreateInfo.extent.depth = 1;
 		imageCreateInfo.mipLevels = 1;
 		imageCreateInfo.arrayLayers = 1;
@@ -249,21 +221,170 @@ namespace gpu
 			nullptr,
 			&vkDepthView));
 
-		VkSampleCountFlagBits msaa = VK_SAMPLE_COUNT_8_BIT;
+		bool multisampled = device->msaa != VK_SAMPLE_COUNT_1_BIT;
+		if (multisampled) CheckReturn(CreateMultisampleImages());
+
+		VkAttachmentDescription attachments[4];
+		attachments[0].format = vkFormat;
+		attachments[0].samples = device->msaa;
+		attachments[0].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+		attachments[0].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+		attachments[0].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+		attachments[0].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+		attachments[0].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		attachments[0].finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+		attachments[0].flags = 0;
+
+		attachments[1].format = vkFormat;
+		attachments[1].samples = VK_SAMPLE_COUNT_1_BIT;
+		attachments[1].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+		attachments[1].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+		attachments[1].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+		attachments[1].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+		attachments[1].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		attachments[1].finalLayout = IsOffscreen()
+			? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+			: VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+		attachments[1].flags = 0;
+
+		attachments[2].format = vkDepthFormat;
+		attachments[2].samples = device->msaa;
+		attachments[2].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+		attachments[2].storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+		attachments[2].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+		attachments[2].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+		attachments[2].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		attachments[2].finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+		attachments[2].flags = 0;
+
+		attachments[3].format = vkDepthFormat;
+		attachments[3].samples = VK_SAMPLE_COUNT_1_BIT;
+		attachments[3].loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+		attachments[3].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+		attachments[3].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+		attachments[3].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+		attachments[3].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		attachments[3].finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+		attachments[3].flags = 0;
+
+		VkAttachmentReference colorReference;
+		colorReference.attachment = 0;
+		colorReference.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+		VkAttachmentReference depthReference;
+		depthReference.attachment = 2;
+		depthReference.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+		VkAttachmentReference resolveReference;
+		resolveReference.attachment = 1;
+		resolveReference.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+		VkSubpassDescription subpass;
+		subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+		subpass.flags = 0;
+		subpass.inputAttachmentCount = 0;
+		subpass.pInputAttachments = nullptr;
+		subpass.colorAttachmentCount = 1;
+		subpass.pColorAttachments = &colorReference;
+		subpass.pResolveAttachments = &resolveReference;
+		subpass.pDepthStencilAttachment = &depthReference;
+		subpass.preserveAttachmentCount = 0;
+		subpass.pPreserveAttachments = nullptr;
+
+		if (!multisampled)
+		{
+			// Single sampled passes draw to the target image and depth buffer directly
+			attachments[0] = attachments[1];
+			attachments[1] = attachments[3];
+			attachments[1].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+			attachments[1].storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+			depthReference.attachment = 1;
+			subpass.pResolveAttachments = nullptr;
+		}
+
+		VkSubpassDependency dependencies[2];
+		dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+		dependencies[0].dstSubpass = 0;
+		dependencies[0].srcStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+		dependencies[0].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+		dependencies[0].srcAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+		dependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+		dependencies[0].dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
+
+		dependencies[1].srcSubpass = 0;
+		dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+		dependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+		dependencies[1].dstStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+		dependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+		dependencies[1].dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+		dependencies[1].dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
+		if (IsOffscreen())
+		{
+			// The transition to the transfer source layout must complete before
+			// the readback copy recorded after the pass
+			dependencies[1].dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+			dependencies[1].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+			dependencies[1].dependencyFlags = 0;
+		}
+
+		VkRenderPassCreateInfo renderPassCreateInfo;
+		renderPassCreateInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+		renderPassCreateInfo.pNext = nullptr;
+		renderPassCreateInfo.attachmentCount = multisampled ? 4 : 2;
+		renderPassCreateInfo.pAttachments = attachments;
+		renderPassCreateInfo.subpassCount = 1;
+		renderPassCreateInfo.pSubpasses = &subpass;
+		renderPassCreateInfo.dependencyCount = 2;
+		renderPassCreateInfo.pDependencies = dependencies;
+		renderPassCreateInfo.flags = 0;
+		CheckReturnFail(vkCreateRenderPass(
+			device->vkDevice,
+			&renderPassCreateInfo,
+			nullptr,
+			&vkRenderPass));
+
+		VkImageView imageViewAttachments[4];
+		imageViewAttachments[0] = msaaImageView;
+		imageViewAttachments[2] = msaaDepthView;
+		imageViewAttachments[3] = vkDepthView;
+		if (!multisampled) imageViewAttachments[1] = vkDepthView;
+
+		VkFramebufferCreateInfo fbCreateInfo;
+		fbCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+		fbCreateInfo.pNext = nullptr;
+		fbCreateInfo.renderPass = vkRenderPass;
+		fbCreateInfo.attachmentCount = multisampled ? 4 : 2;
+		fbCreateInfo.pAttachments = imageViewAttachments;
+		fbCreateInfo.width = vkSwapChainCreateInfo.imageExtent.width;
+		fbCreateInfo.height = vkSwapChainCreateInfo.imageExtent.height;
+		fbCreateInfo.layers = 1;
+		fbCreateInfo.flags = 0;
+
+		for (uint32 i = 0; i < imageCount; i++)
+		{
+			imageViewAttachments[multisampled ? 1 : 0] = vkViews[i];
+			CheckReturnFail(vkCreateFramebuffer(
+				device->vkDevice,
+				&fbCreateInfo,
+				nullptr,
+				&vkFramebuffers[i]));
+		}
 
-		imageCreateInfo = {};
+		return HResultSuccess;
+	}
+	HResult SwapChain::CreateMultisampleImages()
+	{
+		VkImageCreateInfo imageCreateInfo = {};
 		imageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
 		imageCreateInfo.pNext = nullptr;
 		imageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
 		imageCreateInfo.format = vkSwapChainCreateInfo.imageFormat;
-		imageCreateInfo.extent.width = swapChainExtent.width;
-		imageCreateInfo.extent.height = swapChainExtent.height;
+		imageCreateInfo.extent.width = vkSwapChainCreateInfo.imageExtent.width;
+		imageCreateInfo.extent.height = vkSwapChainCreateInfo.imageExtent.height;
 		imageCreateInfo.extent.depth = 1;
 		imageCreateInfo.mipLevels = 1;
 		imageCreateInfo.arrayLayers = 1;
 		imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 		imageCreateInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
-		imageCreateInfo.samples = msaa;
+		imageCreateInfo.samples = device->msaa;
 		imageCreateInfo.usage = VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
 		imageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 
@@ -273,7 +394,11 @@ namespace gpu
 			nullptr,
 			&msaaColorImage));
 
+		VkMemoryRequirements memReqs;
 		vkGetImageMemoryRequirements(device->vkDevice, msaaColorImage, &memReqs);
+		VkMemoryAllocateInfo memAlloc;
+		memAlloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		memAlloc.pNext = nullptr;
 		if (!device->GetMemoryTypeFromRequirements(
 			device->vkPhysicalDevice,
 			memReqs.memoryTypeBits,
@@ -293,6 +418,9 @@ namespace gpu
 			msaaColorMemory,
 			0));
 
+		VkImageViewCreateInfo viewCreateInfo = {};
+		viewCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+		viewCreateInfo.pNext = nullptr;
 		viewCreateInfo.image = msaaColorImage;
 		viewCreateInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
 		viewCreateInfo.format = vkSwapChainCreateInfo.imageFormat;
@@ -311,14 +439,14 @@ namespace gpu
 
 		imageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
 		imageCreateInfo.format = vkDepthFormat;
-		imageCreateInfo.extent.width = swapChainExtent.width;
-		imageCreateInfo.extent.height = swapChainExtent.height;
+		imageCreateInfo.extent.width = vkSwapChainCreateInfo.imageExtent.width;
+		imageCreateInfo.extent.height = vkSwapChainCreateInfo.imageExtent.height;
 		imageCreateInfo.extent.depth = 1;
 		imageCreateInfo.mipLevels = 1;
 		imageCreateInfo.arrayLayers = 1;
 		imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 		imageCreateInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
-		imageCreateInfo.samples = msaa;
+		imageCreateInfo.samples = device->msaa;
 		imageCreateInfo.usage = VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
 		imageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 		CheckReturnFail(vkCreateImage(
@@ -365,159 +493,129 @@ namespace gpu
 			&viewCreateInfo,
 			nullptr,
 			&msaaDepthView));
+		return HResultSuccess;
+	}
+	void SwapChain::DestroyAttachments()
+	{
+		for (uint32 i = 0; i < imageCount; i++)
+			vkDestroyFramebuffer(device->vkDevice, vkFramebuffers[i], nullptr);
+		vkDestroyRenderPass(device->vkDevice, vkRenderPass, nullptr);
+		vkDestroyImageView(device->vkDevice, msaaDepthView, nullptr);
+		vkFreeMemory(device->vkDevice, msaaDepthMemory, nullptr);
+		vkDestroyImage(device->vkDevice, msaaDepthImage, nullptr);
+		vkDestroyImageView(device->vkDevice, msaaImageView, nullptr);
+		vkFreeMemory(device->vkDevice, msaaColorMemory, nullptr);
+		vkDestroyImage(device->vkDevice, msaaColorImage, nullptr);
+		vkDestroyImageView(device->vkDevice, vkDepthView, nullptr);
+		vkDestroyImage(device->vkDevice, vkDepthImage, nullptr);
+		vkFreeMemory(device->vkDevice, vkDepthMemory, nullptr);
+		for (uint32 i = 0; i < imageCount; i++)
+			vkDestroyImageView(device->vkDevice, vkViews[i], nullptr);
+	}
+	uint32 SwapChain::GetWidth()
+	{
+		return vkSwapChainCreateInfo.imageExtent.width;
+	}
+	uint32 SwapChain::GetHeight()
+	{
+		return vkSwapChainCreateInfo.imageExtent.height;
+	}
+	uint32 SwapChain::GetCurrentBuffer()
+	{
+		return currentBuffer;
+	}
+	HResult SwapChain::Resize(uint32 width, uint32 height)
+	{
+		device->queueSection.lock();
+		vkDeviceWaitIdle(device->vkDevice);
+		device->queueSection.unlock();
+		DestroyAttachments();
 
-		VkAttachmentDescription attachments[4];
-		attachments[0].format = vkFormat;
-		attachments[0].samples = msaa;
-		attachments[0].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-		attachments[0].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-		attachments[0].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-		attachments[0].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-		attachments[0].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-		attachments[0].finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-		attachments[0].flags = 0;
-
-		attachments[1].format = vkDepthFormat;
-		attachments[1].samples = VK_SAMPLE_COUNT_1_BIT;
-		attachments[1].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-		attachments[1].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-		attachments[1].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-		attachments[1].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-		attachments[1].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-		attachments[1].finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
-		attachments[1].flags = 0;
-
-		attachments[2].format = vkDepthFormat;
-		attachments[2].samples = msaa;
-		attachments[2].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-		attachments[2].storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-		attachments[2].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-		attachments[2].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-		attachments[2].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-		attachments[2].finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-		attachments[2].flags = 0;
-
-		attachments[3].format = vkDepthFormat;
-		attachments[3].samples = VK_SAMPLE_COUNT_1_BIT;
-		attachments[3].loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-		attachments[3].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-		attachments[3].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-		attachments[3].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-		attachments[3].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-		attachments[3].finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-		attachments[3].flags = 0;
-
-		VkAttachmentReference colorReference;
-		colorReference.attachment = 0;
-		colorReference.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-		VkAttachmentReference depthReference;
-		depthReference.attachment = 2;
-		depthReference.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-		VkAttachmentReference resolveReference;
-		resolveReference.attachment = 1;
-		resolveReference.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-
-		VkSubpassDescription subpass;
-		subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
-		subpass.flags = 0;
-		subpass.inputAttachmentCount = 0;
-		subpass.pInputAttachments = nullptr;
-		subpass.colorAttachmentCount = 1;
-		subpass.pColorAttachments = &colorReference;
-		subpass.pResolveAttachments = &resolveReference;
-		subpass.pDepthStencilAttachment = &depthReference;
-		subpass.preserveAttachmentCount = 0;
-		subpass.pPreserveAttachments = nullptr;
-
-		VkSubpassDependency dependencies[2];
-		dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
-		dependencies[0].dstSubpass = 0;
-		dependencies[0].srcStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-		dependencies[0].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-		dependencies[0].srcAccessMask = VK_ACCESS_MEMORY_READ_BIT;
-		dependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-		dependencies[0].dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
-
-		dependencies[1].srcSubpass = 0;
-		dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
-		dependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-		dependencies[1].dstStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-		dependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-		dependencies[1].dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
-		dependencies[1].dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
+		if (IsOffscreen())
+		{
+			DestroyOffscreenImages();
+			vkSwapChainCreateInfo.imageExtent.width = width;
+			vkSwapChainCreateInfo.imageExtent.height = height;
+			CheckReturn(CreateOffscreenImages());
+			return CreateAttachments();
+		}
 
-		VkRenderPassCreateInfo renderPassCreateInfo;
-		renderPassCreateInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-		renderPassCreateInfo.pNext = nullptr;
-		renderPassCreateInfo.attachmentCount = 4;
-		renderPassCreateInfo.pAttachments = attachments;
-		renderPassCreateInfo.subpassCount = 1;
-		renderPassCreateInfo.pSubpasses = &subpass;
-		renderPassCreateInfo.dependencyCount = 2;
-		renderPassCreateInfo.pDependencies = dependencies;
-		renderPassCreateInfo.flags = 0;
-		CheckReturnFail(vkCreateRenderPass(
+		VkSurfaceCapabilitiesKHR surfaceCapabilities;
+		vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
+			device->vkPhysicalDevice,
+			surface->vkSurface,
+			&surfaceCapabilities);
+		VkExtent2D swapChainExtent;
+		if (surfaceCapabilities.currentExtent.width == UINT32_MAX)
+		{
+			swapChainExtent.width = width;
+			swapChainExtent.height = height;
+			if (swapChainExtent.width < surfaceCapabilities.minImageExtent.width)
+				swapChainExtent.width = surfaceCapabilities.minImageExtent.width;
+			else if (swapChainExtent.width > surfaceCapabilities.maxImageExtent.width)
+				swapChainExtent.width = surfaceCapabilities.maxImageExtent.width;
+			if (swapChainExtent.height < surfaceCapabilities.minImageExtent.height)
+				swapChainExtent.height = surfaceCapabilities.minImageExtent.height;
+			else if (swapChainExtent.height > surfaceCapabilities.maxImageExtent.height)
+				swapChainExtent.height = surfaceCapabilities.maxImageExtent.height;
+		}
+		else swapChainExtent = surfaceCapabilities.currentExtent;
+		vkSwapChainCreateInfo.imageExtent = swapChainExtent;
+		vkSwapChainCreateInfo.oldSwapchain = vkSwapChain;
+		VkSwapchainKHR vkNewSwapChain;
+		CheckReturnFail(vkCreateSwapchainKHR(
 			device->vkDevice,
-			&renderPassCreateInfo,
+			&vkSwapChainCreateInfo,
 			nullptr,
-			&vkRenderPass));
-
-		VkImageView imageViewAttachments[4];
-		imageViewAttachments[0] = msaaImageView;
-		imageViewAttachments[2] = msaaDepthView;
-		imageViewAttachments[3] = vkDepthView;
+			&vkNewSwapChain));
+		vkDestroySwapchainKHR(device->vkDevice, vkSwapChain, nullptr);
+		vkSwapChain = vkNewSwapChain;
 
-		VkFramebufferCreateInfo fbCreateInfo;
-		fbCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-		fbCreateInfo.pNext = nullptr;
-		fbCreateInfo.renderPass = vkRenderPass;
-		fbCreateInfo.attachmentCount = 4;
-		fbCreateInfo.pAttachments = imageViewAttachments;
-		fbCreateInfo.width = vkSwapChainCreateInfo.imageExtent.width;
-		fbCreateInfo.height = vkSwapChainCreateInfo.imageExtent.height;
-		fbCreateInfo.layers = 1;
-		fbCreateInfo.flags = 0;
+		uint32 vkImageCount = vkImages.size();
+		CheckReturnFail(vkGetSwapchainImagesKHR(
+			device->vkDevice,
+			vkSwapChain,
+			&vkImageCount,
+			vkImages.data()));
 
-		for (uint32 i = 0; i < vkImageCount; i++)
+		return CreateAttachments();
+	}
+	bool SwapChain::IsOffscreen()
+	{
+		return surface == nullptr;
+	}
+	HResult SwapChain::AcquireNextImage(VkSemaphore signalSemaphore)
+	{
+		if (IsOffscreen())
 		{
-			imageViewAttachments[1] = vkViews[i];
-			vkCreateFramebuffer(
-				device->vkDevice,
-				&fbCreateInfo,
-				nullptr,
-				&vkFramebuffers[i]);
+			// Images are handed out round-robin; the caller's frame fence
+			// already guards reuse, so nothing is signaled
+			currentBuffer = (currentBuffer + 1) % imageCount;
+			return HResultSuccess;
 		}
-
 		CheckReturnFail(vkAcquireNextImageKHR(
 			device->vkDevice,
 			vkSwapChain,
 			UINT64_MAX,
-			VK_NULL_HANDLE,
+			signalSemaphore,
 			VK_NULL_HANDLE,
 			&currentBuffer));
-		vkDeviceWaitIdle(device->vkDevice);
-
 		return HResultSuccess;
 	}
-	void SwapChain::Present()
+	void SwapChain::Present(VkSemaphore waitSemaphore)
 	{
-		vkQueueWaitIdle(vkPresentQueue);
+		if (IsOffscreen()) return;
 		VkPresentInfoKHR present;
 		present.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
 		present.pNext = nullptr;
 		present.swapchainCount = 1;
 		present.pSwapchains = &vkSwapChain;
 		present.pImageIndices = &currentBuffer;
-		present.waitSemaphoreCount = 0;
-		present.pWaitSemaphores = nullptr;
+		present.waitSemaphoreCount = 1;
+		present.pWaitSemaphores = &waitSemaphore;
 		present.pResults = nullptr;
+		device->queueSection.lock();
 		vkQueuePresentKHR(vkPresentQueue, &present);
-		vkAcquireNextImageKHR(
-			device->vkDevice,
-			vkSwapChain,
-			UINT64_MAX,
-			VK_NULL_HANDLE,
-			VK_NULL_HANDLE,
-			&currentBuffer);
+		device->queueSection.unlock();
 	}
 }
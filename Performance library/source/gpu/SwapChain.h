@@ -37,6 +37,8 @@ namespace gpu
 		VkRenderPass vkRenderPass;
 		std::vector<VkFramebuffer> vkFramebuffers;
 		uint32 currentBuffer;
+		// Offscreen chains have no surface and own their color images
+		std::vector<VkDeviceMemory> vkImageMemories;
 
 		SwapChain(
 			GpuDevice *device,
@@ -46,28 +48,20 @@ namespace gpu
 			VkQueue vkGraphicsQueue,
 			VkQueue vkPresentQueue,
 			VkFormat vkFormat,
-			uint32 vkImageCount,
-			std::vector<VkImage> &vkImages,
-			std::vector<VkImageView> &vkViews,
-			VkFormat vkDepthFormat,
-			VkImage vkDepthImage,
-			VkImageView vkDepthView,
-			VkDeviceMemory vkDepthMemory,
-			VkImage msaaColorImage,
-			VkDeviceMemory msaaColorMemory,
-			VkImageView msaaImageView,
-			VkImage msaaDepthImage,
-			VkDeviceMemory msaaDepthMemory,
-			VkImageView msaaDepthView,
-			VkRenderPass vkRenderPass,
-			std::vector<VkFramebuffer> vkFramebuffers,
-			uint32 currentBuffer);
+			std::vector<VkImage> &vkImages);
 		~SwapChain();
+		HResult CreateOffscreenImages();
+		void DestroyOffscreenImages();
+		HResult CreateMultisampleImages();
+		HResult CreateAttachments();
+		void DestroyAttachments();
 	public:
 		uint32 GetWidth();
 		uint32 GetHeight();
 		uint32 GetCurrentBuffer();
 		HResult Resize(uint32 width, uint32 height);
-		void Present();
+		bool IsOffscreen();
+		HResult AcquireNextImage(VkSemaphore signalSemaphore);
+		void Present(VkSemaphore waitSemaphore);
 	};
 }
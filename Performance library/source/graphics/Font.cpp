@@ -3,14 +3,40 @@
 
 #include "Font.h"
 #include "kernel\OperatingSystemAPI.h"
-#include <tuple>
-#include <map>
+#include <unordered_map>
 
 namespace graphics
 {
-	std::map<std::tuple<std::wstring, uint32, bool, uint32>, FontMetadata *> fontTable;
-	std::map<std::tuple<char32, FontMetadata *>, CharMetadata *> charTable;
+	struct FontKey
+	{
+		std::wstring fontName;
+		uint32 size;
+		bool isItalic;
+		uint32 weight;
+		bool operator==(const FontKey &key) const
+		{
+			return size == key.size
+				&& isItalic == key.isItalic
+				&& weight == key.weight
+				&& fontName == key.fontName;
+		}
+	};
+	struct FontKeyHash
+	{
+		size_t operator()(const FontKey &key) const
+		{
+			size_t hash = std::hash<std::wstring>()(key.fontName);
+			return hash ^ ((size_t)key.size << 16 | (size_t)key.weight << 1 | (size_t)key.isItalic) * 0x9E3779B1u;
+		}
+	};
+	std::unordered_map<FontKey, FontMetadata *, FontKeyHash> fontTable;
+	// Text is usually inserted in runs of one font, so the last lookup is
+	// checked before hashing the name
+	FontMetadata *lastFont = nullptr;
+	bool lastFontItalic;
+	uint32 lastFontWeight;
 	float32 dpiMultiplier;
+	CharMetadata missingGlyph;
 
 	HResult FontInitialize()
 	{
@@ -23,7 +49,7 @@ namespace graphics
 		return dpiMultiplier;
 	}
 	HResult FontManager::GetFontMetadata(
-		std::wstring &fontName,
+		const std::wstring &fontName,
 		float32 size,
 		bool isItalic,
 		uint32 weight,
@@ -32,43 +58,115 @@ namespace graphics
 		size = round(size);
 		weight = Max(400, weight);
 		weight = Min(1000, weight);
-		decltype(fontTable)::key_type key(fontName, (uint32)size, isItalic, weight);
-		decltype(fontTable)::iterator iter = fontTable.find(key);
+		if (lastFont != nullptr
+			&& lastFont->size == (uint32)size
+			&& lastFontItalic == isItalic
+			&& lastFontWeight == weight
+			&& lastFont->fontName == fontName)
+		{
+			*fontMetadata = lastFont;
+			return HResultSuccess;
+		}
+		FontKey key = { fontName, (uint32)size, isItalic, weight };
+		auto iter = fontTable.find(key);
 		if (iter == fontTable.end())
 		{
 			FontMetadata *font = new FontMetadata();
-			if (OSLoadFont((wchar *)fontName.c_str(), (uint32)size, isItalic, weight, font) == HResultSuccess)
+			if (OSLoadFont((wchar *)fontName.c_str(), (uint32)size, isItalic, weight, font) != HResultSuccess)
 			{
-				fontTable[key] = font;
-				*fontMetadata = font;
-				return HResultSuccess;
+				delete font;
+				return HResultFail;
 			}
-			else return HResultFail;
+			iter = fontTable.insert({ key, font }).first;
 		}
-		*fontMetadata = iter->second;
+		lastFont = iter->second;
+		lastFontItalic = isItalic;
+		lastFontWeight = weight;
+		*fontMetadata = lastFont;
 		return HResultSuccess;
 	}
+	uint32 FontManager::HashCode(char32 code)
+	{
+		uint32 hash = (uint32)code * 0x9E3779B1u;
+		return hash ^ (hash >> 16);
+	}
+	void FontManager::InsertGlyph(
+		FontMetadata *font,
+		char32 code,
+		CharMetadata *charMetadata)
+	{
+		if (code < 128)
+		{
+			font->basicLatin[code] = charMetadata;
+			return;
+		}
+		// Grown at 3/4 load to keep probe sequences short
+		if (4 * (font->glyphCount + 1) > 3 * font->glyphSlots.size())
+		{
+			std::vector<GlyphSlot> slots(Max(64u, 2 * (uint32)font->glyphSlots.size()), { 0, nullptr });
+			std::swap(slots, font->glyphSlots);
+			font->glyphCount = 0;
+			for (GlyphSlot &slot : slots)
+				if (slot.charMetadata != nullptr)
+					InsertGlyph(font, slot.code, slot.charMetadata);
+		}
+		uint32 mask = (uint32)font->glyphSlots.size() - 1;
+		uint32 i = HashCode(code) & mask;
+		while (font->glyphSlots[i].charMetadata != nullptr)
+			i = (i + 1) & mask;
+		font->glyphSlots[i] = { code, charMetadata };
+		font->glyphCount++;
+	}
 	HResult FontManager::GetCharMetadata(
 		char32 code,
 		FontMetadata *font,
 		CharMetadata **charMetadata)
 	{
-		decltype(charTable)::key_type key(code, font);
-		decltype(charTable)::iterator iter = charTable.find(key);
-		if (iter == charTable.end())
+		if (code < 128)
 		{
-			CharMetadata *fontCharMetadata = new CharMetadata();
-			if (OSLoadGlyphMetadata(code, font, fontCharMetadata) == HResultSuccess)
+			if (font->basicLatin[code] != nullptr)
 			{
-				charTable[key] = fontCharMetadata;
-				*charMetadata = fontCharMetadata;
+				*charMetadata = font->basicLatin[code];
 				return HResultSuccess;
 			}
-			else return HResultFail;
 		}
-		*charMetadata = iter->second;
+		else if (font->glyphCount != 0)
+		{
+			uint32 mask = (uint32)font->glyphSlots.size() - 1;
+			for (uint32 i = HashCode(code) & mask;
+				font->glyphSlots[i].charMetadata != nullptr;
+				i = (i + 1) & mask)
+			{
+				if (font->glyphSlots[i].code == code)
+				{
+					*charMetadata = font->glyphSlots[i].charMetadata;
+					return HResultSuccess;
+				}
+			}
+		}
+		CharMetadata *fontCharMetadata = new CharMetadata();
+		if (OSLoadGlyphMetadata(code, font, fontCharMetadata) != HResultSuccess)
+		{
+			delete fontCharMetadata;
+			return HResultFail;
+		}
+		InsertGlyph(font, code, fontCharMetadata);
+		*charMetadata = fontCharMetadata;
 		return HResultSuccess;
 	}
+	CharMetadata *FontManager::GetGlyph(char32 code, FontMetadata *font)
+	{
+		CharMetadata *charMetadata;
+		if (GetCharMetadata(code, font, &charMetadata) == HResultSuccess)
+			return charMetadata;
+		if (code == U'?' || GetCharMetadata(U'?', font, &charMetadata) != HResultSuccess)
+		{
+			missingGlyph.advance = Vector2f(0.0f, 0.0f);
+			charMetadata = &missingGlyph;
+		}
+		InsertGlyph(font, code, charMetadata);
+		return charMetadata;
+	}
 	uint32 FontManager::AdjustFontWeight(uint32 value)
 	{
 		if (value <= 400) value = 400;
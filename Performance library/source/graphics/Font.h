@@ -5,11 +5,18 @@
 #include "kernel\kernel.h"
 #include "graphics\Geometry.h"
 #include <string>
+#include <vector>
 
 namespace graphics
 {
 	HResult FontInitialize();
 
+	struct GlyphSlot
+	{
+		char32 code;
+		CharMetadata *charMetadata;
+	};
+
 	struct FontMetadata
 	{
 		uint64 fontHandler;
@@ -22,6 +29,11 @@ namespace graphics
 		float32 underlineSize;
 		float32 strikethroughOffset;
 		float32 strikethroughSize;
+		// Loaded glyphs; Basic Latin is indexed directly, other code points
+		// live in an open-addressing table with linear probing
+		CharMetadata *basicLatin[128];
+		std::vector<GlyphSlot> glyphSlots;
+		uint32 glyphCount;
 	};
 
 	struct CharMetadata
@@ -36,7 +48,7 @@ namespace graphics
 	protected:
 		static float32 GetDPIMultiplier();
 		static HResult GetFontMetadata(
-			std::wstring &fontName,
+			const std::wstring &fontName,
 			float32 size,
 			bool isItalic,
 			uint32 weight,
@@ -45,6 +57,14 @@ namespace graphics
 			char32 code,
 			FontMetadata *font,
 			CharMetadata **charMetadata);
+		// Never fails; glyphs the font cannot load resolve to '?' or to an
+		// empty glyph, and are cached as such
+		static CharMetadata *GetGlyph(char32 code, FontMetadata *font);
 		static uint32 AdjustFontWeight(uint32 value);
+		static uint32 HashCode(char32 code);
+		static void InsertGlyph(
+			FontMetadata *font,
+			char32 code,
+			CharMetadata *charMetadata);
 	};
 }
@@ -4,6 +4,9 @@
 #include "graphics/Geometry.h"
 #include "gpu/GpuDevice.h"
 #include <algorithm>
+#include <thread>
+#include <ppl.h>
+#include <emmintrin.h>
 
 namespace graphics
 {
@@ -18,7 +21,7 @@ namespace graphics
 		float32 &cx,
 		float32 &cy,
 		float32 &startAngle,
-		float32 &endAngle)
+		float32 &endAngle) const
 	{
 		theta = m2PI - theta;
 		isLarge = !isLarge;
@@ -62,11 +65,11 @@ namespace graphics
 		if (endVector.y > 0.0f)
 			endAngle = m2PI - endAngle;
 	}
-	Vector2f Geometry::Bezier2(Vector2f p0, Vector2f p1, Vector2f p2, float32 t)
+	Vector2f Geometry::Bezier2(Vector2f p0, Vector2f p1, Vector2f p2, float32 t) const
 	{
 		return (1.0f - t)*((1.0f - t)*p0 + (2.0f*t)*p1) + (t*t)*p2;
 	}
-	void Geometry::AdjustVertical(float32 *y)
+	void Geometry::AdjustVertical(float32 *y) const
 	{
 		const float32 dy = 0.125f;
 		uint32 idx = (uint32)(abs(*y) * 8.0f);
@@ -75,86 +78,123 @@ namespace graphics
 			|| ScalarNearEqual(*y, scan + dy, 1e-4f))
 			*y += 1e-4f;
 	}
-	void Geometry::TransformPoint(float32 *point)
+	void Geometry::TransformPoint(Matrix3x2f &matrix, float32 *point) const
 	{
 		float32 p0 = point[0];
-		point[0] = point[0] * transform[0][0]
-			+ point[1] * transform[1][0]
-			+ transform[2][0];
-		point[1] = point[1] * transform[1][1]
-			+ p0 * transform[0][1]
-			+ transform[2][1];
-	}
-	void Geometry::TransformGeometry(float32 *data, uint32 count)
-	{
-		Vector2f prevUntransformed;
-		uint32 geometryPathOffset = 1;
-		prevUntransformed.x = data[geometryPathOffset];
-		prevUntransformed.y = data[geometryPathOffset + 1];
-		TransformPoint(data + geometryPathOffset);
-		AdjustVertical(data + geometryPathOffset + 1);
-		xMin = Min(xMin, data[geometryPathOffset]);
-		xMax = Max(xMax, data[geometryPathOffset]);
-		yMin = Min(yMin, data[geometryPathOffset + 1]);
-		yMax = Max(yMax, data[geometryPathOffset + 1]);
-		geometryPathOffset += 2;
-		for (uint32 i = 1; i < count; i++)
+		point[0] = point[0] * matrix[0][0]
+			+ point[1] * matrix[1][0]
+			+ matrix[2][0];
+		point[1] = point[1] * matrix[1][1]
+			+ p0 * matrix[0][1]
+			+ matrix[2][1];
+	}
+	void Geometry::TransformGeometry(
+		Matrix3x2f matrix,
+		float32 *data,
+		float32 *x,
+		float32 *y,
+		float32 *bounds) const
+	{
+		// Points are transformed, nudged off scan lines and bounded four at a time
+		uint32 pointCount = (uint32)fillPath.pointX.size(), i = 0;
+		const float32 *srcX = fillPath.pointX.data(),
+			*srcY = fillPath.pointY.data();
+		__m128 m00 = _mm_set1_ps(matrix[0][0]),
+			m01 = _mm_set1_ps(matrix[0][1]),
+			m10 = _mm_set1_ps(matrix[1][0]),
+			m11 = _mm_set1_ps(matrix[1][1]),
+			m20 = _mm_set1_ps(matrix[2][0]),
+			m21 = _mm_set1_ps(matrix[2][1]),
+			signMask = _mm_set1_ps(-0.0f),
+			scanScale = _mm_set1_ps(8.0f),
+			dy = _mm_set1_ps(0.125f),
+			epsilon = _mm_set1_ps(1e-4f),
+			vxMin = _mm_set1_ps(FLT_MAX),
+			vxMax = _mm_set1_ps(-FLT_MAX),
+			vyMin = _mm_set1_ps(FLT_MAX),
+			vyMax = _mm_set1_ps(-FLT_MAX);
+		float32 xMin = FLT_MAX, xMax = -FLT_MAX, yMin = FLT_MAX, yMax = -FLT_MAX;
+		for (; i + 4 <= pointCount; i += 4)
 		{
-			if (Reinterpret<uint32>(data[geometryPathOffset]) == GeometryPath::geometryTypeLine)
-			{
-				prevUntransformed.x = data[geometryPathOffset + 1];
-				prevUntransformed.y = data[geometryPathOffset + 2];
-				TransformPoint(data + geometryPathOffset + 1);
-				AdjustVertical(data + geometryPathOffset + 2);
-				xMin = Min(xMin, data[geometryPathOffset + 1]);
-				xMax = Max(xMax, data[geometryPathOffset + 1]);
-				yMin = Min(yMin, data[geometryPathOffset + 2]);
-				yMax = Max(yMax, data[geometryPathOffset + 2]);
-				geometryPathOffset += 3;
-			}
-			else if (Reinterpret<uint32>(data[geometryPathOffset]) == GeometryPath::geometryTypeQuadraticBezier)
+			__m128 px = _mm_loadu_ps(srcX + i),
+				py = _mm_loadu_ps(srcY + i),
+				tx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, m00), _mm_mul_ps(py, m10)), m20),
+				ty = _mm_add_ps(_mm_add_ps(_mm_mul_ps(py, m11), _mm_mul_ps(px, m01)), m21),
+				sign = _mm_and_ps(ty, signMask),
+				scan = _mm_mul_ps(
+					_mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_mul_ps(_mm_andnot_ps(signMask, ty), scanScale))),
+					dy);
+			scan = _mm_or_ps(scan, sign);
+			__m128 nearScan = _mm_or_ps(
+				_mm_cmplt_ps(_mm_andnot_ps(signMask, _mm_sub_ps(scan, ty)), epsilon),
+				_mm_cmplt_ps(_mm_andnot_ps(signMask, _mm_sub_ps(_mm_add_ps(scan, dy), ty)), epsilon));
+			ty = _mm_add_ps(ty, _mm_and_ps(nearScan, epsilon));
+			_mm_storeu_ps(x + i, tx);
+			_mm_storeu_ps(y + i, ty);
+			vxMin = _mm_min_ps(vxMin, tx);
+			vxMax = _mm_max_ps(vxMax, tx);
+			vyMin = _mm_min_ps(vyMin, ty);
+			vyMax = _mm_max_ps(vyMax, ty);
+		}
+		float32 lanes[4];
+		_mm_storeu_ps(lanes, vxMin);
+		xMin = Min(xMin, lanes[0], lanes[1], lanes[2], lanes[3]);
+		_mm_storeu_ps(lanes, vxMax);
+		xMax = Max(xMax, lanes[0], lanes[1], lanes[2], lanes[3]);
+		_mm_storeu_ps(lanes, vyMin);
+		yMin = Min(yMin, lanes[0], lanes[1], lanes[2], lanes[3]);
+		_mm_storeu_ps(lanes, vyMax);
+		yMax = Max(yMax, lanes[0], lanes[1], lanes[2], lanes[3]);
+		for (; i < pointCount; i++)
+		{
+			float32 point[2] = { srcX[i], srcY[i] };
+			TransformPoint(matrix, point);
+			AdjustVertical(point + 1);
+			x[i] = point[0];
+			y[i] = point[1];
+			xMin = Min(xMin, point[0]);
+			xMax = Max(xMax, point[0]);
+			yMin = Min(yMin, point[1]);
+			yMax = Max(yMax, point[1]);
+		}
+		bounds[0] = xMin;
+		bounds[1] = xMax;
+		bounds[2] = yMin;
+		bounds[3] = yMax;
+		if (fillPath.arcCount == 0) return;
+
+		// Arc parameters depend on the transformed end points
+		uint32 geometryPathOffset = 3, pointIndex = 1;
+		for (uint32 i = 1; i < fillPath.count; i++)
+		{
+			if (Reinterpret<uint32>(data[geometryPathOffset]) == GeometryPath::geometryTypeQuadraticBezier)
 			{
-				prevUntransformed.x = data[geometryPathOffset + 3];
-				prevUntransformed.y = data[geometryPathOffset + 4];
-				TransformPoint(data + geometryPathOffset + 1);
-				AdjustVertical(data + geometryPathOffset + 2);
-				TransformPoint(data + geometryPathOffset + 3);
-				AdjustVertical(data + geometryPathOffset + 4);
-				xMin = Min(xMin, data[geometryPathOffset + 1], data[geometryPathOffset + 3]);
-				xMax = Max(xMax, data[geometryPathOffset + 1], data[geometryPathOffset + 3]);
-				yMin = Min(yMin, data[geometryPathOffset + 2], data[geometryPathOffset + 4]);
-				yMax = Max(yMax, data[geometryPathOffset + 2], data[geometryPathOffset + 4]);
 				geometryPathOffset += 5;
+				pointIndex += 2;
 			}
 			else if (Reinterpret<uint32>(data[geometryPathOffset]) == GeometryPath::geometryTypeArc)
 			{
 				Vector2f dpUntransformed(
-					data[geometryPathOffset + 9] - prevUntransformed.x,
-					data[geometryPathOffset + 10] - prevUntransformed.y);
-				prevUntransformed.x = data[geometryPathOffset + 9];
-				prevUntransformed.y = data[geometryPathOffset + 10];
-				TransformPoint(data + geometryPathOffset + 9);
-				AdjustVertical(data + geometryPathOffset + 10);
-				Vector2f p0(data[geometryPathOffset - 2], data[geometryPathOffset - 1]);
-				float dAngle = VectorAngleBetweenVectors(
-					dpUntransformed,
-					Vector2f(data[geometryPathOffset + 9], data[geometryPathOffset + 10]) - p0);
+					srcX[pointIndex] - srcX[pointIndex - 1],
+					srcY[pointIndex] - srcY[pointIndex - 1]);
+				Vector2f p0(x[pointIndex - 1], y[pointIndex - 1]),
+					p1(x[pointIndex], y[pointIndex]);
+				float dAngle = VectorAngleBetweenVectors(dpUntransformed, p1 - p0);
 				if (!VectorCCWTestRH(
 					Vector2f(0.0f, 0.0f),
 					dpUntransformed,
-					Vector2f(data[geometryPathOffset + 9],
-						data[geometryPathOffset + 10]) - p0))
+					p1 - p0))
 					dAngle = m2PI - dAngle;
 				data[geometryPathOffset + 3] += dAngle;
 				if (data[geometryPathOffset + 3] >= m2PI) data[geometryPathOffset + 3] -= m2PI;
 				bool isLarge = true, isCounterclockwiseSweep = true;
 				if (Reinterpret<uint32>(data[geometryPathOffset + 6]) == 0) isLarge = false;
 				if (Reinterpret<uint32>(data[geometryPathOffset + 7]) == 0) isCounterclockwiseSweep = false;
-				data[geometryPathOffset + 1] *= hypot(transform[0][0], transform[0][1]);
-				data[geometryPathOffset + 2] *= hypot(transform[1][0], transform[1][1]);
+				data[geometryPathOffset + 1] *= hypot(matrix[0][0], matrix[0][1]);
+				data[geometryPathOffset + 2] *= hypot(matrix[1][0], matrix[1][1]);
 				ConvertArc(
 					p0,
-					Vector2f(data[geometryPathOffset + 9], data[geometryPathOffset + 10]),
+					p1,
 					data[geometryPathOffset + 1],
 					data[geometryPathOffset + 2],
 					data[geometryPathOffset + 3],
@@ -164,27 +204,21 @@ namespace graphics
 					data[geometryPathOffset + 5],
 					data[geometryPathOffset + 6],
 					data[geometryPathOffset + 7]);
-				xMin = Min(xMin, data[geometryPathOffset + 4]
+				bounds[0] = Min(bounds[0], data[geometryPathOffset + 4]
 					- Max(data[geometryPathOffset + 1], data[geometryPathOffset + 2]));
-				xMax = Max(xMax, data[geometryPathOffset + 4]
+				bounds[1] = Max(bounds[1], data[geometryPathOffset + 4]
 					+ Max(data[geometryPathOffset + 1], data[geometryPathOffset + 2]));
-				yMin = Min(yMin, data[geometryPathOffset + 5]
+				bounds[2] = Min(bounds[2], data[geometryPathOffset + 5]
 					- Max(data[geometryPathOffset + 1], data[geometryPathOffset + 2]));
-				yMax = Max(yMax, data[geometryPathOffset + 5]
+				bounds[3] = Max(bounds[3], data[geometryPathOffset + 5]
 					+ Max(data[geometryPathOffset + 1], data[geometryPathOffset + 2]));
 				geometryPathOffset += 11;
+				pointIndex++;
 			}
 			else
 			{
-				prevUntransformed.x = data[geometryPathOffset + 1];
-				prevUntransformed.y = data[geometryPathOffset + 2];
-				TransformPoint(data + geometryPathOffset + 1);
-				AdjustVertical(data + geometryPathOffset + 2);
-				xMin = Min(xMin, data[geometryPathOffset + 1]);
-				xMax = Max(xMax, data[geometryPathOffset + 1]);
-				yMin = Min(yMin, data[geometryPathOffset + 2]);
-				yMax = Max(yMax, data[geometryPathOffset + 2]);
 				geometryPathOffset += 3;
+				pointIndex++;
 			}
 		}
 	}
@@ -192,35 +226,29 @@ namespace graphics
 		float32 x,
 		float32 yTangent,
 		int32 scanRow,
-		std::vector<std::vector<float32>> &xtable)
-	{
-		x += 100000.0f;
-		int32 scanColumn = 0;
-		while (scanColumn < xtable[scanRow].size()
-			&& x < abs(xtable[scanRow][scanColumn]))
-			scanColumn++;
-		x = copysign(x, yTangent);
+		ScanBand &band) const
+	{
+		if (scanRow < band.rowBegin || scanRow >= band.rowEnd) return;
+		x = copysign(x + 100000.0f, yTangent);
 		if (!isCounterclockwiseFace) Negate(x);
-		xtable[scanRow].insert(xtable[scanRow].begin() + scanColumn, x);
+		band.crossings.push_back({ scanRow - band.rowBegin, x });
 	}
 	void Geometry::AdvanceLine(
 		Vector2f p0,
 		Vector2f p1,
-		std::vector<std::vector<float32>> &xtable)
+		ScanBand &band) const
 	{
 		const float32 dy = 0.125f;
 		float32 xi1, scan, dpr = (p1.x - p0.x) / (p1.y - p0.y);
-		uint32 idx = (uint32)((Min(p0.y, p1.y) - (float32)xtableStart) * 8.0f),
-			idxMax = (uint32)((Max(p0.y, p1.y) - (float32)xtableStart) * 8.0f);
-		scan = (float32)xtableStart + idx * dy + dy;
+		uint32 idx = (uint32)((Min(p0.y, p1.y) - (float32)band.start) * 8.0f),
+			idxMax = (uint32)((Max(p0.y, p1.y) - (float32)band.start) * 8.0f);
+		idx = Max(idx, (uint32)band.rowBegin);
+		idxMax = Min(idxMax, (uint32)band.rowEnd);
+		scan = (float32)band.start + idx * dy + dy;
 		while (idx < idxMax)
 		{
 			xi1 = p0.x + (scan - p0.y)*dpr;
-			if (idx >= 0 && idx < xtableHeight)
-			{
-				PushDirectedCoord(xi1, p1.y - p0.y, idx, xtable);
-				xtableWidth = Max(xtableWidth, xtable[idx].size());
-			}
+			PushDirectedCoord(xi1, p1.y - p0.y, idx, band);
 			idx++;
 			scan += dy;
 		}
@@ -229,16 +257,19 @@ namespace graphics
 		Vector2f p0,
 		Vector2f p1,
 		Vector2f p2,
-		std::vector<std::vector<float32>> &xtable)
+		ScanBand &band) const
 	{
 		const float32 dy = 0.125f;
-		int32 idx0 = (int32)((p0.y - (float32)xtableStart) * 8.0f),
-			idx1 = (int32)((p2.y - (float32)xtableStart) * 8.0f);
+		int32 idx0 = (int32)((p0.y - (float32)band.start) * 8.0f),
+			idx1 = (int32)((p2.y - (float32)band.start) * 8.0f);
 		bool startIncremental = (p1.y >= p0.y),
 			endIncremental = (p2.y >= p1.y);
 		if (!startIncremental) idx0--;
 		if (endIncremental) idx1--;
-		float32 scan = (float32)xtableStart + idx0 * dy + dy;
+		// Both monotonic parts are walked over the band's rows only
+		if (startIncremental) idx0 = Max(idx0, band.rowBegin);
+		else idx0 = Min(idx0, band.rowEnd - 1);
+		float32 scan = (float32)band.start + idx0 * dy + dy;
 		float32 a = p0.y - 2.0f*p1.y + p2.y;
 		if (abs(a) < 0.001f) a = copysign(0.001f, a);
 		float32 ar = 0.5f / a,
@@ -249,6 +280,7 @@ namespace graphics
 			if (startIncremental == endIncremental
 				&& (startIncremental && idx0 > idx1
 					|| !startIncremental && idx0 < idx1)) break;
+			if (startIncremental ? idx0 >= band.rowEnd : idx0 < band.rowBegin) break;
 			c = p0.y - scan;
 			d = b * b - 4.0f*a*c;
 			if (d < 0.0f) break;
@@ -257,11 +289,7 @@ namespace graphics
 			xi2 = (d - b)*ar;
 			if (xi2 < xi1) Swap(xi1, xi2);
 			if (xi1 < 0.0f || xi1 > 1.0f) Swap(xi1, xi2);
-			if (idx0 >= 0 && idx0 < xtableHeight)
-			{
-				PushDirectedCoord(Bezier2(p0, p1, p2, xi1).x, (startIncremental ? 1.0f : -1.0f), idx0, xtable);
-				xtableWidth = Max(xtableWidth, xtable[idx0].size());
-			}
+			PushDirectedCoord(Bezier2(p0, p1, p2, xi1).x, (startIncremental ? 1.0f : -1.0f), idx0, band);
 			if (startIncremental)
 			{
 				idx0++;
@@ -275,6 +303,17 @@ namespace graphics
 		}
 		if (startIncremental != endIncremental)
 		{
+			if (endIncremental)
+			{
+				idx0 = Max(idx0, band.rowBegin);
+				idx1 = Min(idx1, band.rowEnd - 1);
+			}
+			else
+			{
+				idx0 = Min(idx0, band.rowEnd - 1);
+				idx1 = Max(idx1, band.rowBegin);
+			}
+			scan = (float32)band.start + idx0 * dy + dy;
 			while (true)
 			{
 				if (endIncremental && idx0 > idx1
@@ -288,11 +327,7 @@ namespace graphics
 					xi2 = (d - b)*ar;
 					if (xi2 > xi1) Swap(xi1, xi2);
 					if (xi1 < 0.0f || xi1 > 1.0f) Swap(xi1, xi2);
-					if (idx0 >= 0 && idx0 < xtableHeight)
-					{
-						PushDirectedCoord(Bezier2(p0, p1, p2, xi1).x, (endIncremental ? 1.0f : -1.0f), idx0, xtable);
-						xtableWidth = Max(xtableWidth, xtable[idx0].size());
-					}
+					PushDirectedCoord(Bezier2(p0, p1, p2, xi1).x, (endIncremental ? 1.0f : -1.0f), idx0, band);
 				}
 				if (endIncremental)
 				{
@@ -318,15 +353,18 @@ namespace graphics
 		float32 startAngle,
 		float32 endAngle,
 		bool isCounterclockwisesweep,
-		std::vector<std::vector<float32>>& xtable)
+		ScanBand &band) const
 	{
 		const float32 dy = 0.125f;
-		int32 idx0 = (int32)((p0.y - (float32)xtableStart) * 8.0f),
-			idx1 = (int32)((p1.y - (float32)xtableStart) * 8.0f);
+		int32 idx0 = (int32)((p0.y - (float32)band.start) * 8.0f),
+			idx1 = (int32)((p1.y - (float32)band.start) * 8.0f);
 		bool startIncremental = (startAngle >= mPIdiv2 && startAngle < mPI + mPIdiv2),
 			endIncremental = (endAngle >= mPIdiv2 && endAngle < mPI + mPIdiv2);
 		if (!startIncremental) idx0--;
 		if (endIncremental) idx1--;
+		// Both monotonic parts are walked over the band's rows only
+		if (startIncremental) idx0 = Max(idx0, band.rowBegin);
+		else idx0 = Min(idx0, band.rowEnd - 1);
 		float32 sinTheta = -sin(rotation),
 			cosTheta = cos(rotation),
 			a = cosTheta * cosTheta / (rx*rx) + sinTheta * sinTheta / (ry*ry),
@@ -334,12 +372,13 @@ namespace graphics
 			ck = (sinTheta*sinTheta / (rx*rx) + cosTheta * cosTheta / (ry*ry)),
 			ar = 0.5f / a,
 			b, c, d, xi1;
-		float32 scan = (float32)xtableStart + idx0 * dy + dy - cy;
+		float32 scan = (float32)band.start + idx0 * dy + dy - cy;
 		while (true)
 		{
 			if (startIncremental == endIncremental
 				&& (startIncremental && idx0 > idx1
 					|| !startIncremental && idx0 < idx1)) break;
+			if (startIncremental ? idx0 >= band.rowEnd : idx0 < band.rowBegin) break;
 			b = bk * scan;
 			c = ck * scan*scan - 1.0f;
 			d = b * b - 4.0f*a*c;
@@ -347,11 +386,7 @@ namespace graphics
 			d = sqrt(d);
 			if(startIncremental) xi1 = (-d - b)*ar + cx;
 			else xi1 = (d - b)*ar + cx;
-			if (idx0 >= 0 && idx0 < xtableHeight)
-			{
-				PushDirectedCoord(xi1, ((startIncremental == isCounterclockwisesweep) ? 1.0f : -1.0f), idx0, xtable);
-				xtableWidth = Max(xtableWidth, xtable[idx0].size());
-			}
+			PushDirectedCoord(xi1, ((startIncremental == isCounterclockwisesweep) ? 1.0f : -1.0f), idx0, band);
 			if (startIncremental)
 			{
 				idx0++;
@@ -365,6 +400,17 @@ namespace graphics
 		}
 		if (startIncremental != endIncremental)
 		{
+			if (endIncremental)
+			{
+				idx0 = Max(idx0, band.rowBegin);
+				idx1 = Min(idx1, band.rowEnd - 1);
+			}
+			else
+			{
+				idx0 = Min(idx0, band.rowEnd - 1);
+				idx1 = Max(idx1, band.rowBegin);
+			}
+			scan = (float32)band.start + idx0 * dy + dy - cy;
 			while (true)
 			{
 				if (endIncremental && idx0 > idx1
@@ -377,11 +423,7 @@ namespace graphics
 					d = sqrt(d);
 					if(endIncremental) xi1 = (-d - b)*ar + cx;
 					else xi1 = (d - b)*ar + cx;
-					if (idx0 >= 0 && idx0 < xtableHeight)
-					{
-						PushDirectedCoord(xi1, ((endIncremental == isCounterclockwisesweep) ? 1.0f : -1.0f), idx0, xtable);
-						xtableWidth = Max(xtableWidth, xtable[idx0].size());
-					}
+					PushDirectedCoord(xi1, ((endIncremental == isCounterclockwisesweep) ? 1.0f : -1.0f), idx0, band);
 				}
 				if (endIncremental)
 				{
@@ -396,6 +438,205 @@ namespace graphics
 			}
 		}
 	}
+	void Geometry::CollectCrossings(
+		float32 *pathData,
+		float32 *x,
+		float32 *y,
+		ScanBand &band) const
+	{
+		// Segments entirely outside of the band (with a one pixel margin) are skipped
+		float32 bandTop = (float32)band.start + band.rowBegin * 0.125f - 1.0f,
+			bandBottom = (float32)band.start + band.rowEnd * 0.125f + 1.0f;
+		band.crossings.clear();
+		band.crossings.reserve(2 * (band.rowEnd - band.rowBegin));
+		Vector2f p0, p1, p2;
+		p0.x = x[0];
+		p0.y = y[0];
+		uint32 pathOffset = 3, pointIndex = 1;
+		for (uint32 i = 1; i < fillPath.count; i++)
+		{
+			if (Reinterpret<uint32>(pathData[pathOffset]) == GeometryPath::geometryTypeLine)
+			{
+				p1.x = x[pointIndex];
+				p1.y = y[pointIndex];
+				if (p0.y != p1.y
+					&& Max(p0.y, p1.y) >= bandTop && Min(p0.y, p1.y) <= bandBottom)
+					AdvanceLine(p0, p1, band);
+				p0 = p1;
+				pathOffset += 3;
+				pointIndex++;
+			}
+			else if (Reinterpret<uint32>(pathData[pathOffset]) == GeometryPath::geometryTypeQuadraticBezier)
+			{
+				p1.x = x[pointIndex];
+				p1.y = y[pointIndex];
+				p2.x = x[pointIndex + 1];
+				p2.y = y[pointIndex + 1];
+				if (Max(p0.y, p1.y, p2.y) >= bandTop && Min(p0.y, p1.y, p2.y) <= bandBottom)
+					AdvanceBezier(p0, p1, p2, band);
+				p0 = p2;
+				pathOffset += 5;
+				pointIndex += 2;
+			}
+			else if (Reinterpret<uint32>(pathData[pathOffset]) == GeometryPath::geometryTypeMove)
+			{
+				p0.x = x[pointIndex];
+				p0.y = y[pointIndex];
+				pathOffset += 3;
+				pointIndex++;
+			}
+			else
+			{
+				Vector2f p0t = p0, p1t(x[pointIndex], y[pointIndex]);
+				float32 startAngle = pathData[pathOffset + 6], endAngle = pathData[pathOffset + 7];
+				p0 = p1t;
+				if (Reinterpret<uint32>(pathData[pathOffset + 8]) == 0)
+				{
+					Swap(p0t, p1t);
+					Swap(startAngle, endAngle);
+				}
+				float32 radius = Max(pathData[pathOffset + 1], pathData[pathOffset + 2]);
+				if (pathData[pathOffset + 5] + radius >= bandTop
+					&& pathData[pathOffset + 5] - radius <= bandBottom)
+					AdvanceArc(
+						p0t,
+						p1t,
+						pathData[pathOffset + 4],
+						pathData[pathOffset + 5],
+						pathData[pathOffset + 1],
+						pathData[pathOffset + 2],
+						pathData[pathOffset + 3],
+						startAngle,
+						endAngle,
+						(Reinterpret<uint32>(pathData[pathOffset + 8]) == 0) ? false : true,
+						band);
+				pathOffset += 11;
+				pointIndex++;
+			}
+		}
+	}
+	void Geometry::SortCrossings(ScanBand &band) const
+	{
+		// Counting sort by scan row; rows receive crossings in reverse push order,
+		// so the stable row sort places the latest of equal crossings first
+		int32 rowCount = band.rowEnd - band.rowBegin;
+		band.rowOffsets.assign(rowCount + 1, 0);
+		band.pixelRows.assign(rowCount / 8, { 0, FLT_MAX, -FLT_MAX, 0 });
+		for (ScanCrossing &crossing : band.crossings)
+		{
+			band.rowOffsets[crossing.row + 1]++;
+			PixelRow &pixelRow = band.pixelRows[crossing.row / 8];
+			float32 x = abs(crossing.x) - 100000.0f;
+			pixelRow.xMin = Min(pixelRow.xMin, x);
+			pixelRow.xMax = Max(pixelRow.xMax, x);
+		}
+		for (int32 i = 0; i < rowCount; i++)
+		{
+			PixelRow &pixelRow = band.pixelRows[i / 8];
+			pixelRow.width = Max(pixelRow.width, (int32)band.rowOffsets[i + 1]);
+			band.rowOffsets[i + 1] += band.rowOffsets[i];
+		}
+		band.rowData.resize(band.crossings.size());
+		for (auto crossing = band.crossings.rbegin(); crossing != band.crossings.rend(); crossing++)
+			band.rowData[band.rowOffsets[crossing->row]++] = crossing->x;
+	}
+	uint32 Geometry::SplitStrips(std::vector<ScanBand> &bands, uint32 bandCount)
+	{
+		// Rows are grouped into strips of whole pixels, each padded only to its
+		// own widest row; a new strip starts once padding outweighs an extra draw
+		xtableStrips.clear();
+		xtableWidth = 0;
+		int32 pixel = 0;
+		for (uint32 i = 0; i < bandCount; i++)
+		{
+			for (PixelRow &pixelRow : bands[i].pixelRows)
+			{
+				XtableStrip *strip = xtableStrips.empty() ? nullptr : &xtableStrips.back();
+				if (strip != nullptr)
+				{
+					int32 width = Max(strip->width, pixelRow.width);
+					int32 padding = strip->height * (width - strip->width)
+						+ 8 * (width - pixelRow.width);
+					if (padding > stripOverhead) strip = nullptr;
+				}
+				if (strip == nullptr)
+				{
+					xtableStrips.push_back({ 8 * pixel, 0, 0, 0, FLT_MAX, -FLT_MAX });
+					strip = &xtableStrips.back();
+				}
+				strip->height += 8;
+				strip->width = Max(strip->width, pixelRow.width);
+				strip->xMin = Min(strip->xMin, pixelRow.xMin);
+				strip->xMax = Max(strip->xMax, pixelRow.xMax);
+				pixelRow.strip = (uint32)xtableStrips.size() - 1;
+				pixel++;
+			}
+		}
+		uint32 offset = 0;
+		for (XtableStrip &strip : xtableStrips)
+		{
+			strip.offset = offset;
+			strip.xMin = floor(strip.xMin);
+			strip.xMax = ceil(strip.xMax);
+			if (!packedXtable) offset += strip.width * strip.height;
+			else if (strip.width != 0)
+			{
+				strip.width += strip.width & 1;
+				offset += 1 + strip.width * strip.height / 2;
+			}
+			xtableWidth = Max(xtableWidth, strip.width);
+		}
+		return offset;
+	}
+	static uint16 PackCrossing(float32 crossing, float32 origin)
+	{
+		float32 x = round((abs(crossing) - 100000.0f - origin) * 16.0f);
+		uint16 packed = (uint16)Min(Max(x, 0.0f), 32766.0f);
+		return crossing < 0.0f ? (uint16)(packed | 0x8000) : packed;
+	}
+	void Geometry::WriteXtable(ScanBand &band, float32 *mapped)
+	{
+		uint32 rowStart = 0;
+		for (int32 i = 0; i < band.rowEnd - band.rowBegin; i++)
+		{
+			float32 *row = band.rowData.data() + rowStart;
+			uint32 rowSize = band.rowOffsets[i] - rowStart;
+			rowStart = band.rowOffsets[i];
+			XtableStrip &strip = xtableStrips[band.pixelRows[i / 8].strip];
+			if (strip.width == 0) continue;
+			if (rowSize > 16)
+				std::stable_sort(row, row + rowSize, [](float32 a, float32 b) { return abs(a) > abs(b); });
+			else
+			{
+				for (uint32 j = 1; j < rowSize; j++)
+				{
+					float32 x = row[j];
+					uint32 k = j;
+					while (k > 0 && abs(row[k - 1]) < abs(x))
+					{
+						row[k] = row[k - 1];
+						k--;
+					}
+					row[k] = x;
+				}
+			}
+			if (packedXtable)
+			{
+				uint16 *dst = (uint16 *)(mapped + strip.offset + 1)
+					+ strip.width * (band.rowBegin + i - strip.start);
+				for (uint32 j = rowSize; j < (uint32)strip.width; j++)
+					*dst++ = packedPadding;
+				for (uint32 j = 0; j < rowSize; j++)
+					*dst++ = PackCrossing(row[j], xMin);
+				continue;
+			}
+			float32 *dst = mapped + strip.offset
+				+ strip.width * (band.rowBegin + i - strip.start);
+			for (uint32 j = rowSize; j < (uint32)strip.width; j++)
+				*dst++ = FLT_MAX;
+			memcpy(dst, row, rowSize * sizeof(float32));
+		}
+	}
 	void Geometry::GetTangent(
 		Vector2f p0,
 		Vector2f p1,
@@ -441,111 +682,176 @@ namespace graphics
 			ready = false;
 		}
 	}
-	bool Geometry::Prepare()
+	uint32 Geometry::BuildXtable(std::vector<ScanBand> &bands, uint32 maxBands, uint32 *bandCount)
 	{
-		if (fillPath.count < 2) return false;
-		std::vector<float32> pathData = fillPath.data;
-		xMin = FLT_MAX;
-		xMax = -FLT_MAX;
-		yMin = FLT_MAX;
-		yMax = -FLT_MAX;
-		TransformGeometry(pathData.data(), fillPath.count);
-		xMin = floor(xMin);
-		xMax = ceil(xMax);
-		yMin = floor(yMin);
-		yMax = ceil(yMax);
+		*bandCount = 0;
+		static thread_local std::vector<float32> pathData, pointX, pointY;
+		pathData.assign(fillPath.data.begin(), fillPath.data.end());
+		pointX.resize(fillPath.pointX.size());
+		pointY.resize(fillPath.pointY.size());
+		float32 bounds[4];
+		TransformGeometry(transform, pathData.data(), pointX.data(), pointY.data(), bounds);
+		xMin = floor(bounds[0]);
+		xMax = ceil(bounds[1]);
+		yMin = floor(bounds[2]);
+		yMax = ceil(bounds[3]);
 
-		std::vector<std::vector<float32>> xtable(8 * (uint32)(yMax - yMin));
-		Vector2f p0, p1, p2;
-		p0.x = pathData[1];
-		p0.y = pathData[2];
 		xtableStart = (int32)yMin;
 		xtableHeight = 8 * (int32)(yMax - yMin);
 		xtableWidth = 0;
-		uint32 pathOffset = 3;
-		for (uint32 i = 1; i < fillPath.count; i++)
+		packedXtable = packedXtableEnabled && xMax - xMin < (float32)packedExtent;
+		if (xtableHeight == 0)
+			return 0;
+
+		// Tall geometries are split into horizontal bands processed in parallel
+		uint32 count = Min(Max((uint32)(xtableHeight / bandRows), 1u), Max(maxBands, 1u));
+		if (bands.size() < count) bands.resize(count);
+		int32 rowsPerBand = 8 * ((xtableHeight / 8 + count - 1) / count);
+		for (uint32 i = 0; i < count; i++)
 		{
-			if (Reinterpret<uint32>(pathData[pathOffset]) == GeometryPath::geometryTypeLine)
-			{
-				p1.x = pathData[pathOffset + 1];
-				p1.y = pathData[pathOffset + 2];
-				if (p0.y != p1.y)
-					AdvanceLine(p0, p1, xtable);
-				p0 = p1;
-				pathOffset += 3;
-			}
-			else if (Reinterpret<uint32>(pathData[pathOffset]) == GeometryPath::geometryTypeQuadraticBezier)
-			{
-				p1.x = pathData[pathOffset + 1];
-				p1.y = pathData[pathOffset + 2];
-				p2.x = pathData[pathOffset + 3];
-				p2.y = pathData[pathOffset + 4];
-				AdvanceBezier(p0, p1, p2, xtable);
-				p0 = p2;
-				pathOffset += 5;
-			}
-			else if (Reinterpret<uint32>(pathData[pathOffset]) == GeometryPath::geometryTypeMove)
-			{
-				p0.x = pathData[pathOffset + 1];
-				p0.y = pathData[pathOffset + 2];
-				pathOffset += 3;
-			}
-			else
-			{
-				Vector2f p0t = p0, p1t(pathData[pathOffset + 9], pathData[pathOffset + 10]);
-				float32 startAngle = pathData[pathOffset + 6], endAngle = pathData[pathOffset + 7];
-				p0 = p1t;
-				if (Reinterpret<uint32>(pathData[pathOffset + 8]) == 0)
-				{
-					Swap(p0t, p1t);
-					Swap(startAngle, endAngle);
-				}
-				AdvanceArc(
-					p0t,
-					p1t,
-					pathData[pathOffset + 4],
-					pathData[pathOffset + 5],
-					pathData[pathOffset + 1],
-					pathData[pathOffset + 2],
-					pathData[pathOffset + 3],
-					startAngle,
-					endAngle,
-					(Reinterpret<uint32>(pathData[pathOffset + 8]) == 0) ? false : true,
-					xtable);
-				pathOffset += 11;
-			}
+			bands[i].start = xtableStart;
+			bands[i].rowBegin = Min((int32)i * rowsPerBand, xtableHeight);
+			bands[i].rowEnd = Min((int32)(i + 1) * rowsPerBand, xtableHeight);
 		}
-
-		if (xtableWidth == 0 || xtableHeight == 0)
+		// Worker threads have their own thread_local instances, so the bands
+		// and transformed points are reached through pointers taken on this thread
+		ScanBand *bandData = bands.data();
+		float32 *data = pathData.data(), *x = pointX.data(), *y = pointY.data();
+		auto collectBand = [&](uint32 i)
+		{
+			CollectCrossings(data, x, y, bandData[i]);
+			SortCrossings(bandData[i]);
+		};
+		if (count == 1) collectBand(0);
+		else concurrency::parallel_for(0u, count, collectBand);
+		uint32 xtableSize = SplitStrips(bands, count);
+		if (xtableWidth == 0)
+			return 0;
+		*bandCount = count;
+		return xtableSize;
+	}
+	bool Geometry::Prepare()
+	{
+		if (fillPath.count < 2) return false;
+		static thread_local std::vector<ScanBand> bands;
+		uint32 bandCount;
+		uint32 xtableSize = BuildXtable(
+			bands,
+			Max(std::thread::hardware_concurrency(), 1u),
+			&bandCount);
+		if (xtableSize == 0)
 			return false;
+		ScanBand *bandData = bands.data();
+
 		GpuDevice *device;
 		QueryGpuDevice(&device);
-		xtableOffset = device->AllocateMemory(
-			xtableWidth*xtableHeight * sizeof(float32));
+		xtableOffset = device->AllocateMemory(xtableSize * sizeof(float32));
+		if (xtableOffset == UINT32_MAX)
+			return false;
 		void *mapped;
 		device->MapMemory(
 			xtableOffset,
-			xtableWidth*xtableHeight * sizeof(float32),
+			xtableSize * sizeof(float32),
 			&mapped);
-		for (uint32 i = 0; i < xtable.size(); i++)
+		if (packedXtable)
 		{
-			while (xtable[i].size() < xtableWidth)
-				xtable[i].insert(xtable[i].begin(), FLT_MAX);
-			memcpy(
-				(float32 *)mapped + xtableWidth * i,
-				xtable[i].data(),
-				xtableWidth * sizeof(float32));
+			for (XtableStrip &strip : xtableStrips)
+			{
+				if (strip.width != 0) ((float32 *)mapped)[strip.offset] = xMin;
+			}
 		}
+		auto writeBand = [&](uint32 i) { WriteXtable(bandData[i], (float32 *)mapped); };
+		if (bandCount == 1) writeBand(0);
+		else concurrency::parallel_for(0u, bandCount, writeBand);
 		device->UnmapMemory();
 
 		ready = true;
 		return true;
 	}
+	bool Geometry::RasterizeCoverage(
+		float32 offsetX,
+		float32 offsetY,
+		int32 *left,
+		int32 *top,
+		uint32 *width,
+		uint32 *height,
+		std::vector<uint8> *coverage) const
+	{
+		// Same crossings as the xtable, accumulated on the CPU into 8 subscanlines
+		// of horizontal coverage per pixel
+		*width = 0;
+		*height = 0;
+		if (fillPath.count < 2) return false;
+		// The shader samples the xtable at the pixel position times decay
+		Matrix3x2f matrix = transform;
+		for (uint32 i = 0; i < 3; i++)
+		{
+			matrix[i][0] /= decay.x;
+			matrix[i][1] /= decay.y;
+		}
+		matrix[2][0] += offsetX;
+		matrix[2][1] += offsetY;
+		std::vector<float32> pathData(fillPath.data.begin(), fillPath.data.end()),
+			pointX(fillPath.pointX.size()),
+			pointY(fillPath.pointY.size());
+		float32 bounds[4];
+		TransformGeometry(matrix, pathData.data(), pointX.data(), pointY.data(), bounds);
+		int32 x0 = (int32)floor(bounds[0]), x1 = (int32)ceil(bounds[1]),
+			y0 = (int32)floor(bounds[2]), y1 = (int32)ceil(bounds[3]);
+		if (x1 <= x0 || y1 <= y0) return false;
+		ScanBand band;
+		band.start = y0;
+		band.rowBegin = 0;
+		band.rowEnd = 8 * (y1 - y0);
+		CollectCrossings(pathData.data(), pointX.data(), pointY.data(), band);
+		SortCrossings(band);
+
+		uint32 w = (uint32)(x1 - x0), h = (uint32)(y1 - y0);
+		std::vector<float32> accumulated(w * h, 0.0f), row;
+		uint32 rowStart = 0;
+		for (int32 r = 0; r < band.rowEnd; r++)
+		{
+			row.assign(band.rowData.begin() + rowStart, band.rowData.begin() + band.rowOffsets[r]);
+			rowStart = band.rowOffsets[r];
+			std::sort(row.begin(), row.end(), [](float32 a, float32 b) { return abs(a) < abs(b); });
+			float32 *pixels = accumulated.data() + (r / 8) * w;
+			int32 winding = 0;
+			for (uint32 i = 0; i + 1 < row.size(); i++)
+			{
+				// Filled where the shader's polarity is positive
+				winding += row[i] > 0.0f ? 1 : -1;
+				if (winding <= 0) continue;
+				float32 a = Max(abs(row[i]) - 100000.0f - (float32)x0, 0.0f),
+					b = Min(abs(row[i + 1]) - 100000.0f - (float32)x0, (float32)w);
+				if (b <= a) continue;
+				uint32 pa = (uint32)a, pb = (uint32)b;
+				if (pa == pb)
+				{
+					pixels[pa] += (b - a) * 0.125f;
+					continue;
+				}
+				pixels[pa] += ((float32)(pa + 1) - a) * 0.125f;
+				for (uint32 p = pa + 1; p < pb; p++)
+					pixels[p] += 0.125f;
+				if (pb < w) pixels[pb] += (b - (float32)pb) * 0.125f;
+			}
+		}
+		coverage->resize(w * h);
+		for (uint32 i = 0; i < w * h; i++)
+			(*coverage)[i] = (uint8)(Min(accumulated[i], 1.0f) * 255.0f + 0.5f);
+		*left = x0;
+		*top = y0;
+		*width = w;
+		*height = h;
+		return true;
+	}
 	Geometry::Geometry()
 	{
 		isCounterclockwiseFace = true;
 		MatrixSetIdentity(&transform);
 		decay = 1.0f;
+		packedXtableEnabled = false;
+		packedXtable = false;
 		ready = false;
 	}
 	Geometry::~Geometry()
@@ -582,6 +888,18 @@ namespace graphics
 		*xRatio = decay.x;
 		*yRatio = decay.y;
 	}
+	void Geometry::EnablePackedXtable(bool value)
+	{
+		if (packedXtableEnabled != value)
+		{
+			Reset();
+			packedXtableEnabled = value;
+		}
+	}
+	bool Geometry::IsPackedXtableEnabled()
+	{
+		return packedXtableEnabled;
+	}
 	void Geometry::Offset(float32 offset)
 	{
 
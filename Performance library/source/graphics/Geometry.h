@@ -12,7 +12,49 @@ namespace graphics
 	class Geometry
 	{
 		friend class gpu::RenderTarget;
+		friend class GlyphAtlas;
 	protected:
+		struct ScanCrossing
+		{
+			int32 row;
+			float32 x;
+		};
+		struct PixelRow
+		{
+			int32 width;
+			float32 xMin;
+			float32 xMax;
+			uint32 strip;
+		};
+		struct ScanBand
+		{
+			// Pixel row that scan rows are counted from
+			int32 start;
+			int32 rowBegin;
+			int32 rowEnd;
+			std::vector<ScanCrossing> crossings;
+			std::vector<uint32> rowOffsets;
+			std::vector<float32> rowData;
+			std::vector<PixelRow> pixelRows;
+		};
+		struct XtableStrip
+		{
+			int32 start;
+			int32 height;
+			int32 width;
+			uint32 offset;
+			float32 xMin;
+			float32 xMax;
+		};
+		// Scan rows (128 pixels) a band holds at least; the last band of a
+		// geometry may fall a few rows short
+		static const int32 bandRows = 1024;
+		// Padding (in crossings) that is worth an extra draw of a separate strip
+		static const int32 stripOverhead = 256;
+		// Packed crossings are 11.4 fixed point above the geometry's xMin
+		static const int32 packedExtent = 2048;
+		static const uint16 packedPadding = 0x7FFF;
+
 		GeometryPath fillPath;
 		bool isCounterclockwiseFace;
 		Matrix3x2f transform;
@@ -25,6 +67,11 @@ namespace graphics
 		int32 xtableWidth;
 		int32 xtableHeight;
 		uint32 xtableOffset;
+		std::vector<XtableStrip> xtableStrips;
+		bool packedXtableEnabled;
+		// Chosen by Prepare; rows then hold two 16-bit crossings per word
+		// after an origin word at the start of each strip
+		bool packedXtable;
 		bool ready;
 
 		void ConvertArc(
@@ -38,29 +85,36 @@ namespace graphics
 			float32 &cx,
 			float32 &cy,
 			float32 &startAngle,
-			float32 &endAngle);
+			float32 &endAngle) const;
 		Vector2f Bezier2(
 			Vector2f p0,
 			Vector2f p1,
 			Vector2f p2,
-			float32 t);
-		void AdjustVertical(float32 *y);
-		void TransformPoint(float32 *point);
-		void TransformGeometry(float32 *data, uint32 count);
+			float32 t) const;
+		void AdjustVertical(float32 *y) const;
+		void TransformPoint(Matrix3x2f &matrix, float32 *point) const;
+		// Transforms fillPath by matrix into data, x and y; bounds receives
+		// { xMin, xMax, yMin, yMax } of the result
+		void TransformGeometry(
+			Matrix3x2f matrix,
+			float32 *data,
+			float32 *x,
+			float32 *y,
+			float32 *bounds) const;
 		void PushDirectedCoord(
 			float32 x,
 			float32 xTangent,
 			int32 scanRow,
-			std::vector<std::vector<float32>> &xtable);
+			ScanBand &band) const;
 		void AdvanceLine(
 			Vector2f p0,
 			Vector2f p1,
-			std::vector<std::vector<float32>> &xtable);
+			ScanBand &band) const;
 		void AdvanceBezier(
 			Vector2f p0,
 			Vector2f p1,
 			Vector2f p2,
-			std::vector<std::vector<float32>> &xtable);
+			ScanBand &band) const;
 		void AdvanceArc(
 			Vector2f p0,
 			Vector2f p1,
@@ -72,7 +126,19 @@ namespace graphics
 			float32 startAngle,
 			float32 endAngle,
 			bool isCounterclockwisesweep,
-			std::vector<std::vector<float32>> &scanline);
+			ScanBand &band) const;
+		void CollectCrossings(
+			float32 *pathData,
+			float32 *x,
+			float32 *y,
+			ScanBand &band) const;
+		void SortCrossings(ScanBand &band) const;
+		// Returns the xtable size in words
+		uint32 SplitStrips(std::vector<ScanBand> &bands, uint32 bandCount);
+		void WriteXtable(ScanBand &band, float32 *mapped);
+		// Fills up to maxBands bands and lays out the strips; returns the
+		// xtable size in words, zero when there is nothing to draw
+		uint32 BuildXtable(std::vector<ScanBand> &bands, uint32 maxBands, uint32 *bandCount);
 		void GetTangent(
 			Vector2f p0,
 			Vector2f p1,
@@ -89,6 +155,16 @@ namespace graphics
 			Vector2f *joint);
 		void Reset();
 		bool Prepare();
+		// Coverage of the geometry as drawn by RenderGeometry at (offsetX, offsetY),
+		// transform and decay included; prepared GPU state is not used
+		bool RasterizeCoverage(
+			float32 offsetX,
+			float32 offsetY,
+			int32 *left,
+			int32 *top,
+			uint32 *width,
+			uint32 *height,
+			std::vector<uint8> *coverage) const;
 		Geometry(Geometry &) {}
 	public:
 		Geometry();
@@ -99,6 +175,11 @@ namespace graphics
 		Matrix3x2f GetTransform();
 		void SetDecay(float32 xRatio, float32 yRatio);
 		void GetDecay(float32 *xRatio, float32 *yRatio);
+		// Off by default. Geometries narrower than 2048 pixels then store their
+		// crossings in 16 bits with 1/16 pixel precision, which halves their
+		// storage and the fetches per pixel
+		void EnablePackedXtable(bool value);
+		bool IsPackedXtableEnabled();
 		void Offset(float32 offset);
 		void DrawLine(
 			Vector2f a,
@@ -8,6 +8,7 @@ namespace graphics
 	GeometryPath::GeometryPath()
 	{
 		count = 0;
+		arcCount = 0;
 	}
 	bool GeometryPath::IsEmpty()
 	{
@@ -17,24 +18,32 @@ namespace graphics
 	{
 		return Vector2f(data[data.size() - 2], data[data.size() - 1]);
 	}
+	void GeometryPath::PushPoint(Vector2f point)
+	{
+		data.push_back(point.x);
+		data.push_back(point.y);
+		pointX.push_back(point.x);
+		pointY.push_back(point.y);
+	}
 	void GeometryPath::Reset()
 	{
 		data.clear();
+		pointX.clear();
+		pointY.clear();
 		count = 0;
+		arcCount = 0;
 	}
 	void GeometryPath::Move(Vector2f controlPoint)
 	{
 		data.push_back(Reinterpret<float32>(uint32(geometryTypeMove)));
-		data.push_back(controlPoint.x);
-		data.push_back(controlPoint.y);
+		PushPoint(controlPoint);
 		count++;
 	}
 	void GeometryPath::PushLine(Vector2f controlPoint)
 	{
 		if (controlPoint == LastPoint()) return;
 		data.push_back(Reinterpret<float32>(uint32(geometryTypeLine)));
-		data.push_back(controlPoint.x);
-		data.push_back(controlPoint.y);
+		PushPoint(controlPoint);
 		count++;
 	}
 	void GeometryPath::PushQuadraticBezier(
@@ -52,10 +61,8 @@ namespace graphics
 			return;
 		}
 		data.push_back(Reinterpret<float32>(uint32(geometryTypeQuadraticBezier)));
-		data.push_back(controlPoint1.x);
-		data.push_back(controlPoint1.y);
-		data.push_back(controlPoint2.x);
-		data.push_back(controlPoint2.y);
+		PushPoint(controlPoint1);
+		PushPoint(controlPoint2);
 		count++;
 	}
 	void GeometryPath::PushCubicBezier(
@@ -100,14 +107,17 @@ namespace graphics
 		if (isCounterclockwiseSweep) data.push_back(Reinterpret<float32>(1));
 		else data.push_back(Reinterpret<float32>(0));
 		data.push_back(data[data.size() - 1]);
-		data.push_back(controlPoint.x);
-		data.push_back(controlPoint.y);
+		PushPoint(controlPoint);
 
 		count++;
+		arcCount++;
 	}
 	void GeometryPath::Append(GeometryPath &path)
 	{
 		data.insert(data.end(), path.data.begin(), path.data.end());
+		pointX.insert(pointX.end(), path.pointX.begin(), path.pointX.end());
+		pointY.insert(pointY.end(), path.pointY.begin(), path.pointY.end());
 		count += path.count;
+		arcCount += path.arcCount;
 	}
 }
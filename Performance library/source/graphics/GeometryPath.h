@@ -19,7 +19,13 @@ namespace graphics
 		static const uint32 geometryTypeMove = 3;
 
 		std::vector<float32> data;
+		// Structure-of-arrays copy of every point in data, in path order
+		std::vector<float32> pointX;
+		std::vector<float32> pointY;
 		uint32 count;
+		uint32 arcCount;
+
+		void PushPoint(Vector2f point);
 
 		Vector2f LastPoint();
 	public:
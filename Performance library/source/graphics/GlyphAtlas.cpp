@@ -0,0 +1,198 @@
+// Copyright (c) 2017-2018, Roman Shkurdalov
+// This file is under The Clear BSD License, see LICENSE.txt
+
+#include "graphics\GlyphAtlas.h"
+#include "gpu\RenderTarget.h"
+#include "gpu\Bitmap.h"
+
+namespace graphics
+{
+	bool GlyphAtlas::GlyphKey::operator==(const GlyphKey &key) const
+	{
+		return code == key.code
+			&& font == key.font
+			&& subpixel == key.subpixel;
+	}
+	size_t GlyphAtlas::GlyphKeyHash::operator()(const GlyphKey &key) const
+	{
+		size_t hash = std::hash<FontMetadata *>()(key.font);
+		hash ^= (size_t)key.code * 0x9E3779B1u + (hash << 6) + (hash >> 2);
+		hash ^= (size_t)key.subpixel * 0x85EBCA77u + (hash << 6) + (hash >> 2);
+		return hash;
+	}
+	GlyphAtlas::GlyphAtlas(RenderTarget *renderTarget, Bitmap *bitmap)
+	{
+		this->renderTarget = renderTarget;
+		bitmap->AddRef();
+		this->bitmap = bitmap;
+		shelfTop = 0;
+	}
+	GlyphAtlas::~GlyphAtlas()
+	{
+		bitmap->Unref();
+	}
+	bool GlyphAtlas::AllocateSpan(Shelf &shelf, uint32 width, uint32 *x)
+	{
+		for (uint32 i = 0; i < shelf.freeSpans.size(); i++)
+		{
+			FreeSpan &span = shelf.freeSpans[i];
+			if (span.width < width) continue;
+			*x = span.x;
+			span.x += width;
+			span.width -= width;
+			if (span.width == 0) shelf.freeSpans.erase(shelf.freeSpans.begin() + i);
+			shelf.glyphCount++;
+			return true;
+		}
+		return false;
+	}
+	void GlyphAtlas::ReleaseSpan(Shelf &shelf, uint32 x, uint32 width)
+	{
+		if (--shelf.glyphCount == 0)
+		{
+			shelf.freeSpans.assign(1, { 0, atlasSize });
+			return;
+		}
+		// Spans are kept sorted by x and merged with their neighbours
+		uint32 i = 0;
+		while (i < shelf.freeSpans.size() && shelf.freeSpans[i].x < x) i++;
+		shelf.freeSpans.insert(shelf.freeSpans.begin() + i, { x, width });
+		if (i + 1 < shelf.freeSpans.size()
+			&& shelf.freeSpans[i].x + shelf.freeSpans[i].width == shelf.freeSpans[i + 1].x)
+		{
+			shelf.freeSpans[i].width += shelf.freeSpans[i + 1].width;
+			shelf.freeSpans.erase(shelf.freeSpans.begin() + i + 1);
+		}
+		if (i != 0
+			&& shelf.freeSpans[i - 1].x + shelf.freeSpans[i - 1].width == shelf.freeSpans[i].x)
+		{
+			shelf.freeSpans[i - 1].width += shelf.freeSpans[i].width;
+			shelf.freeSpans.erase(shelf.freeSpans.begin() + i);
+		}
+	}
+	bool GlyphAtlas::Allocate(uint32 width, uint32 height, uint32 *shelf, uint32 *x)
+	{
+		uint32 shelfHeight = (height + shelfGranularity - 1) / shelfGranularity * shelfGranularity;
+		// Shelves of about the glyph's height first, then empty ones of any
+		// larger height, then a new shelf at the top
+		for (uint32 i = 0; i < shelves.size(); i++)
+		{
+			if (shelves[i].height >= height
+				&& (shelves[i].height == shelfHeight || shelves[i].glyphCount == 0)
+				&& AllocateSpan(shelves[i], width, x))
+			{
+				*shelf = i;
+				return true;
+			}
+		}
+		if (shelfTop + shelfHeight > atlasSize) return false;
+		shelves.push_back({ shelfTop, shelfHeight, 0, { { 0, atlasSize } } });
+		shelfTop += shelfHeight;
+		*shelf = (uint32)shelves.size() - 1;
+		return AllocateSpan(shelves.back(), width, x);
+	}
+	bool GlyphAtlas::EvictOldest()
+	{
+		if (lru.empty()) return false;
+		auto iter = glyphs.find(lru.back());
+		GlyphEntry &entry = iter->second;
+		if (entry.frame > renderTarget->GetCompletedFrame()) return false;
+		if (entry.width != 0)
+		{
+			ReleaseSpan(shelves[entry.shelf], entry.x, entry.width + 1);
+			while (!shelves.empty() && shelves.back().glyphCount == 0)
+			{
+				shelfTop = shelves.back().y;
+				shelves.pop_back();
+			}
+		}
+		glyphs.erase(iter);
+		lru.pop_back();
+		return true;
+	}
+	GlyphAtlas::GlyphEntry *GlyphAtlas::Insert(GlyphKey &key, CharMetadata *charMetadata)
+	{
+		GlyphEntry entry;
+		std::vector<uint8> coverage;
+		if (!charMetadata->outline.RasterizeCoverage(
+			(float32)key.subpixel / (float32)subpixelSteps,
+			0.0f,
+			&entry.left,
+			&entry.top,
+			&entry.width,
+			&entry.height,
+			&coverage))
+		{
+			entry.width = 0;
+			entry.height = 0;
+		}
+		else if (entry.width + 1 > atlasSize / 4 || entry.height + 1 > atlasSize / 4)
+			return nullptr;
+
+		if (entry.width != 0)
+		{
+			// One transparent column and row of padding keep filtered samples
+			// from reaching the neighbouring glyphs
+			if (!Allocate(entry.width + 1, entry.height + 1, &entry.shelf, &entry.x))
+			{
+				renderTarget->UpdateCompletedFrames();
+				do
+				{
+					if (!EvictOldest()) return nullptr;
+				} while (!Allocate(entry.width + 1, entry.height + 1, &entry.shelf, &entry.x));
+			}
+			void *mapped;
+			bitmap->MapRows(shelves[entry.shelf].y, entry.height + 1, &mapped);
+			for (uint32 row = 0; row <= entry.height; row++)
+			{
+				Color *texel = (Color *)mapped + row * atlasSize + entry.x;
+				for (uint32 column = 0; column <= entry.width; column++, texel++)
+				{
+					*texel = Color(255, 255, 255, row < entry.height && column < entry.width
+						? coverage[row * entry.width + column] : 0);
+				}
+			}
+			bitmap->UnmapMempory();
+		}
+		lru.push_front(key);
+		entry.lru = lru.begin();
+		return &(glyphs[key] = entry);
+	}
+	bool GlyphAtlas::DrawGlyph(
+		char32 code,
+		FontMetadata *font,
+		CharMetadata *charMetadata,
+		Color color,
+		float32 x,
+		float32 y)
+	{
+		float32 penX = floor(x), penY = round(y);
+		GlyphKey key;
+		key.code = code;
+		key.font = font;
+		key.subpixel = Min((uint32)((x - penX) * (float32)subpixelSteps), subpixelSteps - 1);
+		GlyphEntry *entry;
+		auto iter = glyphs.find(key);
+		if (iter == glyphs.end())
+		{
+			entry = Insert(key, charMetadata);
+			if (entry == nullptr) return false;
+		}
+		else
+		{
+			entry = &iter->second;
+			lru.splice(lru.begin(), lru, entry->lru);
+		}
+		entry->frame = renderTarget->GetCurrentFrame();
+		if (entry->width == 0) return true;
+
+		float32 left = penX + (float32)entry->left, top = penY + (float32)entry->top;
+		renderTarget->SetCoverageBrush(
+			bitmap,
+			left - (float32)entry->x,
+			top - (float32)shelves[entry->shelf].y,
+			color);
+		renderTarget->FillRectangle(left, top, (float32)entry->width, (float32)entry->height);
+		return true;
+	}
+}
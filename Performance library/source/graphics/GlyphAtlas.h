@@ -0,0 +1,90 @@
+// Copyright (c) 2017-2018, Roman Shkurdalov
+// This file is under The Clear BSD License, see LICENSE.txt
+
+#pragma once
+#include "kernel\kernel.h"
+#include "graphics\Font.h"
+#include "graphics\Color.h"
+#include <vector>
+#include <list>
+#include <unordered_map>
+
+namespace graphics
+{
+	// Coverage of small glyphs rasterized once per subpixel offset into the alpha
+	// of a shared bitmap, so they are drawn as textured quads tinted by a coverage
+	// brush instead of by xtable lookups; every color shares the same texels.
+	// Owned by a render target, see RenderTarget::GetGlyphAtlas
+	class GlyphAtlas
+	{
+		friend class gpu::RenderTarget;
+	protected:
+		static const uint32 atlasSize = 1024;
+		static const uint32 subpixelSteps = 4;
+		// Shelf heights are rounded up to this many rows
+		static const uint32 shelfGranularity = 4;
+		struct GlyphKey
+		{
+			char32 code;
+			FontMetadata *font;
+			uint32 subpixel;
+			bool operator==(const GlyphKey &key) const;
+		};
+		struct GlyphKeyHash
+		{
+			size_t operator()(const GlyphKey &key) const;
+		};
+		struct GlyphEntry
+		{
+			uint32 shelf;
+			uint32 x;
+			uint32 width;
+			uint32 height;
+			int32 left;
+			int32 top;
+			// Last frame that drew the glyph; its texels are only overwritten
+			// once that frame has completed
+			uint64 frame;
+			std::list<GlyphKey>::iterator lru;
+		};
+		struct FreeSpan
+		{
+			uint32 x;
+			uint32 width;
+		};
+		struct Shelf
+		{
+			uint32 y;
+			uint32 height;
+			uint32 glyphCount;
+			std::vector<FreeSpan> freeSpans;
+		};
+		RenderTarget *renderTarget;
+		Bitmap *bitmap;
+		std::unordered_map<GlyphKey, GlyphEntry, GlyphKeyHash> glyphs;
+		// Most recently drawn first
+		std::list<GlyphKey> lru;
+		std::vector<Shelf> shelves;
+		uint32 shelfTop;
+
+		GlyphAtlas(RenderTarget *renderTarget, Bitmap *bitmap);
+		~GlyphAtlas();
+		bool AllocateSpan(Shelf &shelf, uint32 width, uint32 *x);
+		void ReleaseSpan(Shelf &shelf, uint32 x, uint32 width);
+		bool Allocate(uint32 width, uint32 height, uint32 *shelf, uint32 *x);
+		bool EvictOldest();
+		GlyphEntry *Insert(GlyphKey &key, CharMetadata *charMetadata);
+	public:
+		// Fonts up to this size in pixels are drawn from the atlas
+		static const uint32 sizeThreshold = 24;
+		// Draws the glyph with its origin at (x, y); returns false when it does
+		// not fit in the atlas and must be rendered as geometry instead
+		bool DrawGlyph(
+			char32 code,
+			FontMetadata *font,
+			CharMetadata *charMetadata,
+			Color color,
+			float32 x,
+			float32 y);
+	};
+}
@@ -0,0 +1,158 @@
+// Copyright (c) 2017-2018, Roman Shkurdalov
+// This file is under The Clear BSD License, see LICENSE.txt
+
+#include "graphics\TextBuffer.h"
+#include "atc\StaticOperators.h"
+#include <iterator>
+
+namespace graphics
+{
+	TextBuffer::TextBuffer()
+	{
+		length = 0;
+		cachedChunk = 0;
+		cachedStart = 0;
+	}
+	void TextBuffer::RebuildTree()
+	{
+		chunkTree.assign(chunks.size(), 0);
+		for (uint32 i = 0; i < chunks.size(); i++)
+		{
+			chunkTree[i] += (uint32)chunks[i].size();
+			uint32 parent = i | (i + 1);
+			if (parent < chunkTree.size()) chunkTree[parent] += chunkTree[i];
+		}
+		cachedChunk = 0;
+		cachedStart = 0;
+	}
+	void TextBuffer::AddToTree(uint32 chunk, int32 delta)
+	{
+		for (; chunk < chunkTree.size(); chunk |= chunk + 1)
+			chunkTree[chunk] += delta;
+	}
+	void TextBuffer::Locate(uint32 idx, uint32 *chunk, uint32 *offset)
+	{
+		uint32 position = 0, start = idx, step = 1;
+		while (2 * step <= chunkTree.size()) step *= 2;
+		for (; step != 0; step /= 2)
+		{
+			if (position + step <= chunkTree.size() && chunkTree[position + step - 1] <= idx)
+			{
+				position += step;
+				idx -= chunkTree[position - 1];
+			}
+		}
+		*chunk = position;
+		*offset = idx;
+		cachedChunk = position;
+		cachedStart = start - idx;
+	}
+	uint32 TextBuffer::GetLength()
+	{
+		return length;
+	}
+	char32 TextBuffer::Get(uint32 idx)
+	{
+		if (idx - cachedStart >= chunks[cachedChunk].size())
+		{
+			uint32 next = cachedStart + (uint32)chunks[cachedChunk].size();
+			if (cachedChunk + 1 < chunks.size()
+				&& idx >= next
+				&& idx - next < chunks[cachedChunk + 1].size())
+			{
+				cachedChunk++;
+				cachedStart = next;
+			}
+			else
+			{
+				uint32 chunk, offset;
+				Locate(idx, &chunk, &offset);
+			}
+		}
+		return chunks[cachedChunk][idx - cachedStart];
+	}
+	void TextBuffer::Insert(uint32 idx, const char32 *text, uint32 count)
+	{
+		if (count == 0) return;
+		uint32 chunk, offset;
+		if (chunks.size() == 0)
+		{
+			chunks.emplace_back();
+			chunkTree.push_back(0);
+			chunk = 0;
+			offset = 0;
+		}
+		else if (idx == length)
+		{
+			chunk = (uint32)chunks.size() - 1;
+			offset = (uint32)chunks[chunk].size();
+		}
+		else Locate(idx, &chunk, &offset);
+		std::vector<char32> &target = chunks[chunk];
+		target.insert(target.begin() + offset, text, text + count);
+		length += count;
+		cachedChunk = 0;
+		cachedStart = 0;
+		if (target.size() <= 2 * chunkCapacity)
+		{
+			AddToTree(chunk, (int32)count);
+			return;
+		}
+		// Oversized chunks are cut into full ones
+		std::vector<std::vector<char32>> pieces;
+		for (uint32 i = 0; i < target.size(); i += chunkCapacity)
+			pieces.emplace_back(
+				target.begin() + i,
+				target.begin() + Min(i + chunkCapacity, (uint32)target.size()));
+		chunks.erase(chunks.begin() + chunk);
+		chunks.insert(
+			chunks.begin() + chunk,
+			std::make_move_iterator(pieces.begin()),
+			std::make_move_iterator(pieces.end()));
+		RebuildTree();
+	}
+	void TextBuffer::Erase(uint32 idxBegin, uint32 idxEnd)
+	{
+		if (idxBegin >= idxEnd) return;
+		uint32 first, offset, chunk, remaining = idxEnd - idxBegin;
+		Locate(idxBegin, &first, &offset);
+		chunk = first;
+		bool rebuild = false;
+		while (remaining != 0)
+		{
+			std::vector<char32> &source = chunks[chunk];
+			uint32 count = Min(remaining, (uint32)source.size() - offset);
+			source.erase(source.begin() + offset, source.begin() + offset + count);
+			remaining -= count;
+			offset = 0;
+			if (source.size() == 0)
+			{
+				chunks.erase(chunks.begin() + chunk);
+				rebuild = true;
+				continue;
+			}
+			if (!rebuild) AddToTree(chunk, -(int32)count);
+			chunk++;
+		}
+		length -= idxEnd - idxBegin;
+		// Chunks left small by the erase are merged with a neighbour
+		if (first != 0) first--;
+		for (uint32 i = first; i + 1 < Min(first + 3, (uint32)chunks.size()); i++)
+		{
+			if (chunks[i].size() + chunks[i + 1].size() > chunkCapacity) continue;
+			chunks[i].insert(chunks[i].end(), chunks[i + 1].begin(), chunks[i + 1].end());
+			chunks.erase(chunks.begin() + i + 1);
+			rebuild = true;
+			break;
+		}
+		if (rebuild) RebuildTree();
+		cachedChunk = 0;
+		cachedStart = 0;
+	}
+	void TextBuffer::Read(uint32 idxBegin, uint32 idxEnd, std::u32string *text)
+	{
+		text->reserve(text->size() + idxEnd - idxBegin);
+		while (idxBegin < idxEnd)
+			text->push_back(Get(idxBegin++));
+	}
+}
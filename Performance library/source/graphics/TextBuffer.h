@@ -0,0 +1,35 @@
+// Copyright (c) 2017-2018, Roman Shkurdalov
+// This file is under The Clear BSD License, see LICENSE.txt
+
+#pragma once
+#include "kernel\kernel.h"
+#include <vector>
+#include <string>
+
+namespace graphics
+{
+	// Code points split into chunks of bounded size, so edits move at most
+	// one chunk; a Fenwick tree over chunk lengths maps indices to chunks
+	class TextBuffer
+	{
+	protected:
+		static const uint32 chunkCapacity = 1024;
+		std::vector<std::vector<char32>> chunks;
+		std::vector<uint32> chunkTree;
+		uint32 length;
+		// Chunk of the last access, so sequential reads skip the tree
+		uint32 cachedChunk;
+		uint32 cachedStart;
+
+		void RebuildTree();
+		void AddToTree(uint32 chunk, int32 delta);
+		void Locate(uint32 idx, uint32 *chunk, uint32 *offset);
+	public:
+		TextBuffer();
+		uint32 GetLength();
+		char32 Get(uint32 idx);
+		void Insert(uint32 idx, const char32 *text, uint32 count);
+		void Erase(uint32 idxBegin, uint32 idxEnd);
+		void Read(uint32 idxBegin, uint32 idxEnd, std::u32string *text);
+	};
+}
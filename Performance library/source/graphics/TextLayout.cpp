@@ -2,7 +2,10 @@
 // This file is under The Clear BSD License, see LICENSE.txt
 
 #include "graphics\TextLayout.h"
+#include "graphics\GlyphAtlas.h"
 #include "gpu\RenderTarget.h"
+#include <map>
+#include <algorithm>
 
 namespace graphics
 {
@@ -16,107 +19,317 @@ namespace graphics
 		spacingMode = TextLineSpacingFontSize;
 		spacingArg = 0.0f;
 		metricsCalculated = false;
+		fullRelayout = true;
+		renderCacheValid = false;
+		measureValid = false;
 	}
-	float32 TextLayout::GetLinespace(TextObject *obj)
+	bool TextLayout::TextStyle::operator==(const TextStyle &style) const
+	{
+		return font == style.font
+			&& fontPointSize == style.fontPointSize
+			&& fontSize == style.fontSize
+			&& isItalic == style.isItalic
+			&& weight == style.weight
+			&& underlined == style.underlined
+			&& strikedthrough == style.strikedthrough
+			&& color.code == style.color.code;
+	}
+	float32 TextLayout::GetLinespace(TextStyle *style)
 	{
 		if (spacingMode == TextLineSpacingFontSize)
-			return obj->fontSize;
+			return style->fontSize;
 		else if (spacingMode == TextLineSpacingFontSizePlusArg)
-			return obj->fontSize + spacingArg;
+			return style->fontSize + spacingArg;
 		else if (spacingMode == TextLineSpacingFontSizeMulArg)
-			return obj->fontSize*spacingArg;
+			return style->fontSize*spacingArg;
 		else if (spacingMode == TextLineSpacingAscentPlusLineGap)
-			return (obj->font->ascent + obj->font->internalLeading);
+			return (style->font->ascent + style->font->internalLeading);
 		else return spacingArg;
 	}
+	uint32 TextLayout::FindRun(uint32 idx)
+	{
+		return (uint32)(std::upper_bound(
+			runs.begin(),
+			runs.end(),
+			idx,
+			[](uint32 idx, const TextRun &run) { return idx < run.end; }) - runs.begin());
+	}
+	void TextLayout::SplitRun(uint32 idx)
+	{
+		if (idx == 0 || idx >= codes.GetLength()) return;
+		uint32 run = FindRun(idx);
+		if ((run == 0 ? 0 : runs[run - 1].end) == idx) return;
+		TextRun head = runs[run];
+		head.end = idx;
+		runs.insert(runs.begin() + run, head);
+	}
+	void TextLayout::MergeRuns(uint32 first, uint32 last)
+	{
+		if (runs.size() == 0) return;
+		for (uint32 i = Min(last, (uint32)runs.size() - 1); i != 0 && i >= first; i--)
+		{
+			if (!(runs[i].style == runs[i - 1].style)) continue;
+			runs[i - 1].end = runs[i].end;
+			runs.erase(runs.begin() + i);
+		}
+	}
+	template <typename Restyle> void TextLayout::RestyleRange(
+		uint32 idxBegin,
+		uint32 idxEnd,
+		Restyle restyle)
+	{
+		if (idxBegin >= idxEnd) return;
+		SplitRun(idxBegin);
+		SplitRun(idxEnd);
+		uint32 first = FindRun(idxBegin), last = first;
+		while (last < runs.size() && runs[last].end <= idxEnd)
+			restyle(runs[last++].style);
+		MergeRuns(first, last);
+	}
+	CharMetadata *TextLayout::GetCharMetadata(uint32 idx, uint32 *run)
+	{
+		while (runs[*run].end <= idx) (*run)++;
+		return FontManager::GetGlyph(codes.Get(idx), runs[*run].style.font);
+	}
+	void TextLayout::LayoutLine(uint32 start, TextLineMetrics *line)
+	{
+		// A line depends only on the text from its start onwards, which lets
+		// CalculateMetrics keep the lines that follow an edit
+		uint32 length = codes.GetLength(), run = FindRun(start), i = start,
+			lastWhitespace = UINT32_MAX;
+		float32 lineWidth = 0.0f, baseline = 0.0f, linespace = 0.0f,
+			whitespaceWidth, whitespaceBaseline, whitespaceLinespace;
+		line->charStart = start;
+		line->charEnd = length;
+		while (i < length)
+		{
+			float32 advance = GetCharMetadata(i, &run)->advance.x;
+			char32 code = codes.Get(i);
+			if (lineBreak
+				&& i != start
+				&& lineWidth + advance > width + 1e-2f
+				&& code != U' '
+				&& code != U'\n')
+			{
+				if (lastWhitespace == UINT32_MAX)
+					line->charEnd = i;
+				else
+				{
+					line->charEnd = lastWhitespace + 1;
+					lineWidth = whitespaceWidth;
+					baseline = whitespaceBaseline;
+					linespace = whitespaceLinespace;
+				}
+				break;
+			}
+			lineWidth += advance;
+			baseline = Max(baseline, runs[run].style.font->ascent);
+			linespace = Max(linespace, GetLinespace(&runs[run].style));
+			if (code == U' ')
+			{
+				lastWhitespace = i;
+				whitespaceWidth = lineWidth;
+				whitespaceBaseline = baseline;
+				whitespaceLinespace = linespace;
+			}
+			i++;
+			if (lineBreak && code == U'\n')
+			{
+				line->charEnd = i;
+				break;
+			}
+		}
+		line->baseline = baseline;
+		line->linespace = linespace;
+		line->width = lineWidth;
+		if (hAlign == HorizontalAlignLeft)
+			line->offset = 0.0f;
+		else if (hAlign == HorizontalAlignCenter)
+			line->offset = 0.5f*(width - lineWidth);
+		else line->offset = width - lineWidth;
+	}
+	// Fenwick trees over per-line values, laid out as TextBuffer's chunk tree
+	template <typename T> static void BuildTree(std::vector<T> &tree)
+	{
+		for (uint32 i = 0; i < tree.size(); i++)
+		{
+			uint32 parent = i | (i + 1);
+			if (parent < tree.size()) tree[parent] += tree[i];
+		}
+	}
+	template <typename T> static void AddToTree(std::vector<T> &tree, uint32 idx, T delta)
+	{
+		for (; idx < tree.size(); idx |= idx + 1)
+			tree[idx] += delta;
+	}
+	// Sum of the first count values
+	template <typename T> static T SumTree(std::vector<T> &tree, uint32 count)
+	{
+		T sum = 0;
+		for (; count != 0; count &= count - 1)
+			sum += tree[count - 1];
+		return sum;
+	}
+	// Largest count whose sum does not exceed value
+	template <typename T> static uint32 SearchTree(std::vector<T> &tree, T value)
+	{
+		uint32 position = 0, step = 1;
+		while (2 * step <= tree.size()) step *= 2;
+		for (; step != 0; step /= 2)
+		{
+			if (position + step <= tree.size() && tree[position + step - 1] <= value)
+			{
+				position += step;
+				value -= tree[position - 1];
+			}
+		}
+		return position;
+	}
+	void TextLayout::RebuildLineTrees()
+	{
+		lengthTree.resize(lines.size());
+		linespaceTree.resize(lines.size());
+		for (uint32 i = 0; i < lines.size(); i++)
+		{
+			lengthTree[i] = lines[i].length;
+			linespaceTree[i] = lines[i].linespace;
+		}
+		BuildTree(lengthTree);
+		BuildTree(linespaceTree);
+	}
+	void TextLayout::SetLine(uint32 idx, const TextLine &line)
+	{
+		AddToTree(lengthTree, idx, line.length - lines[idx].length);
+		AddToTree(linespaceTree, idx, (float64)line.linespace - (float64)lines[idx].linespace);
+		lines[idx] = line;
+	}
+	uint32 TextLayout::GetLineStart(uint32 idx)
+	{
+		return SumTree(lengthTree, idx);
+	}
+	float32 TextLayout::GetLineTop(uint32 idx)
+	{
+		return (float32)SumTree(linespaceTree, idx);
+	}
+	uint32 TextLayout::FindLineByChar(uint32 idx)
+	{
+		return Min(SearchTree(lengthTree, idx), (uint32)lines.size() - 1);
+	}
+	uint32 TextLayout::FindLineByTop(float32 y)
+	{
+		return Min(SearchTree(linespaceTree, (float64)y), (uint32)lines.size() - 1);
+	}
+	void TextLayout::FillLineMetrics(uint32 idx, TextLineMetrics *lm)
+	{
+		lm->baseline = lines[idx].baseline;
+		lm->linespace = lines[idx].linespace;
+		lm->charStart = GetLineStart(idx);
+		lm->charEnd = lm->charStart + lines[idx].length;
+		lm->offset = lines[idx].offset;
+		lm->width = lines[idx].width;
+	}
 	void TextLayout::CalculateMetrics()
 	{
 		if (metricsCalculated) return;
 		metricsCalculated = true;
-		lineMetrics.clear();
-		textHeight = 0.0f;
-		if (textObjects.size() == 0) return;
-		TextLineMetrics line;
-		line.baseline = 0.0f;
-		line.linespace = 0.0f;
-		line.charStart = 0;
-		line.width = 0.0f;
-		lineMetrics.push_back(line);
-		float32 advance = textObjects[0].charMetadata->advance.x;
-		std::vector<float32> accumulatedAdvance(textObjects.size());
-		accumulatedAdvance[0] = 0.0f;
-		uint32 lastWhitespace = UINT32_MAX;
-		for (uint32 i = 0; i < textObjects.size(); i++)
+		uint32 length = codes.GetLength(), start = 0, first = 0;
+		if (fullRelayout || lines.size() == 0)
 		{
-			lineMetrics.back().baseline = Max(
-				lineMetrics.back().baseline,
-				textObjects[i].font->ascent);
-			lineMetrics.back().linespace = Max(
-				lineMetrics.back().linespace,
-				GetLinespace(&textObjects[i]));
-			lineMetrics.back().width += advance;
-			if (textObjects[i].code == U' ')
-				lastWhitespace = i;
-			if (i == textObjects.size() - 1)
+			lines.clear();
+			lengthTree.clear();
+			linespaceTree.clear();
+		}
+		else
+		{
+			// Layout restarts a line before the edit, which may pull words up
+			first = FindLineByChar(dirtyBegin);
+			first = first != 0 ? first - 1 : 0;
+			start = GetLineStart(first);
+		}
+		fullRelayout = false;
+		// New lines replace the old lines [first, old); the old lines after
+		// them keep their lengths, so their starts shift with the edit by themselves
+		std::vector<TextLine> fresh;
+		uint32 old = first, oldStart = start;
+		bool rejoined = false;
+		while (start < length)
+		{
+			// Past the edit, the old lines are kept once a line starts where one did
+			if (start >= dirtyEnd)
 			{
-				if (hAlign == HorizontalAlignLeft)
-					lineMetrics.back().offset = 0.0f;
-				else if (hAlign == HorizontalAlignCenter)
-					lineMetrics.back().offset = 0.5f*(width - lineMetrics.back().width);
-				else lineMetrics.back().offset = width - lineMetrics.back().width;
-				lineMetrics.back().charEnd = textObjects.size();
-				textHeight += lineMetrics.back().linespace;
-				if (lineBreak && textObjects.back().code == U'\n')
+				while (old < lines.size() && (int64)oldStart + dirtyDelta < (int64)start)
+					oldStart += lines[old++].length;
+				if (old < lines.size() && (int64)oldStart + dirtyDelta == (int64)start)
 				{
-					line.baseline = lineMetrics.back().baseline;
-					line.linespace = lineMetrics.back().linespace;
-					line.charStart = textObjects.size();
-					line.charEnd = line.charStart;
-					if (hAlign == HorizontalAlignLeft)
-						line.offset = 0.0f;
-					else if (hAlign == HorizontalAlignCenter)
-						line.offset = 0.5f*width;
-					else line.offset = width;
-					line.width = 0.0f;
-					lineMetrics.push_back(line);
-					textHeight += lineMetrics.back().linespace;
+					rejoined = true;
+					break;
 				}
-				return;
 			}
-			accumulatedAdvance[i + 1] = accumulatedAdvance[i] + advance;
-			advance = textObjects[i + 1].charMetadata->advance.x;
-			if (lineBreak
-				&& (textObjects[i].code == U'\n'
-					|| lineMetrics.back().width + advance > width + 1e-2f
-					&& textObjects[i + 1].code != U' '
-					&& textObjects[i + 1].code != U'\n'))
+			TextLineMetrics line;
+			LayoutLine(start, &line);
+			fresh.push_back({ line.charEnd - line.charStart, line.baseline, line.linespace, line.offset, line.width });
+			start = line.charEnd;
+		}
+		if (!rejoined)
+		{
+			old = (uint32)lines.size();
+			if (lineBreak && length != 0 && codes.Get(length - 1) == U'\n')
 			{
-				if (hAlign == HorizontalAlignLeft)
-					lineMetrics.back().offset = 0.0f;
-				else if (hAlign == HorizontalAlignCenter)
-					lineMetrics.back().offset = 0.5f*(width - lineMetrics.back().width);
-				else lineMetrics.back().offset = width - lineMetrics.back().width;
-				if (textObjects[i].code == U'\n')
-					lastWhitespace = UINT32_MAX;
-				if (lastWhitespace == UINT32_MAX)
-					lineMetrics.back().charEnd = i + 1;
-				else lineMetrics.back().charEnd = lastWhitespace + 1;
-				lineMetrics.back().width = accumulatedAdvance[lineMetrics.back().charEnd]
-					- accumulatedAdvance[lineMetrics.back().charStart];
-				line.charStart = lineMetrics.back().charEnd;
-				line.width = accumulatedAdvance[i + 1] - accumulatedAdvance[line.charStart];
-				textHeight += lineMetrics.back().linespace;
-				lineMetrics.push_back(line);
-				lastWhitespace = UINT32_MAX;
+				TextLine &previous = fresh.size() != 0 ? fresh.back() : lines[first - 1];
+				TextLine line = { 0, previous.baseline, previous.linespace, 0.0f, 0.0f };
+				if (hAlign == HorizontalAlignCenter)
+					line.offset = 0.5f*width;
+				else if (hAlign == HorizontalAlignRight)
+					line.offset = width;
+				fresh.push_back(line);
 			}
 		}
+		if (fresh.size() == old - first)
+		{
+			for (uint32 i = 0; i < fresh.size(); i++)
+				SetLine(first + i, fresh[i]);
+		}
+		else
+		{
+			// Only a change in the line count moves the lines and rebuilds the trees
+			lines.erase(lines.begin() + first, lines.begin() + old);
+			lines.insert(lines.begin() + first, fresh.begin(), fresh.end());
+			RebuildLineTrees();
+		}
+		textHeight = (float32)SumTree(linespaceTree, (uint32)lines.size());
 	}
 	void TextLayout::Reset()
 	{
 		metricsCalculated = false;
+		fullRelayout = true;
+		renderCacheValid = false;
+	}
+	void TextLayout::Invalidate(uint32 idxBegin, uint32 idxEnd, uint32 newLength)
+	{
+		// Pending edits are merged into one window [dirtyBegin, dirtyEnd);
+		// text after it is the previously laid out text shifted by dirtyDelta
+		renderCacheValid = false;
+		measureValid = false;
+		if (!metricsCalculated && fullRelayout) return;
+		int32 delta = (int32)newLength - (int32)(idxEnd - idxBegin);
+		if (metricsCalculated)
+		{
+			dirtyBegin = idxBegin;
+			dirtyEnd = idxBegin + newLength;
+			dirtyDelta = delta;
+		}
+		else
+		{
+			if (idxEnd <= dirtyEnd) dirtyEnd += delta;
+			dirtyEnd = Max(dirtyEnd, idxBegin + newLength);
+			dirtyBegin = Min(dirtyBegin, idxBegin);
+			dirtyDelta += delta;
+		}
+		metricsCalculated = false;
 	}
 	void TextLayout::SetWidth(float32 value)
 	{
+		if (width == value) return;
 		Reset();
 		width = value;
 	}
@@ -126,7 +339,9 @@ namespace graphics
 	}
 	void TextLayout::SetHeight(float32 value)
 	{
-		Reset();
+		// Height and vertical align only move the lines, so they are kept
+		if (height == value) return;
+		renderCacheValid = false;
 		height = value;
 	}
 	float32 TextLayout::GetHeight()
@@ -135,6 +350,7 @@ namespace graphics
 	}
 	void TextLayout::SetHorizontalAlign(HorizontalAlign mode)
 	{
+		if (hAlign == mode) return;
 		Reset();
 		hAlign = mode;
 	}
@@ -144,7 +360,8 @@ namespace graphics
 	}
 	void TextLayout::SetVerticalAlign(VerticalAlign mode)
 	{
-		Reset();
+		if (vAlign == mode) return;
+		renderCacheValid = false;
 		vAlign = mode;
 	}
 	VerticalAlign TextLayout::GetVerticalAlign()
@@ -153,7 +370,9 @@ namespace graphics
 	}
 	void TextLayout::EnableMultiline(bool value)
 	{
+		if (lineBreak == value) return;
 		Reset();
+		measureValid = false;
 		lineBreak = value;
 	}
 	bool TextLayout::IsMultiline()
@@ -162,7 +381,9 @@ namespace graphics
 	}
 	void TextLayout::SetLinespacing(TextLineSpacing mode, float32 arg)
 	{
+		if (spacingMode == mode && spacingArg == arg) return;
 		Reset();
+		measureValid = false;
 		spacingMode = mode;
 		spacingArg = arg;
 	}
@@ -174,18 +395,54 @@ namespace graphics
 	uint32 TextLayout::GetLineCount()
 	{
 		CalculateMetrics();
-		return lineMetrics.size();
+		return (uint32)lines.size();
 	}
 	void TextLayout::GetLineMetrics(uint32 idx, TextLineMetrics *lm)
 	{
 		CalculateMetrics();
-		*lm = lineMetrics[idx];
+		FillLineMetrics(idx, lm);
 	}
 	float32 TextLayout::GetTextHeight()
 	{
 		CalculateMetrics();
 		return textHeight;
 	}
+	Vector2f TextLayout::MeasureText(float32 layoutWidth)
+	{
+		// Measuring lays out the whole text, so the result is kept until the
+		// text or a setting that moves line breaks changes
+		if (measureValid && measuredWidth == layoutWidth) return measuredSize;
+		Vector2f size(0.0f, 0.0f);
+		if (layoutWidth == width)
+		{
+			CalculateMetrics();
+			for (TextLine &line : lines)
+				size.x = Max(size.x, line.width);
+			size.y = textHeight;
+		}
+		else
+		{
+			// Lines at another width are only summed up, the current layout is kept
+			float32 savedWidth = width;
+			width = layoutWidth;
+			uint32 length = codes.GetLength(), start = 0;
+			TextLineMetrics line;
+			while (start < length)
+			{
+				LayoutLine(start, &line);
+				size.x = Max(size.x, line.width);
+				size.y += line.linespace;
+				start = line.charEnd;
+			}
+			if (lineBreak && length != 0 && codes.Get(length - 1) == U'\n')
+				size.y += line.linespace;
+			width = savedWidth;
+		}
+		measuredWidth = layoutWidth;
+		measuredSize = size;
+		measureValid = true;
+		return size;
+	}
 	void TextLayout::InsertText(
 		uint32 idx,
 		char32 *text,
@@ -198,7 +455,6 @@ namespace graphics
 		bool strikedthrough,
 		Color color)
 	{
-		Reset();
 		FontMetadata *font;
 		if (FontManager::GetFontMetadata(
 			std::wstring(fontName),
@@ -206,205 +462,199 @@ namespace graphics
 			isItalic,
 			weight,
 			&font) != HResultSuccess) return;
-		weight = FontManager::AdjustFontWeight(weight);
-		TextObject obj;
-		obj.font = font;
-		obj.fontPointSize = fontSize;
-		fontSize *= font->internalLeadingMultiplier*FontManager::GetDPIMultiplier();
-		obj.fontSize = fontSize;
-		obj.isItalic = isItalic;
-		obj.weight = weight;
-		obj.underlined = underlined;
-		obj.strikedthrough = strikedthrough;
-		obj.color = color;
-		for (uint32 i = 0; i < charCount; i++)
-		{
-			obj.code = text[i];
-			if (FontManager::GetCharMetadata(obj.code, font, &obj.charMetadata) != HResultSuccess
-				&& FontManager::GetCharMetadata(U'?', font, &obj.charMetadata) != HResultSuccess) continue;
-			textObjects.insert(textObjects.begin() + idx, obj);
-			idx++;
-		}
+		if (charCount == 0) return;
+		Invalidate(idx, idx, charCount);
+		TextRun run;
+		run.end = idx + charCount;
+		run.style.font = font;
+		run.style.fontPointSize = fontSize;
+		run.style.fontSize = fontSize*font->internalLeadingMultiplier*FontManager::GetDPIMultiplier();
+		run.style.isItalic = isItalic;
+		run.style.weight = FontManager::AdjustFontWeight(weight);
+		run.style.underlined = underlined;
+		run.style.strikedthrough = strikedthrough;
+		run.style.color = color;
+		SplitRun(idx);
+		uint32 first = FindRun(idx);
+		for (uint32 i = first; i < runs.size(); i++)
+			runs[i].end += charCount;
+		runs.insert(runs.begin() + first, run);
+		codes.Insert(idx, text, charCount);
+		MergeRuns(first, first + 1);
 	}
 	void TextLayout::DeleteText(
 		uint32 idxBegin,
 		uint32 idxEnd)
 	{
-		Reset();
-		textObjects.erase(
-			textObjects.begin() + idxBegin,
-			textObjects.begin() + idxEnd);
+		if (idxBegin >= idxEnd) return;
+		Invalidate(idxBegin, idxEnd, 0);
+		SplitRun(idxBegin);
+		SplitRun(idxEnd);
+		uint32 first = FindRun(idxBegin), last = FindRun(idxEnd);
+		runs.erase(runs.begin() + first, runs.begin() + last);
+		for (uint32 i = first; i < runs.size(); i++)
+			runs[i].end -= idxEnd - idxBegin;
+		codes.Erase(idxBegin, idxEnd);
+		MergeRuns(first, first);
 	}
 	void TextLayout::GetText(
 		uint32 idxBegin,
 		uint32 idxEnd,
 		std::u32string *text)
 	{
-		text->reserve(idxEnd - idxBegin);
-		while (idxBegin != idxEnd)
-			text->push_back(textObjects[idxBegin++].code);
+		codes.Read(idxBegin, idxEnd, text);
 	}
 	uint32 TextLayout::GetTextLength()
 	{
-		return textObjects.size();
+		return codes.GetLength();
 	}
 	void TextLayout::SetFont(
 		uint32 idxBegin,
 		uint32 idxEnd,
 		wchar *fontName)
 	{
-		Reset();
-		while (idxBegin < idxEnd)
+		Invalidate(idxBegin, idxEnd, idxEnd - idxBegin);
+		std::wstring name(fontName);
+		RestyleRange(idxBegin, idxEnd, [&](TextStyle &style)
 		{
 			if (FontManager::GetFontMetadata(
-				std::wstring(fontName),
-				textObjects[idxBegin].fontPointSize*FontManager::GetDPIMultiplier(),
-				textObjects[idxBegin].isItalic,
-				textObjects[idxBegin].weight,
-				&textObjects[idxBegin].font) == HResultSuccess)
+				name,
+				style.fontPointSize*FontManager::GetDPIMultiplier(),
+				style.isItalic,
+				style.weight,
+				&style.font) == HResultSuccess)
 			{
-				FontManager::GetCharMetadata(
-					textObjects[idxBegin].code,
-					textObjects[idxBegin].font,
-					&textObjects[idxBegin].charMetadata);
-				textObjects[idxBegin].fontSize =
-					textObjects[idxBegin].fontPointSize
-					*textObjects[idxBegin].font->internalLeadingMultiplier
+				style.fontSize = style.fontPointSize
+					*style.font->internalLeadingMultiplier
 					*FontManager::GetDPIMultiplier();
 			}
-			idxBegin++;
-		}
+		});
 	}
 	void TextLayout::SetFontSize(
 		uint32 idxBegin,
 		uint32 idxEnd,
 		float32 value)
 	{
-		Reset();
+		Invalidate(idxBegin, idxEnd, idxEnd - idxBegin);
 		float32 logicalFontSize = value * FontManager::GetDPIMultiplier();
-		while (idxBegin < idxEnd)
+		RestyleRange(idxBegin, idxEnd, [&](TextStyle &style)
 		{
 			FontManager::GetFontMetadata(
-				textObjects[idxBegin].font->fontName,
-				value,
-				textObjects[idxBegin].isItalic,
-				textObjects[idxBegin].weight,
-				&textObjects[idxBegin].font);
-			textObjects[idxBegin].fontPointSize = value;
-			textObjects[idxBegin].fontSize = textObjects[idxBegin].font->internalLeadingMultiplier*logicalFontSize;
-			idxBegin++;
-		}
+				style.font->fontName,
+				logicalFontSize,
+				style.isItalic,
+				style.weight,
+				&style.font);
+			style.fontPointSize = value;
+			style.fontSize = style.font->internalLeadingMultiplier*logicalFontSize;
+		});
 	}
 	float32 TextLayout::GetFontSize(uint32 idx)
 	{
-		return textObjects[idx].fontPointSize;
+		return runs[FindRun(idx)].style.fontPointSize;
 	}
 	float32 TextLayout::GetLogicalFontSize(uint32 idx)
 	{
-		return textObjects[idx].fontSize;
+		return runs[FindRun(idx)].style.fontSize;
 	}
 	void TextLayout::SetItalic(
 		uint32 idxBegin,
 		uint32 idxEnd,
 		bool value)
 	{
-		Reset();
-		while (idxBegin < idxEnd)
-			textObjects[idxBegin++].isItalic = value;
+		Invalidate(idxBegin, idxEnd, idxEnd - idxBegin);
+		RestyleRange(idxBegin, idxEnd, [&](TextStyle &style) { style.isItalic = value; });
 	}
 	bool TextLayout::IsItalic(uint32 idx)
 	{
-		return textObjects[idx].isItalic;
+		return runs[FindRun(idx)].style.isItalic;
 	}
 	void TextLayout::SetFontWeight(
 		uint32 idxBegin,
 		uint32 idxEnd,
 		uint32 value)
 	{
-		Reset();
+		Invalidate(idxBegin, idxEnd, idxEnd - idxBegin);
 		value = FontManager::AdjustFontWeight(value);
-		while (idxBegin < idxEnd)
-			textObjects[idxBegin++].weight = value;
+		RestyleRange(idxBegin, idxEnd, [&](TextStyle &style) { style.weight = value; });
 	}
 	uint32 TextLayout::GetFontWeight(uint32 idx)
 	{
-		return textObjects[idx].weight;
+		return runs[FindRun(idx)].style.weight;
 	}
 	void TextLayout::SetUnderline(
 		uint32 idxBegin,
 		uint32 idxEnd,
 		bool value)
 	{
-		while (idxBegin < idxEnd)
-			textObjects[idxBegin++].underlined = value;
+		RestyleRange(idxBegin, idxEnd, [&](TextStyle &style) { style.underlined = value; });
+		renderCacheValid = false;
 	}
 	bool TextLayout::IsUnderlined(uint32 idx)
 	{
-		return textObjects[idx].underlined;
+		return runs[FindRun(idx)].style.underlined;
 	}
 	void TextLayout::SetStrikethrough(
 		uint32 idxBegin,
 		uint32 idxEnd,
 		bool value)
 	{
-		while (idxBegin < idxEnd)
-			textObjects[idxBegin++].strikedthrough = value;
+		RestyleRange(idxBegin, idxEnd, [&](TextStyle &style) { style.strikedthrough = value; });
+		renderCacheValid = false;
 	}
 	bool TextLayout::IsStrikedthrough(uint32 idx)
 	{
-		return textObjects[idx].strikedthrough;
+		return runs[FindRun(idx)].style.strikedthrough;
 	}
 	void TextLayout::SetColor(
 		uint32 idxBegin,
 		uint32 idxEnd,
 		Color value)
 	{
-		while (idxBegin < idxEnd)
-			textObjects[idxBegin++].color = value;
+		RestyleRange(idxBegin, idxEnd, [&](TextStyle &style) { style.color = value; });
+		renderCacheValid = false;
 	}
 	Color TextLayout::GetColor(uint32 idx)
 	{
-		return textObjects[idx].color;
+		return runs[FindRun(idx)].style.color;
 	}
 	void TextLayout::HitTest(
 		Vector2f point,
 		TextPositionMetrics *tpm)
 	{
 		CalculateMetrics();
-		if (textObjects.size() == 0) return;
+		if (codes.GetLength() == 0) return;
 		float32 cx, cy = 0.0f;
 		if (vAlign == VerticalAlignCenter)
 			cy += 0.5f*(height - textHeight);
 		else if (vAlign == VerticalAlignBottom)
 			cy += height - textHeight;
-		uint32 line = 0;
-		if (point.y < cy) line = 0;
-		else
-		{
-			while (line < lineMetrics.size() && point.y >= cy)
-				cy += lineMetrics[line++].linespace;
-			line--;
-		}
-		uint32 iter = lineMetrics[line].charStart;
-		cx = lineMetrics[line].offset;
+		uint32 line = FindLineByTop(point.y - cy);
+		TextLineMetrics metrics;
+		FillLineMetrics(line, &metrics);
+		uint32 iter = metrics.charStart;
+		cx = metrics.offset;
 		if (point.x > cx)
 		{
-			while (iter < lineMetrics[line].charEnd && point.x >= cx)
+			uint32 run = FindRun(iter);
+			float32 advance = 0.0f;
+			while (iter < metrics.charEnd && point.x >= cx)
 			{
-				cx += textObjects[iter].charMetadata->advance.x;
+				advance = GetCharMetadata(iter, &run)->advance.x;
+				cx += advance;
 				iter++;
 			}
-			if (lineMetrics[line].charStart != lineMetrics[line].charEnd)
+			if (metrics.charStart != metrics.charEnd)
 			{
-				if (point.x < cx - 0.5f*textObjects[iter - 1].charMetadata->advance.x)
+				if (point.x < cx - 0.5f*advance)
 					iter--;
-				if (iter != 0 && textObjects[iter - 1].code == U'\n')
+				if (iter != 0 && codes.Get(iter - 1) == U'\n')
 					iter--;
 			}
 		}
 		tpm->hitTestIdx = iter;
 		tpm->line = line;
-		tpm->lineMetrics = lineMetrics[line];
+		tpm->lineMetrics = metrics;
 	}
 	void TextLayout::GetPositionMetrics(
 		uint32 idx,
@@ -416,109 +666,236 @@ namespace graphics
 			cy += 0.5f*(height - textHeight);
 		else if (vAlign == VerticalAlignBottom)
 			cy += height - textHeight;
-		uint32 line = 0;
-		while (line < lineMetrics.size()
-			&& lineMetrics[line].charStart <= idx)
-			cy += lineMetrics[line++].linespace;
-		cy -= lineMetrics[--line].linespace;
-		cy += lineMetrics[line].baseline;
-		cx = lineMetrics[line].offset;
-		uint32 iter = lineMetrics[line].charStart;
+		uint32 line = FindLineByChar(idx);
+		TextLineMetrics metrics;
+		FillLineMetrics(line, &metrics);
+		cy += GetLineTop(line) + metrics.baseline;
+		cx = metrics.offset;
+		uint32 iter = metrics.charStart, run = FindRun(iter);
 		while (iter < idx)
 		{
-			cx += textObjects[iter].charMetadata->advance.x;
+			cx += GetCharMetadata(iter, &run)->advance.x;
 			iter++;
 		}
 		tpm->position = Vector2f(cx, cy);
 		tpm->line = line;
-		tpm->lineMetrics = lineMetrics[line];
-	}
-	void TextLayout::Render(
-		RenderTarget *rt,
-		Vector2f position)
-	{
-		if (textObjects.size() == 0) return;
-		CalculateMetrics();
-		float32 cx = position.x, cy = position.y,
+		tpm->lineMetrics = metrics;
+	}
+	void TextLayout::BuildRenderCache(Vector2f position, uint32 invertBegin, uint32 invertEnd)
+	{
+		// Glyphs are grouped by outline, so each outline's xtable constants are
+		// pushed once per layout; decorations are grouped by color
+		glyphRuns.clear();
+		atlasGlyphs.clear();
+		decorations.clear();
+		decorationGroups.clear();
+		renderCachePosition = position;
+		renderCacheInvertBegin = invertBegin;
+		renderCacheInvertEnd = invertEnd;
+		renderCacheOpacity = 1.0f;
+		renderCacheValid = true;
+		if (codes.GetLength() == 0) return;
+		std::map<CharMetadata *, uint32> runIndices;
+		float32 cx = position.x, cy = position.y, baseline,
 			underlineOffset, underlineSize, underlineStart, strikethroughStart;
+		Color color, previousColor;
 		bool underlinedRun, strikedthroughRun;
+		uint32 run = 0, lineStart = 0;
+		TextStyle *previous = nullptr;
 		if (vAlign == VerticalAlignCenter)
 			cy += 0.5f*(height - textHeight);
 		else if (vAlign == VerticalAlignBottom)
 			cy += height - textHeight;
-		rt->SetSolidColorBrush(textObjects[0].color);
-		for (uint32 i = 0; i < lineMetrics.size(); i++)
+		for (uint32 i = 0; i < lines.size(); i++)
 		{
 			underlinedRun = false;
 			strikedthroughRun = false;
-			cx = position.x + lineMetrics[i].offset;
-			for (uint32 j = lineMetrics[i].charStart; j < lineMetrics[i].charEnd; j++)
+			cx = position.x + lines[i].offset;
+			baseline = cy + lines[i].baseline;
+			uint32 lineEnd = lineStart + lines[i].length;
+			for (uint32 j = lineStart; j < lineEnd; j++)
 			{
-				if (j != 0 && textObjects[j].color != textObjects[j - 1].color)
-					rt->SetSolidColorBrush(textObjects[j].color);
-				rt->RenderGeometry(
-					textObjects[j].charMetadata->outline,
-					cx,
-					cy + lineMetrics[i].baseline);
+				CharMetadata *charMetadata = GetCharMetadata(j, &run);
+				TextStyle &style = runs[run].style;
+				color = style.color;
+				if (j >= invertBegin && j < invertEnd)
+				{
+					color.r = 255 - color.r;
+					color.g = 255 - color.g;
+					color.b = 255 - color.b;
+				}
+				if (style.font->size <= GlyphAtlas::sizeThreshold)
+					atlasGlyphs.push_back({ codes.Get(j), charMetadata, run, cx, baseline, color });
+				else
+				{
+					auto glyphRun = runIndices.find(charMetadata);
+					if (glyphRun == runIndices.end())
+					{
+						glyphRun = runIndices.insert({ charMetadata, (uint32)glyphRuns.size() }).first;
+						glyphRuns.push_back({ charMetadata });
+					}
+					glyphRuns[glyphRun->second].instances.push_back(
+						{ cx, baseline, 0.0f, 0.0f, 0.0f, 1.0f, color });
+				}
 
-				if (underlinedRun && !textObjects[j].underlined)
+				if (underlinedRun && !style.underlined)
 				{
-					rt->FillRectangle(
+					decorations.push_back({
 						underlineStart,
-						cy + lineMetrics[i].baseline + underlineOffset,
+						baseline + underlineOffset,
 						cx - underlineStart,
-						underlineSize);
+						underlineSize,
+						color });
 					underlinedRun = false;
 				}
-				if (textObjects[j].underlined)
+				if (style.underlined)
 				{
 					if (!underlinedRun)
 					{
 						underlinedRun = true;
 						underlineStart = cx;
-						underlineOffset = textObjects[j].font->underlineOffset;
-						underlineSize = textObjects[j].font->underlineSize;
+						underlineOffset = style.font->underlineOffset;
+						underlineSize = style.font->underlineSize;
 					}
 					else
 					{
-						underlineOffset = Max(underlineOffset, textObjects[j].font->underlineOffset);
-						underlineSize = Max(underlineSize, textObjects[j].font->underlineSize);
+						underlineOffset = Max(underlineOffset, style.font->underlineOffset);
+						underlineSize = Max(underlineSize, style.font->underlineSize);
 					}
 				}
 
 				if (strikedthroughRun
-					&& (!textObjects[j].strikedthrough
-						|| textObjects[j - 1].font != textObjects[j].font
-						|| textObjects[j - 1].fontSize != textObjects[j].fontSize))
+					&& (!style.strikedthrough
+						|| previous->font != style.font
+						|| previous->fontSize != style.fontSize))
 				{
-					rt->FillRectangle(
+					decorations.push_back({
 						strikethroughStart,
-						cy + lineMetrics[i].baseline + textObjects[j - 1].font->strikethroughOffset,
+						baseline + previous->font->strikethroughOffset,
 						cx - strikethroughStart,
-						textObjects[j - 1].font->strikethroughSize);
+						previous->font->strikethroughSize,
+						color });
 					strikedthroughRun = false;
 				}
-				if (textObjects[j].strikedthrough && !strikedthroughRun)
+				if (style.strikedthrough && !strikedthroughRun)
 				{
 					strikedthroughRun = true;
 					strikethroughStart = cx;
 				}
 
-				cx += textObjects[j].charMetadata->advance.x;
+				cx += charMetadata->advance.x;
+				previous = &style;
+				previousColor = color;
+			}
+			if (lines[i].length != 0)
+			{
+				if (underlinedRun)
+					decorations.push_back({
+						underlineStart,
+						baseline + underlineOffset,
+						cx - underlineStart,
+						underlineSize,
+						previousColor });
+				if (strikedthroughRun)
+					decorations.push_back({
+						strikethroughStart,
+						baseline + previous->font->strikethroughOffset,
+						cx - strikethroughStart,
+						previous->font->strikethroughSize,
+						previousColor });
+			}
+			cy += lines[i].linespace;
+			lineStart = lineEnd;
+		}
+		std::stable_sort(
+			decorations.begin(),
+			decorations.end(),
+			[](const TextDecoration &a, const TextDecoration &b) { return a.color.code < b.color.code; });
+		GeometryPath path;
+		for (uint32 i = 0; i < decorations.size(); i++)
+		{
+			TextDecoration &decoration = decorations[i];
+			// Edges are snapped to pixels as FillRectangle does
+			float32 left = round(decoration.x),
+				top = round(decoration.y),
+				right = round(decoration.x + decoration.width),
+				bottom = round(decoration.y + decoration.height);
+			if (right > left && bottom > top)
+			{
+				path.Move(Vector2f(right, top));
+				path.PushLine(Vector2f(left, top));
+				path.PushLine(Vector2f(left, bottom));
+				path.PushLine(Vector2f(right, bottom));
+			}
+			if (i + 1 < decorations.size()
+				&& decorations[i + 1].color.code == decoration.color.code)
+				continue;
+			if (path.IsEmpty()) continue;
+			decorationGroups.emplace_back();
+			decorationGroups.back().color = decoration.color;
+			decorationGroups.back().geometry.FillGeometry(path);
+			path.Reset();
+		}
+	}
+	void TextLayout::Render(
+		RenderTarget *rt,
+		Vector2f position,
+		uint32 invertBegin,
+		uint32 invertEnd)
+	{
+		if (codes.GetLength() == 0) return;
+		CalculateMetrics();
+		if (invertBegin >= invertEnd) invertBegin = invertEnd = 0;
+		if (!renderCacheValid
+			|| renderCachePosition.x != position.x
+			|| renderCachePosition.y != position.y
+			|| renderCacheInvertBegin != invertBegin
+			|| renderCacheInvertEnd != invertEnd)
+			BuildRenderCache(position, invertBegin, invertEnd);
+		float32 opacity = rt->GetOpacity();
+		if (renderCacheOpacity != opacity)
+		{
+			for (GlyphRun &run : glyphRuns)
+				for (GeometryInstance &instance : run.instances)
+					instance.opacity = opacity;
+			renderCacheOpacity = opacity;
+		}
+		// Outlines and decorations share the geometry render mode and a solid
+		// brush, so they are recorded as one instanced draw; atlas glyphs
+		// switch to the bitmap pipeline and add one more
+		for (GlyphRun &run : glyphRuns)
+			rt->RenderGeometryInstanced(
+				run.charMetadata->outline,
+				run.instances.data(),
+				(uint32)run.instances.size());
+		Color brushColor;
+		bool brushSolid = false;
+		auto useSolidBrush = [&](Color color)
+		{
+			if (brushSolid && brushColor == color) return;
+			rt->SetSolidColorBrush(color);
+			brushColor = color;
+			brushSolid = true;
+		};
+		for (DecorationGroup &group : decorationGroups)
+		{
+			useSolidBrush(group.color);
+			rt->RenderGeometry(group.geometry);
+		}
+
+		// Small glyphs come from the atlas, which leaves a bitmap brush bound;
+		// the solid brush is set again before any geometry is drawn
+		GlyphAtlas *atlas = atlasGlyphs.size() == 0 ? nullptr : rt->GetGlyphAtlas();
+		for (AtlasGlyph &glyph : atlasGlyphs)
+		{
+			if (atlas != nullptr
+				&& atlas->DrawGlyph(glyph.code, runs[glyph.run].style.font, glyph.charMetadata, glyph.color, glyph.x, glyph.y))
+			{
+				brushSolid = false;
+				continue;
 			}
-			if (underlinedRun)
-				rt->FillRectangle(
-					underlineStart,
-					cy + lineMetrics[i].baseline + underlineOffset,
-					cx - underlineStart,
-					underlineSize);
-			if (strikedthroughRun)
-				rt->FillRectangle(
-					strikethroughStart,
-					cy + lineMetrics[i].baseline + textObjects[lineMetrics[i].charEnd - 1].font->strikethroughOffset,
-					cx - strikethroughStart,
-					textObjects[lineMetrics[i].charEnd - 1].font->strikethroughSize);
-			cy += lineMetrics[i].linespace;
+			useSolidBrush(glyph.color);
+			rt->RenderGeometry(glyph.charMetadata->outline, glyph.x, glyph.y);
 		}
 	}
 }
@@ -6,7 +6,10 @@
 #include "graphics\Font.h"
 #include "ui\UITypes.h"
 #include "graphics\Color.h"
+#include "graphics\TextBuffer.h"
+#include "gpu\RenderTarget.h"
 #include <vector>
+#include <list>
 
 namespace graphics
 {
@@ -40,11 +43,9 @@ namespace graphics
 	class TextLayout
 	{
 	protected:
-		struct TextObject
+		struct TextStyle
 		{
-			char32 code;
 			FontMetadata *font;
-			CharMetadata *charMetadata;
 			float32 fontPointSize;
 			float32 fontSize;
 			bool isItalic;
@@ -52,8 +53,47 @@ namespace graphics
 			bool underlined;
 			bool strikedthrough;
 			Color color;
+			bool operator==(const TextStyle &style) const;
+		};
+		// Characters [previous run end, end) share the style
+		struct TextRun
+		{
+			uint32 end;
+			TextStyle style;
+		};
+		// Instances of one glyph outline, drawn with a single RenderGeometryInstanced
+		struct GlyphRun
+		{
+			CharMetadata *charMetadata;
+			std::vector<GeometryInstance> instances;
+		};
+		struct AtlasGlyph
+		{
+			char32 code;
+			CharMetadata *charMetadata;
+			uint32 run;
+			float32 x;
+			float32 y;
+			Color color;
+		};
+		struct TextDecoration
+		{
+			float32 x;
+			float32 y;
+			float32 width;
+			float32 height;
+			Color color;
 		};
-		std::vector<TextObject> textObjects;
+		// Decorations of one color filled as a single geometry, so they are
+		// drawn in the same batch as the glyph outlines
+		struct DecorationGroup
+		{
+			Color color;
+			Geometry geometry;
+		};
+		TextBuffer codes;
+		// Sorted by end; adjacent runs never share a style
+		std::vector<TextRun> runs;
 		float32 width;
 		float32 height;
 		HorizontalAlign hAlign;
@@ -61,13 +101,68 @@ namespace graphics
 		bool lineBreak;
 		TextLineSpacing spacingMode;
 		float32 spacingArg;
-		std::vector<TextLineMetrics> lineMetrics;
+		// Laid out line; its first character and top are prefix sums of the
+		// lengths and linespaces before it
+		struct TextLine
+		{
+			uint32 length;
+			float32 baseline;
+			float32 linespace;
+			float32 offset;
+			float32 width;
+		};
+		std::vector<TextLine> lines;
+		// Fenwick trees over line lengths and linespaces, so an edit that keeps
+		// the line count moves the lines after it in O(log n)
+		std::vector<uint32> lengthTree;
+		std::vector<float64> linespaceTree;
 		float32 textHeight;
 		bool metricsCalculated;
+		bool fullRelayout;
+		uint32 dirtyBegin;
+		uint32 dirtyEnd;
+		int32 dirtyDelta;
+		// Draw lists kept until the layout, its styles or the position change
+		std::vector<GlyphRun> glyphRuns;
+		std::vector<AtlasGlyph> atlasGlyphs;
+		std::vector<TextDecoration> decorations;
+		std::list<DecorationGroup> decorationGroups;
+		Vector2f renderCachePosition;
+		uint32 renderCacheInvertBegin;
+		uint32 renderCacheInvertEnd;
+		float32 renderCacheOpacity;
+		bool renderCacheValid;
+		// Result of the last MeasureText; width and alignment do not affect it,
+		// so it is kept until the text, its fonts or the line breaking change
+		float32 measuredWidth;
+		Vector2f measuredSize;
+		bool measureValid;
 
-		float32 GetLinespace(TextObject *obj);
+		float32 GetLinespace(TextStyle *style);
+		uint32 FindRun(uint32 idx);
+		void SplitRun(uint32 idx);
+		void MergeRuns(uint32 first, uint32 last);
+		CharMetadata *GetCharMetadata(uint32 idx, uint32 *run);
+		template <typename Restyle> void RestyleRange(
+			uint32 idxBegin,
+			uint32 idxEnd,
+			Restyle restyle);
+		void LayoutLine(uint32 start, TextLineMetrics *line);
+		void RebuildLineTrees();
+		void SetLine(uint32 idx, const TextLine &line);
+		uint32 GetLineStart(uint32 idx);
+		float32 GetLineTop(uint32 idx);
+		// Last line starting at or before character idx
+		uint32 FindLineByChar(uint32 idx);
+		// Last line whose top is at or above y
+		uint32 FindLineByTop(float32 y);
+		void FillLineMetrics(uint32 idx, TextLineMetrics *lm);
 		void CalculateMetrics();
+		// Lays out everything again
 		void Reset();
+		// Characters [idxBegin, idxEnd) are replaced by newLength others
+		void Invalidate(uint32 idxBegin, uint32 idxEnd, uint32 newLength);
+		void BuildRenderCache(Vector2f position, uint32 invertBegin, uint32 invertEnd);
 	public:
 		TextLayout();
 		void SetWidth(float32 value);
@@ -85,6 +180,8 @@ namespace graphics
 		uint32 GetLineCount();
 		void GetLineMetrics(uint32 idx, TextLineMetrics *lm);
 		float32 GetTextHeight();
+		// Size of the text laid out at another width; the current layout is kept
+		Vector2f MeasureText(float32 layoutWidth);
 		void InsertText(
 			uint32 idx,
 			char32 *text,
@@ -145,8 +242,12 @@ namespace graphics
 		void GetPositionMetrics(
 			uint32 idx,
 			TextPositionMetrics *tpm);
+		// Characters [invertBegin, invertEnd) are drawn in inverted colors,
+		// as for a selection, without restyling them
 		void Render(
 			RenderTarget *rt,
-			Vector2f position);
+			Vector2f position,
+			uint32 invertBegin = 0,
+			uint32 invertEnd = 0);
 	};
 }
@@ -186,7 +186,9 @@ namespace kernel
 		GpuDevice *device;
 		QueryGpuDevice(&device);
 		VkInstance vkInstance = device->GetVkInstance();
+		bool presentationSupported = device->IsPresentationSupported();
 		device->Unref();
+		if (!presentationSupported) return HResultFail;
 		VkSurfaceKHR vkSurface;
 		VkWin32SurfaceCreateInfoKHR vkSurfaceCreateInfo;
 		vkSurfaceCreateInfo.sType = VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR;
@@ -121,6 +121,7 @@ namespace graphics
 	typedef class Color Color;
 	typedef class GeometryPath GeometryPath;
 	typedef class Geometry Geometry;
+	typedef class GlyphAtlas GlyphAtlas;
 	typedef struct FontMetadata FontMetadata;
 	typedef struct CharMetadata CharMetadata;
 	typedef class FontManager FontManager;
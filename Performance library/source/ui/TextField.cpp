@@ -87,18 +87,10 @@ namespace ui
 			viewport.right - viewport.left,
 			viewport.bottom - viewport.top);
 		Color color;
+		uint32 startSelection = Min(caret, selection),
+			endSelection = Max(caret, selection);
 		if (caret != selection)
 		{
-			uint32 startSelection = Min(caret, selection),
-				endSelection = Max(caret, selection);
-			for (uint32 i = startSelection; i < endSelection; i++)
-			{
-				color = textLayout.GetColor(i);
-				color.r = 255 - color.r;
-				color.g = 255 - color.g;
-				color.b = 255 - color.b;
-				textLayout.SetColor(i, i + 1, color);
-			}
 			TextPositionMetrics tpm1, tpm2;
 			textLayout.GetPositionMetrics(startSelection, &tpm1);
 			textLayout.GetPositionMetrics(endSelection, &tpm2);
@@ -137,7 +129,11 @@ namespace ui
 					tpm2.lineMetrics.linespace);
 			}
 		}
-		textLayout.Render(rt, Vector2f(p.x + viewport.left - hOffset, p.y + viewport.top - scroll->GetOffset()));
+		textLayout.Render(
+			rt,
+			Vector2f(p.x + viewport.left - hOffset, p.y + viewport.top - scroll->GetOffset()),
+			startSelection,
+			endSelection);
 		if (editable && UIManager::IsFocused(this) && UIManager::IsCaretVisible() && caret == selection)
 		{
 			bool extraChar = false;
@@ -173,39 +169,13 @@ namespace ui
 				if (extraChar) textLayout.DeleteText(0, 1);
 			}
 		}
-		if (caret != selection)
-		{
-			uint32 startSelection = Min(caret, selection),
-				endSelection = Max(caret, selection);
-			for (uint32 i = startSelection; i < endSelection; i++)
-			{
-				color = textLayout.GetColor(i);
-				color.r = 255 - color.r;
-				color.g = 255 - color.g;
-				color.b = 255 - color.b;
-				textLayout.SetColor(i, i + 1, color);
-			}
-		}
 		rt->PopScissor();
 	}
 	Vector2f TextField::EvaluateContentSizeImpl(
 		float32 *viewportWidth,
 		float32 *viewportHeight)
 	{
-		float32 currentWidth = textLayout.GetWidth(),
-			currentHeight = textLayout.GetHeight();
-		textLayout.SetWidth(viewportWidth == nullptr ? FLT_MAX : *viewportWidth);
-		textLayout.SetHeight(viewportHeight == nullptr ? FLT_MAX : *viewportHeight);
-		Vector2f size = Vector2f(0.0f, textLayout.GetTextHeight());
-		for (uint32 i = 0; i < textLayout.GetLineCount(); i++)
-		{
-			TextLineMetrics lm;
-			textLayout.GetLineMetrics(i, &lm);
-			size.x = Max(lm.width, size.x);
-		}
-		textLayout.SetWidth(currentWidth);
-		textLayout.SetHeight(currentHeight);
-		return size;
+		return textLayout.MeasureText(viewportWidth == nullptr ? FLT_MAX : *viewportWidth);
 	}
 	void TextField::PrepareImpl()
 	{
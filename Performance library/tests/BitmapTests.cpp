@@ -0,0 +1,121 @@
+// Copyright (c) 2017-2018, Roman Shkurdalov
+// This file is under The Clear BSD License, see LICENSE.txt
+
+#include "Test.h"
+#include "gpu\GpuDevice.h"
+#include "gpu\RenderTarget.h"
+#include "gpu\Bitmap.h"
+#include <cstring>
+#include <vector>
+
+using namespace tests;
+
+static const uint32 targetSize = 64;
+static const uint32 bitmapSize = 512;
+
+static void RenderCheckerboard(
+	GpuDevice *device,
+	RenderTarget *target,
+	bool mipmaps,
+	std::vector<Color> *pixels)
+{
+	Bitmap *bitmap;
+	CHECK(device->CreateBitmap(bitmapSize, bitmapSize, &bitmap, mipmaps) == HResultSuccess);
+	CHECK(bitmap->GetLevelCount() == (mipmaps ? 10u : 1u));
+	Color *texels;
+	bitmap->MapMemory((void **)&texels);
+	for (uint32 y = 0; y < bitmapSize; y++)
+		for (uint32 x = 0; x < bitmapSize; x++)
+			texels[y * bitmapSize + x] = ((x ^ y) & 1) ? Color(Color::White) : Color(Color::Black);
+	bitmap->UnmapMempory();
+	// Eight texels per pixel in both directions; pixel centers fall on texel
+	// centers, so level 0 reads a single texel even when filtered
+	Matrix3x2f transform;
+	MatrixScale2d(1.0f / 8.0f, 1.0f / 8.0f, 0.0f, 0.0f, &transform);
+	bitmap->SetTransform(transform);
+	target->Begin();
+	target->SetBitmapBrush(bitmap, 0.5f, 0.5f);
+	target->FillRectangle(0.0f, 0.0f, (float32)targetSize, (float32)targetSize);
+	target->End();
+	CHECK(target->ReadPixels(pixels->data()) == HResultSuccess);
+	bitmap->Unref();
+}
+static uint32 CountGray(std::vector<Color> &pixels)
+{
+	uint32 count = 0;
+	for (Color &pixel : pixels)
+	{
+		if (abs((int32)pixel.r - 128) <= 4
+			&& abs((int32)pixel.g - 128) <= 4
+			&& abs((int32)pixel.b - 128) <= 4)
+			count++;
+	}
+	return count;
+}
+
+TEST(MipmappedBitmapAveragesWhenMinified)
+{
+	GpuDevice *device;
+	RenderTarget *target;
+	if (!AcquireGpuDevice(&device)) SKIP("no Vulkan device");
+	if (device->CreateOffscreenRenderTarget(targetSize, targetSize, &target) != HResultSuccess)
+	{
+		device->Unref();
+		SKIP("offscreen render target unavailable");
+	}
+	std::vector<Color> mipmapped(targetSize * targetSize), single(targetSize * targetSize);
+	RenderCheckerboard(device, target, true, &mipmapped);
+	RenderCheckerboard(device, target, false, &single);
+	// The 64x64 level averages each 8x8 block to gray; level 0 aliases to
+	// whichever texel a pixel center hits
+	CHECK(CountGray(mipmapped) == targetSize * targetSize);
+	CHECK(CountGray(single) == 0);
+	target->Unref();
+	device->Unref();
+}
+TEST(BitmapRewriteKeepsFramesInFlight)
+{
+	GpuDevice *device;
+	RenderTarget *target;
+	if (!AcquireGpuDevice(&device)) SKIP("no Vulkan device");
+	if (device->CreateOffscreenRenderTarget(targetSize, targetSize, &target) != HResultSuccess)
+	{
+		device->Unref();
+		SKIP("offscreen render target unavailable");
+	}
+	Bitmap *bitmap;
+	CHECK(device->CreateBitmap(targetSize, targetSize, &bitmap) == HResultSuccess);
+	const uint32 frames = 4;
+	std::vector<Color> pixels[frames];
+	for (uint32 frame = 0; frame < frames; frame++)
+	{
+		// Each frame's bitmap is written right after the previous frame was
+		// submitted, which still has to draw the old texels
+		Color color((uint8)(60 * frame), 0, (uint8)(255 - 60 * frame));
+		Color *texels;
+		bitmap->MapMemory((void **)&texels);
+		for (uint32 i = 0; i < targetSize * targetSize; i++)
+			texels[i] = color;
+		bitmap->UnmapMempory();
+		pixels[frame].resize(targetSize * targetSize);
+		target->Begin();
+		// Overdraw keeps the GPU busy while the next frame's texels are written
+		for (uint32 layer = 0; layer < 64; layer++)
+		{
+			target->SetBitmapBrush(bitmap, 0.0f, 0.0f);
+			target->FillRectangle(0.0f, 0.0f, (float32)targetSize, (float32)targetSize);
+		}
+		target->End();
+		CHECK(target->ReadPixelsAsync(pixels[frame].data()) == HResultSuccess);
+	}
+	target->FinishReadbacks();
+	for (uint32 frame = 0; frame < frames; frame++)
+	{
+		std::vector<Color> expected(targetSize * targetSize,
+			Color((uint8)(60 * frame), 0, (uint8)(255 - 60 * frame)));
+		CHECK(memcmp(pixels[frame].data(), expected.data(), expected.size() * sizeof(Color)) == 0);
+	}
+	bitmap->Unref();
+	target->Unref();
+	device->Unref();
+}
@@ -0,0 +1,222 @@
+// Copyright (c) 2017-2018, Roman Shkurdalov
+// This file is under The Clear BSD License, see LICENSE.txt
+
+#include "Test.h"
+#include "gpu\GpuDevice.h"
+#include "gpu\RenderTarget.h"
+#include "graphics\Geometry.h"
+#include <cstring>
+#include <vector>
+
+using namespace tests;
+
+static const uint32 targetSize = 128;
+
+class XtableProbe : public Geometry
+{
+public:
+	std::vector<ScanBand> bands;
+
+	// Builds the xtable in CPU memory with at most maxBands bands
+	uint32 Build(uint32 maxBands, std::vector<float32> *xtable)
+	{
+		uint32 bandCount;
+		uint32 size = BuildXtable(bands, maxBands, &bandCount);
+		xtable->assign(size, 0.0f);
+		for (uint32 i = 0; i < bandCount; i++)
+			WriteXtable(bands[i], xtable->data());
+		return bandCount;
+	}
+	uint32 GetStripCount()
+	{
+		return (uint32)xtableStrips.size();
+	}
+	uint32 GetRowCount()
+	{
+		return (uint32)xtableHeight;
+	}
+	// Crossings of a scan row as stored in a float32 xtable, without padding
+	void ReadRow(std::vector<float32> &xtable, int32 row, std::vector<float32> *crossings)
+	{
+		crossings->clear();
+		for (XtableStrip &strip : xtableStrips)
+		{
+			if (row < strip.start || row >= strip.start + strip.height) continue;
+			float32 *data = xtable.data() + strip.offset + strip.width * (row - strip.start);
+			for (int32 i = 0; i < strip.width; i++)
+			{
+				if (data[i] != FLT_MAX) crossings->push_back(data[i]);
+			}
+		}
+	}
+	// Rows as the original per-row insertion built them from the crossings
+	// of a single band: descending magnitude, and a crossing goes before
+	// the earlier ones it ties with
+	void BuildReferenceRows(std::vector<std::vector<float32>> *rows)
+	{
+		rows->assign(xtableHeight, std::vector<float32>());
+		for (ScanCrossing &crossing : bands[0].crossings)
+		{
+			std::vector<float32> &row = (*rows)[crossing.row];
+			uint32 column = 0;
+			while (column < row.size() && abs(crossing.x) < abs(row[column]))
+				column++;
+			row.insert(row.begin() + column, crossing.x);
+		}
+	}
+};
+
+static uint64 RenderShapes(
+	RenderTarget *target,
+	Geometry *shapes,
+	uint32 count,
+	bool packed,
+	std::vector<Color> *pixels)
+{
+	for (uint32 i = 0; i < count; i++)
+		shapes[i].EnablePackedXtable(packed);
+	target->Begin();
+	target->SetSolidColorBrush(Color(Color::White));
+	target->FillRectangle(0.0f, 0.0f, (float32)targetSize, (float32)targetSize);
+	for (uint32 i = 0; i < count; i++)
+	{
+		target->SetSolidColorBrush(Color((uint8)(60 * i), 0, (uint8)(255 - 60 * i)));
+		target->RenderGeometry(shapes[i]);
+	}
+	target->End();
+	CHECK(target->ReadPixels(pixels->data()) == HResultSuccess);
+	RenderTargetStatistics statistics;
+	target->GetStatistics(&statistics);
+	return statistics.storageBytesUploaded;
+}
+
+TEST(PackedXtableMatchesFloat)
+{
+	GpuDevice *device;
+	RenderTarget *target;
+	if (!AcquireGpuDevice(&device)) SKIP("no Vulkan device");
+	if (device->CreateOffscreenRenderTarget(targetSize, targetSize, &target) != HResultSuccess)
+	{
+		device->Unref();
+		SKIP("offscreen render target unavailable");
+	}
+	Geometry shapes[4];
+	shapes[0].FillEllipse(Vector2f(64.0f, 64.0f), 50.3f, 30.7f);
+	shapes[1].FillRoundedRectangle(10.25f, 20.5f, 70.3f, 41.9f, 12.0f, 7.5f);
+	shapes[2].DrawEllipse(Vector2f(80.5f, 70.25f), 30.0f, 40.0f, 2.5f);
+	shapes[3].FillTriangle(Vector2f(3.1f, 120.7f), Vector2f(61.9f, 7.3f), Vector2f(124.6f, 99.2f));
+	std::vector<Color> reference(targetSize * targetSize), packed(targetSize * targetSize);
+	uint64 floatBytes = RenderShapes(target, shapes, 4, false, &reference);
+	uint64 packedBytes = RenderShapes(target, shapes, 4, true, &packed);
+	// Both uploads are dominated by crossings, packed ones take 2 bytes
+	CHECK(packedBytes * 10 < floatBytes * 7);
+	// Crossings move by at most 1/32 pixel, so does coverage on each subscanline
+	uint32 maxDifference = 0, totalDifference = 0;
+	for (uint32 i = 0; i < targetSize * targetSize; i++)
+	{
+		uint8 *a = (uint8 *)&reference[i], *b = (uint8 *)&packed[i];
+		for (uint32 channel = 0; channel < 3; channel++)
+		{
+			uint32 difference = (uint32)abs((int32)a[channel] - (int32)b[channel]);
+			maxDifference = Max(maxDifference, difference);
+			totalDifference += difference;
+		}
+	}
+	CHECK(maxDifference <= 16);
+	CHECK(totalDifference <= 3 * targetSize * targetSize / 4);
+	target->Unref();
+	device->Unref();
+}
+TEST(PackedXtableFallsBackWhenTooWide)
+{
+	GpuDevice *device;
+	RenderTarget *target;
+	if (!AcquireGpuDevice(&device)) SKIP("no Vulkan device");
+	if (device->CreateOffscreenRenderTarget(targetSize, targetSize, &target) != HResultSuccess)
+	{
+		device->Unref();
+		SKIP("offscreen render target unavailable");
+	}
+	// 11.4 fixed point cannot address this width, Prepare keeps float32
+	Geometry wide;
+	wide.FillRectangle(-2000.0f, 16.0f, 4000.0f, 32.0f);
+	wide.EnablePackedXtable(true);
+	std::vector<Color> pixels(targetSize * targetSize);
+	RenderShapes(target, &wide, 1, true, &pixels);
+	for (uint32 x = 0; x < targetSize; x++)
+	{
+		CHECK(pixels[32 * targetSize + x] == Color(0, 0, 255));
+		CHECK(pixels[8 * targetSize + x] == Color(Color::White));
+	}
+	target->Unref();
+	device->Unref();
+}
+TEST(BandedXtableMatchesSingleBand)
+{
+	// Tall enough for several bands; edges and arcs cross band boundaries,
+	// and the rectangle's sides start and end exactly on them
+	XtableProbe shapes[4];
+	shapes[0].FillEllipse(Vector2f(300.5f, 4600.25f), 280.3f, 4500.7f);
+	shapes[1].DrawEllipse(Vector2f(200.0f, 3000.0f), 150.0f, 2900.0f, 3.5f);
+	shapes[2].FillRoundedRectangle(10.0f, 0.0f, 400.0f, 8192.0f, 60.0f, 200.0f);
+	shapes[3].FillTriangle(Vector2f(3.1f, 7000.7f), Vector2f(610.9f, 1.3f), Vector2f(124.6f, 6400.2f));
+	for (uint32 packed = 0; packed < 2; packed++)
+	{
+		for (XtableProbe &shape : shapes)
+		{
+			shape.EnablePackedXtable(packed != 0);
+			std::vector<float32> single, banded;
+			CHECK(shape.Build(1, &single) == 1);
+			uint32 singleStrips = shape.GetStripCount();
+			CHECK(shape.Build(8, &banded) > 1);
+			CHECK(shape.GetStripCount() == singleStrips);
+			CHECK(banded.size() == single.size());
+			if (banded.size() == single.size())
+				CHECK(memcmp(banded.data(), single.data(), single.size() * sizeof(float32)) == 0);
+		}
+	}
+}
+TEST(XtableRowsMatchInsertionOrder)
+{
+	// Shared edges and duplicated shapes tie in magnitude, with opposite and
+	// equal directions; the last probe is filled with clockwise faces
+	XtableProbe shapes[4];
+	shapes[0].FillRectangle(10.0f, 10.0f, 20.0f, 20.0f);
+	shapes[0].FillRectangle(30.0f, 10.0f, 20.0f, 20.0f);
+	shapes[0].FillTriangle(Vector2f(30.0f, 5.0f), Vector2f(50.0f, 40.0f), Vector2f(10.0f, 40.0f));
+	shapes[1].FillEllipse(Vector2f(40.0f, 40.0f), 30.0f, 20.0f);
+	shapes[1].FillEllipse(Vector2f(40.0f, 40.0f), 30.0f, 20.0f);
+	shapes[1].FillRectangle(70.0f, 20.0f, 10.0f, 40.0f);
+	shapes[2].FillRoundedRectangle(5.5f, 3.25f, 60.0f, 50.0f, 12.0f, 9.0f);
+	shapes[2].DrawRectangle(5.5f, 3.25f, 60.0f, 50.0f, 2.0f);
+	shapes[3].SetFaceOrientation(false);
+	shapes[3].FillRectangle(10.0f, 10.0f, 20.0f, 20.0f);
+	shapes[3].FillRectangle(30.0f, 10.0f, 20.0f, 20.0f);
+	shapes[3].FillTriangle(Vector2f(30.0f, 5.0f), Vector2f(50.0f, 40.0f), Vector2f(10.0f, 40.0f));
+	std::vector<float32> xtables[4];
+	for (uint32 i = 0; i < 4; i++)
+	{
+		CHECK(shapes[i].Build(1, &xtables[i]) == 1);
+		std::vector<std::vector<float32>> reference;
+		shapes[i].BuildReferenceRows(&reference);
+		uint32 mismatches = 0;
+		std::vector<float32> row;
+		for (uint32 r = 0; r < shapes[i].GetRowCount(); r++)
+		{
+			shapes[i].ReadRow(xtables[i], r, &row);
+			if (row.size() != reference[r].size()
+				|| memcmp(row.data(), reference[r].data(), row.size() * sizeof(float32)) != 0)
+				mismatches++;
+		}
+		CHECK(mismatches == 0);
+	}
+	// Face orientation only flips the direction of every crossing
+	CHECK(xtables[3].size() == xtables[0].size());
+	uint32 unflipped = 0;
+	for (uint32 i = 0; i < xtables[0].size() && i < xtables[3].size(); i++)
+	{
+		if (xtables[0][i] == FLT_MAX) unflipped += xtables[3][i] != FLT_MAX;
+		else unflipped += xtables[3][i] != -xtables[0][i];
+	}
+	CHECK(unflipped == 0);
+}
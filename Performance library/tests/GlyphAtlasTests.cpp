@@ -0,0 +1,93 @@
+// Copyright (c) 2017-2018, Roman Shkurdalov
+// This file is under The Clear BSD License, see LICENSE.txt
+
+#include "Test.h"
+#include "gpu\GpuDevice.h"
+#include "gpu\RenderTarget.h"
+#include "graphics\Font.h"
+#include "graphics\GlyphAtlas.h"
+#include <vector>
+
+using namespace tests;
+
+static const uint32 targetSize = 64;
+
+static void RenderBoth(
+	RenderTarget *target,
+	CharMetadata &glyph,
+	bool atlas,
+	std::vector<Color> *pixels)
+{
+	// The same outline in two colors, so both share one atlas entry
+	target->Begin();
+	target->SetSolidColorBrush(Color(Color::White));
+	target->FillRectangle(0.0f, 0.0f, (float32)targetSize, (float32)targetSize);
+	Color colors[2] = { Color(Color::Red), Color(Color::Blue) };
+	for (uint32 i = 0; i < 2; i++)
+	{
+		float32 x = 4.0f + 32.0f * (float32)i, y = 8.0f;
+		if (atlas)
+		{
+			CHECK(target->GetGlyphAtlas()->DrawGlyph(U'o', nullptr, &glyph, colors[i], x, y));
+		}
+		else
+		{
+			target->SetSolidColorBrush(colors[i]);
+			target->RenderGeometry(glyph.outline, x, y);
+		}
+	}
+	target->End();
+	CHECK(target->ReadPixels(pixels->data()) == HResultSuccess);
+}
+static void CompareAtlasWithAnalytic(RenderTarget *target, CharMetadata &glyph)
+{
+	std::vector<Color> analytic(targetSize * targetSize), atlas(targetSize * targetSize);
+	RenderBoth(target, glyph, false, &analytic);
+	RenderBoth(target, glyph, true, &atlas);
+	// Both accumulate eight subscanlines per pixel, but the shader samples
+	// pixel centers differently, so edges may differ slightly
+	uint32 maxDifference = 0, totalDifference = 0, covered = 0;
+	for (uint32 i = 0; i < targetSize * targetSize; i++)
+	{
+		uint8 *a = (uint8 *)&analytic[i], *b = (uint8 *)&atlas[i];
+		for (uint32 channel = 0; channel < 3; channel++)
+		{
+			uint32 difference = (uint32)abs((int32)a[channel] - (int32)b[channel]);
+			maxDifference = Max(maxDifference, difference);
+			totalDifference += difference;
+		}
+		if (!(analytic[i] == Color(Color::White))) covered++;
+	}
+	CHECK(covered > 100);
+	CHECK(maxDifference <= 48);
+	CHECK(totalDifference <= 3 * 8 * covered);
+}
+
+TEST(AtlasGlyphMatchesAnalyticGeometry)
+{
+	GpuDevice *device;
+	RenderTarget *target;
+	if (!AcquireGpuDevice(&device)) SKIP("no Vulkan device");
+	if (device->CreateOffscreenRenderTarget(targetSize, targetSize, &target) != HResultSuccess)
+	{
+		device->Unref();
+		SKIP("offscreen render target unavailable");
+	}
+	if (target->GetGlyphAtlas() == nullptr)
+	{
+		target->Unref();
+		device->Unref();
+		SKIP("glyph atlas unavailable");
+	}
+	CharMetadata ring;
+	ring.outline.DrawEllipse(Vector2f(12.0f, -10.0f), 9.0f, 9.0f, 3.0f);
+	CompareAtlasWithAnalytic(target, ring);
+
+	// Decay scales the outline down on screen; the atlas must follow
+	CharMetadata decayed;
+	decayed.outline.FillEllipse(Vector2f(24.0f, -16.0f), 20.0f, 12.0f);
+	decayed.outline.SetDecay(2.0f, 2.0f);
+	CompareAtlasWithAnalytic(target, decayed);
+	target->Unref();
+	device->Unref();
+}
@@ -0,0 +1,217 @@
+// Copyright (c) 2017-2018, Roman Shkurdalov
+// This file is under The Clear BSD License, see LICENSE.txt
+
+#include "Test.h"
+#include "gpu\GpuDevice.h"
+#include "gpu\RenderTarget.h"
+#include "gpu\Bitmap.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace tests;
+
+static const uint32 targetSize = 64;
+
+static Bitmap *CreatePatternBitmap(GpuDevice *device, uint32 size, uint32 seed)
+{
+	Bitmap *bitmap;
+	if (device->CreateBitmap(size, size, &bitmap) != HResultSuccess) return nullptr;
+	Color *texels;
+	bitmap->MapMemory((void **)&texels);
+	for (uint32 y = 0; y < size; y++)
+		for (uint32 x = 0; x < size; x++)
+			texels[y * size + x] = Color((uint8)(x * 4 + seed), (uint8)(y * 4), (uint8)(seed * 16));
+	bitmap->UnmapMempory();
+	return bitmap;
+}
+static void RenderBitmap(RenderTarget *target, Bitmap *bitmap, std::vector<Color> *pixels)
+{
+	target->Begin();
+	target->SetBitmapBrush(bitmap, 0.0f, 0.0f);
+	target->FillRectangle(0.0f, 0.0f, (float32)targetSize, (float32)targetSize);
+	target->End();
+	if (pixels != nullptr) CHECK(target->ReadPixels(pixels->data()) == HResultSuccess);
+}
+
+TEST(StorageHeapGrowKeepsContents)
+{
+	GpuDevice *device;
+	RenderTarget *target;
+	if (!AcquireGpuDevice(&device)) SKIP("no Vulkan device");
+	if (device->CreateOffscreenRenderTarget(targetSize, targetSize, &target) != HResultSuccess)
+	{
+		device->Unref();
+		SKIP("offscreen render target unavailable");
+	}
+	Bitmap *first = CreatePatternBitmap(device, targetSize, 1);
+	CHECK(first != nullptr);
+	std::vector<Color> reference(targetSize * targetSize), pixels(targetSize * targetSize);
+	RenderBitmap(target, first, &reference);
+	GpuMemoryStatistics before;
+	device->GetMemoryStatistics(&before);
+
+	// A second thread grows the heap while frames reading it are submitted,
+	// so heap copies, staging uploads and frames share the queue
+	const uint32 bitmapCount = 8;
+	std::vector<Bitmap *> bitmaps(bitmapCount, nullptr);
+	std::thread worker([&]()
+	{
+		for (uint32 i = 0; i < bitmapCount; i++)
+			bitmaps[i] = CreatePatternBitmap(device, 256, i + 2);
+	});
+	for (uint32 frame = 0; frame < 64; frame++)
+		RenderBitmap(target, first, nullptr);
+	worker.join();
+
+	GpuMemoryStatistics after;
+	device->GetMemoryStatistics(&after);
+	CHECK(after.heapSize > before.heapSize);
+	RenderBitmap(target, first, &pixels);
+	CHECK(memcmp(pixels.data(), reference.data(), pixels.size() * sizeof(Color)) == 0);
+	for (uint32 i = 0; i < bitmapCount; i++)
+	{
+		CHECK(bitmaps[i] != nullptr);
+		if (bitmaps[i] == nullptr) continue;
+		Bitmap *copy = CreatePatternBitmap(device, 256, i + 2);
+		RenderBitmap(target, copy, &reference);
+		RenderBitmap(target, bitmaps[i], &pixels);
+		CHECK(memcmp(pixels.data(), reference.data(), pixels.size() * sizeof(Color)) == 0);
+		copy->Unref();
+		bitmaps[i]->Unref();
+	}
+	first->Unref();
+	target->Unref();
+	device->Unref();
+}
+
+class PipelineCacheProbe : public GpuDevice
+{
+public:
+	using GpuDevice::ReadPipelineCacheFile;
+	using GpuDevice::WritePipelineCacheFile;
+};
+
+TEST(PipelineCacheRejectsForeignHeader)
+{
+	const std::string path = "pipeline_cache_test.bin";
+	uint8 uuid[VK_UUID_SIZE], otherUuid[VK_UUID_SIZE];
+	for (uint32 i = 0; i < VK_UUID_SIZE; i++)
+	{
+		uuid[i] = (uint8)(17 * i + 3);
+		otherUuid[i] = uuid[i];
+	}
+	otherUuid[VK_UUID_SIZE - 1] ^= 1;
+	std::vector<uint8> payload(1000), data;
+	for (uint32 i = 0; i < payload.size(); i++)
+		payload[i] = (uint8)(i * 7);
+	PipelineCacheProbe::WritePipelineCacheFile(path, 42, uuid, payload);
+
+	PipelineCacheProbe::ReadPipelineCacheFile(path, 42, uuid, &data);
+	CHECK(data.size() == payload.size());
+	if (data.size() == payload.size())
+		CHECK(memcmp(data.data(), payload.data(), payload.size()) == 0);
+	// Another driver version or cache UUID yields nothing
+	PipelineCacheProbe::ReadPipelineCacheFile(path, 43, uuid, &data);
+	CHECK(data.empty());
+	PipelineCacheProbe::ReadPipelineCacheFile(path, 42, otherUuid, &data);
+	CHECK(data.empty());
+
+	// So does a file too short for the header, or no file at all
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write((const char *)uuid, 6);
+	}
+	PipelineCacheProbe::ReadPipelineCacheFile(path, 42, uuid, &data);
+	CHECK(data.empty());
+	std::remove(path.c_str());
+	PipelineCacheProbe::ReadPipelineCacheFile(path, 42, uuid, &data);
+	CHECK(data.empty());
+}
+
+struct StressBitmap
+{
+	Bitmap *bitmap;
+	uint32 seed;
+};
+static void FillStressBitmap(StressBitmap &entry)
+{
+	uint32 *texels;
+	uint32 count = entry.bitmap->GetWidth() * entry.bitmap->GetHeight();
+	entry.bitmap->MapMemory((void **)&texels);
+	for (uint32 i = 0; i < count; i++)
+		texels[i] = entry.seed * 2654435761u + i;
+	entry.bitmap->UnmapMempory();
+}
+static bool CheckStressBitmap(StressBitmap &entry)
+{
+	uint32 *texels, mismatches = 0;
+	uint32 count = entry.bitmap->GetWidth() * entry.bitmap->GetHeight();
+	entry.bitmap->MapMemory((void **)&texels);
+	for (uint32 i = 0; i < count; i++)
+		mismatches += texels[i] != entry.seed * 2654435761u + i;
+	entry.bitmap->UnmapMempory();
+	return mismatches == 0;
+}
+
+TEST(StorageHeapGrowFreeStress)
+{
+	GpuDevice *device;
+	if (!AcquireGpuDevice(&device)) SKIP("no Vulkan device");
+	GpuMemoryStatistics before;
+	device->GetMemoryStatistics(&before);
+	// Random sizes take every split of a buddy block, and the live bitmaps
+	// add up to a few times the current heap, so it grows more than once;
+	// every bitmap keeps its own pattern, so blocks handed out twice or lost
+	// in a heap copy show up as corrupted texels
+	uint32 maxSide = 16;
+	while (32 * maxSide * maxSide < before.heapSize) maxSide *= 2;
+	std::mt19937 random(12);
+	std::vector<StressBitmap> live;
+	uint32 corrupted = 0, nextSeed = 1;
+	for (uint32 step = 0; step < 2000; step++)
+	{
+		if (live.size() < 8 || (live.size() < 96 && random() % 3 != 0))
+		{
+			StressBitmap entry;
+			uint32 width = 1 + random() % maxSide, height = 1 + random() % maxSide;
+			if (device->CreateBitmap(width, height, &entry.bitmap, random() % 4 == 0) != HResultSuccess)
+				continue;
+			entry.seed = nextSeed++;
+			FillStressBitmap(entry);
+			live.push_back(entry);
+		}
+		else
+		{
+			uint32 victim = random() % live.size();
+			corrupted += !CheckStressBitmap(live[victim]);
+			live[victim].bitmap->Unref();
+			live[victim] = live.back();
+			live.pop_back();
+		}
+	}
+	GpuMemoryStatistics peak;
+	device->GetMemoryStatistics(&peak);
+	CHECK(peak.heapSize > before.heapSize);
+	CHECK(peak.allocationCount == before.allocationCount + (uint32)live.size());
+	for (StressBitmap &entry : live)
+	{
+		corrupted += !CheckStressBitmap(entry);
+		entry.bitmap->Unref();
+	}
+	CHECK(corrupted == 0);
+
+	// Freed blocks merge with their buddies again: what was allocated before
+	// is back, and the upper half that growth added is one free block
+	GpuMemoryStatistics after;
+	device->GetMemoryStatistics(&after);
+	CHECK(after.allocationCount == before.allocationCount);
+	CHECK(after.allocatedSize == before.allocatedSize);
+	CHECK(after.largestFreeBlock >= after.heapSize / 2);
+	for (uint32 i = 0; i < 32; i++)
+		CHECK(after.sizeClassCounts[i] == before.sizeClassCounts[i]);
+	device->Unref();
+}
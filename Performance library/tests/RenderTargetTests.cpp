@@ -0,0 +1,228 @@
+// Copyright (c) 2017-2018, Roman Shkurdalov
+// This file is under The Clear BSD License, see LICENSE.txt
+
+#include "Test.h"
+#include "gpu\GpuDevice.h"
+#include "gpu\RenderTarget.h"
+#include "gpu\GradientCollection.h"
+#include "util\Time.h"
+#include "graphics\Color.h"
+#include <cstring>
+#include <vector>
+
+using namespace tests;
+
+static const uint32 targetSize = 64;
+
+static void CreateTarget(GpuDevice **ppDevice, RenderTarget **ppTarget)
+{
+	if (!AcquireGpuDevice(ppDevice)) SKIP("no Vulkan device");
+	if ((*ppDevice)->CreateOffscreenRenderTarget(targetSize, targetSize, ppTarget) != HResultSuccess)
+	{
+		(*ppDevice)->Unref();
+		SKIP("offscreen render target unavailable");
+	}
+}
+
+TEST(ConsecutiveQuadsShareOneDraw)
+{
+	GpuDevice *device;
+	RenderTarget *target;
+	CreateTarget(&device, &target);
+	// Every column gets its own brush, so each instance carries different constants
+	target->Begin();
+	for (uint32 i = 0; i < targetSize; i++)
+	{
+		target->SetSolidColorBrush(Color((uint8)(4 * i), (uint8)(255 - 4 * i), 0));
+		target->FillRectangle((float32)i, 0.0f, 1.0f, (float32)targetSize / 2);
+	}
+	target->PushScissor(0.0f, (float32)targetSize / 2, (float32)targetSize, (float32)targetSize / 2);
+	target->SetSolidColorBrush(Color(Color::Blue));
+	target->FillRectangle(0.0f, 0.0f, (float32)targetSize, (float32)targetSize);
+	target->PopScissor();
+	target->End();
+	std::vector<Color> pixels(targetSize * targetSize);
+	CHECK(target->ReadPixels(pixels.data()) == HResultSuccess);
+
+	RenderTargetStatistics statistics;
+	target->GetStatistics(&statistics);
+	CHECK(statistics.primitivesRecorded == targetSize + 1);
+	// The scissor change splits the batch once
+	CHECK(statistics.drawsIssued == 2);
+	CHECK(statistics.verticesPushed == 4 * (targetSize + 1));
+	for (uint32 i = 0; i < targetSize; i++)
+	{
+		Color top = pixels[targetSize / 4 * targetSize + i],
+			bottom = pixels[3 * targetSize / 4 * targetSize + i];
+		CHECK(top == Color((uint8)(4 * i), (uint8)(255 - 4 * i), 0));
+		CHECK(bottom == Color(Color::Blue));
+	}
+	target->Unref();
+	device->Unref();
+}
+TEST(InstancedGeometryIsOneDraw)
+{
+	GpuDevice *device;
+	RenderTarget *target;
+	CreateTarget(&device, &target);
+	Geometry geometry;
+	geometry.FillRectangle(0.0f, 0.0f, 4.0f, 4.0f);
+	GeometryInstance instances[16];
+	for (uint32 i = 0; i < 16; i++)
+	{
+		instances[i] = {};
+		instances[i].translateX = (float32)(4 * i);
+		instances[i].opacity = 1.0f;
+		instances[i].color = Color((uint8)(16 * i), 0, 255);
+	}
+	target->Begin();
+	target->RenderGeometryInstanced(geometry, instances, 16);
+	target->End();
+	std::vector<Color> pixels(targetSize * targetSize);
+	CHECK(target->ReadPixels(pixels.data()) == HResultSuccess);
+
+	RenderTargetStatistics statistics;
+	target->GetStatistics(&statistics);
+	CHECK(statistics.primitivesRecorded == 16);
+	CHECK(statistics.drawsIssued == 1);
+	for (uint32 i = 0; i < 16; i++)
+		CHECK(pixels[2 * targetSize + 4 * i + 2] == instances[i].color);
+	target->Unref();
+	device->Unref();
+}
+TEST(ResizedTargetReadsBackNewSize)
+{
+	GpuDevice *device;
+	RenderTarget *target;
+	CreateTarget(&device, &target);
+	const uint32 width = 48, height = 32;
+	CHECK(target->Resize(width, height) == HResultSuccess);
+	target->Begin();
+	target->SetSolidColorBrush(Color(Color::Red));
+	target->FillRectangle(0.0f, 0.0f, (float32)width / 2, (float32)height);
+	target->SetSolidColorBrush(Color(Color::Blue));
+	target->FillRectangle((float32)width / 2, 0.0f, (float32)width / 2, (float32)height);
+	target->End();
+	std::vector<Color> pixels(width * height);
+	CHECK(target->ReadPixels(pixels.data()) == HResultSuccess);
+	for (uint32 y = 0; y < height; y++)
+	{
+		CHECK(pixels[y * width] == Color(Color::Red));
+		CHECK(pixels[y * width + width / 2 - 1] == Color(Color::Red));
+		CHECK(pixels[y * width + width / 2] == Color(Color::Blue));
+		CHECK(pixels[y * width + width - 1] == Color(Color::Blue));
+	}
+	target->Unref();
+	device->Unref();
+}
+TEST(AsyncReadbacksKeepTheirFrames)
+{
+	GpuDevice *device;
+	RenderTarget *target;
+	CreateTarget(&device, &target);
+	// More frames than slots, so some readbacks complete when their slot
+	// is reused and the rest in FinishReadbacks
+	const uint32 frames = 6;
+	std::vector<Color> pixels[frames];
+	for (uint32 i = 0; i < frames; i++)
+	{
+		pixels[i].resize(targetSize * targetSize);
+		target->Begin();
+		target->SetSolidColorBrush(Color((uint8)(40 * i), 0, (uint8)(255 - 40 * i)));
+		target->FillRectangle(0.0f, 0.0f, (float32)targetSize, (float32)targetSize);
+		target->End();
+		CHECK(target->ReadPixelsAsync(pixels[i].data()) == HResultSuccess);
+	}
+	target->FinishReadbacks();
+	for (uint32 i = 0; i < frames; i++)
+	{
+		uint32 mismatches = 0;
+		for (Color &pixel : pixels[i])
+			mismatches += pixel != Color((uint8)(40 * i), 0, (uint8)(255 - 40 * i));
+		CHECK(mismatches == 0);
+	}
+	target->Unref();
+	device->Unref();
+}
+
+// Overlapping full-target layers in every fill mode, so fragment work dominates
+static void RenderFillHeavyScene(RenderTarget *target, GradientCollection *gradient, Geometry &star, float32 size)
+{
+	target->Begin();
+	for (uint32 layer = 0; layer < 8; layer++)
+	{
+		float32 inset = (float32)layer * 2.0f;
+		target->SetSolidColorBrush(Color((uint8)(30 * layer), 128, 64));
+		target->FillRectangle(inset, inset, size - 2.0f * inset, size - 2.0f * inset);
+		target->SetLinearGradientBrush(gradient, Vector2f(0.0f, 0.0f), Vector2f(size, size));
+		target->FillRoundedRectangle(inset, inset, size - 2.0f * inset, size - 2.0f * inset, 40.0f, 40.0f);
+		target->SetRadialGradientBrush(gradient, Vector2f(size / 2, size / 2), size / 2, size / 3);
+		target->FillEllipse(Vector2f(size / 2, size / 2), size / 2 - inset, size / 2 - inset);
+		target->SetSolidColorBrush(Color(255, (uint8)(30 * layer), 0));
+		target->SetOpacity(0.5f);
+		target->RenderGeometry(star, inset, inset);
+		target->SetOpacity(1.0f);
+	}
+	target->End();
+}
+BENCHMARK(SpecializedPipelinesFillHeavy)
+{
+	static const uint32 size = 1024, frames = 64;
+	GpuDevice *device;
+	RenderTarget *target;
+	if (!AcquireGpuDevice(&device)) SKIP("no Vulkan device");
+	if (device->CreateOffscreenRenderTarget(size, size, &target) != HResultSuccess)
+	{
+		device->Unref();
+		SKIP("offscreen render target unavailable");
+	}
+	GradientStop stops[3] = {
+		{ 0.0f, Color(Color::Red) },
+		{ 0.5f, Color(Color::Green) },
+		{ 1.0f, Color(Color::Blue) } };
+	GradientCollection *gradient;
+	CHECK(target->CreateGradientCollection(stops, 3, &gradient) == HResultSuccess);
+	Geometry star;
+	star.FillTriangle(Vector2f(512.0f, 0.0f), Vector2f(1024.0f, 768.0f), Vector2f(0.0f, 768.0f));
+	star.FillTriangle(Vector2f(512.0f, 1024.0f), Vector2f(0.0f, 256.0f), Vector2f(1024.0f, 256.0f));
+	std::vector<Color> pixels[2] = {
+		std::vector<Color>(size * size),
+		std::vector<Color>(size * size) };
+	for (uint32 specialized = 0; specialized < 2; specialized++)
+	{
+		target->SetSpecializedPipelines(specialized != 0);
+		// Warm up until the timings lagging behind belong to this mode
+		for (uint32 i = 0; i < 4; i++)
+			RenderFillHeavyScene(target, gradient, star, (float32)size);
+		uint64 gpuTime = 0;
+		int64 start = Time::Now();
+		for (uint32 i = 0; i < frames; i++)
+		{
+			RenderFillHeavyScene(target, gradient, star, (float32)size);
+			FrameTimings timings;
+			target->GetFrameTimings(&timings);
+			gpuTime += timings.gpuTime;
+		}
+		CHECK(target->ReadPixels(pixels[specialized].data()) == HResultSuccess);
+		int64 wallTime = Time::Now() - start;
+		RenderTargetStatistics statistics;
+		target->GetStatistics(&statistics);
+		if (specialized != 0)
+		{
+			ReportValue("specialized gpu time", gpuTime / 1e6 / frames, "ms/frame");
+			ReportValue("specialized wall time", wallTime / 1e6 / frames, "ms/frame");
+			ReportValue("specialized draws", (float64)statistics.drawsIssued, "draws/frame");
+		}
+		else
+		{
+			ReportValue("generic gpu time", gpuTime / 1e6 / frames, "ms/frame");
+			ReportValue("generic wall time", wallTime / 1e6 / frames, "ms/frame");
+			ReportValue("generic draws", (float64)statistics.drawsIssued, "draws/frame");
+		}
+	}
+	// Specialization only removes branches, the output must not change
+	CHECK(memcmp(pixels[0].data(), pixels[1].data(), size * size * sizeof(Color)) == 0);
+	gradient->Unref();
+	target->Unref();
+	device->Unref();
+}
@@ -0,0 +1,51 @@
+// Copyright (c) 2017-2018, Roman Shkurdalov
+// This file is under The Clear BSD License, see LICENSE.txt
+
+#pragma once
+#include "kernel\kernel.h"
+#include <vector>
+
+namespace tests
+{
+	using namespace kernel;
+
+	typedef void(*TestFunction)();
+
+	struct TestCase
+	{
+		const char8 *name;
+		TestFunction function;
+		bool benchmark;
+	};
+
+	std::vector<TestCase> &GetTestCases();
+
+	struct TestRegistration
+	{
+		TestRegistration(const char8 *name, TestFunction function, bool benchmark);
+	};
+
+	// Thrown by SKIP, e.g. when the machine has no Vulkan device
+	struct TestSkipped
+	{
+		const char8 *reason;
+	};
+
+	void ReportFailure(const char8 *file, int32 line, const char8 *expression);
+	void ReportValue(const char8 *name, float64 value, const char8 *unit);
+	// Initializes the GPU once per run; false when no device is available
+	bool AcquireGpuDevice(gpu::GpuDevice **ppDevice);
+}
+
+// Tests run by default; benchmarks only with -benchmark
+#define TEST(name) \
+	static void name(); \
+	static tests::TestRegistration name##Registration(#name, name, false); \
+	static void name()
+#define BENCHMARK(name) \
+	static void name(); \
+	static tests::TestRegistration name##Registration(#name, name, true); \
+	static void name()
+#define CHECK(expression) \
+	{ if (!(expression)) tests::ReportFailure(__FILE__, __LINE__, #expression); }
+#define SKIP(reason) throw tests::TestSkipped{ reason }
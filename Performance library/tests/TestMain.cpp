@@ -0,0 +1,74 @@
+// Copyright (c) 2017-2018, Roman Shkurdalov
+// This file is under The Clear BSD License, see LICENSE.txt
+
+#include "Test.h"
+#include "gpu\GpuDevice.h"
+#include <cstdio>
+#include <cstring>
+
+namespace tests
+{
+	static uint32 failureCount;
+
+	std::vector<TestCase> &GetTestCases()
+	{
+		static std::vector<TestCase> testCases;
+		return testCases;
+	}
+	TestRegistration::TestRegistration(const char8 *name, TestFunction function, bool benchmark)
+	{
+		GetTestCases().push_back({ name, function, benchmark });
+	}
+	void ReportFailure(const char8 *file, int32 line, const char8 *expression)
+	{
+		printf("  %s(%d): CHECK(%s) failed\n", file, line, expression);
+		failureCount++;
+	}
+	void ReportValue(const char8 *name, float64 value, const char8 *unit)
+	{
+		printf("  %-40s %12.3f %s\n", name, value, unit);
+	}
+	bool AcquireGpuDevice(gpu::GpuDevice **ppDevice)
+	{
+		static HResult result = gpu::GpuInitialize();
+		if (result != HResultSuccess) return false;
+		gpu::QueryGpuDevice(ppDevice);
+		return true;
+	}
+}
+
+using namespace tests;
+
+// Usage: tests [-benchmark] [name filter]
+int main(int argc, char **argv)
+{
+	bool benchmark = false;
+	const char8 *filter = nullptr;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-benchmark") == 0) benchmark = true;
+		else filter = argv[i];
+	}
+	uint32 passed = 0, failed = 0, skipped = 0;
+	for (TestCase &testCase : GetTestCases())
+	{
+		if (testCase.benchmark != benchmark) continue;
+		if (filter != nullptr && strstr(testCase.name, filter) == nullptr) continue;
+		printf("%s\n", testCase.name);
+		uint32 failures = failureCount;
+		try
+		{
+			testCase.function();
+		}
+		catch (TestSkipped &skip)
+		{
+			printf("  skipped: %s\n", skip.reason);
+			skipped++;
+			continue;
+		}
+		if (failureCount == failures) passed++;
+		else failed++;
+	}
+	printf("%u passed, %u failed, %u skipped\n", passed, failed, skipped);
+	return failed == 0 ? 0 : 1;
+}
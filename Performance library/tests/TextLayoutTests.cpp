@@ -0,0 +1,297 @@
+// Copyright (c) 2017-2018, Roman Shkurdalov
+// This file is under The Clear BSD License, see LICENSE.txt
+
+#include "Test.h"
+#include "gpu\GpuDevice.h"
+#include "gpu\RenderTarget.h"
+#include "graphics\TextLayout.h"
+#include "util\Time.h"
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace tests;
+
+static const uint32 targetSize = 256;
+
+static void CreateTarget(GpuDevice **ppDevice, RenderTarget **ppTarget)
+{
+	if (!AcquireGpuDevice(ppDevice)) SKIP("no Vulkan device");
+	if ((*ppDevice)->CreateOffscreenRenderTarget(targetSize, targetSize, ppTarget) != HResultSuccess)
+	{
+		(*ppDevice)->Unref();
+		SKIP("offscreen render target unavailable");
+	}
+}
+
+class RunProbe : public TextLayout
+{
+public:
+	// Runs cover the text in increasing order and neighbours differ in style
+	bool CheckRuns()
+	{
+		uint32 start = 0;
+		for (uint32 i = 0; i < runs.size(); i++)
+		{
+			if (runs[i].end <= start) return false;
+			if (i != 0 && runs[i].style == runs[i - 1].style) return false;
+			start = runs[i].end;
+		}
+		return start == codes.GetLength();
+	}
+};
+
+TEST(TextRunWithDecorationsIsOneDraw)
+{
+	GpuDevice *device;
+	RenderTarget *target;
+	CreateTarget(&device, &target);
+	TextLayout layout;
+	layout.SetWidth((float32)targetSize);
+	char32 text[] = U"Batched text\nsecond line";
+	uint32 length = (uint32)(sizeof(text) / sizeof(char32) - 1);
+	// Above the atlas threshold, so every glyph takes the analytic path
+	layout.InsertText(0, text, length, (wchar *)L"Segoe UI", 32.0f, false, 400, true, false, Color(Color::Black));
+	if (layout.GetTextLength() == 0)
+	{
+		target->Unref();
+		device->Unref();
+		SKIP("font unavailable");
+	}
+	layout.SetColor(0, 7, Color(Color::Red));
+	layout.SetStrikethrough(8, length, true);
+	for (uint32 frame = 0; frame < 2; frame++)
+	{
+		target->Begin();
+		target->SetSolidColorBrush(Color(Color::White));
+		target->FillRectangle(0.0f, 0.0f, (float32)targetSize, (float32)targetSize);
+		layout.Render(target, Vector2f(0.0f, 0.0f));
+		target->End();
+	}
+	std::vector<Color> pixels(targetSize * targetSize);
+	CHECK(target->ReadPixels(pixels.data()) == HResultSuccess);
+
+	RenderTargetStatistics statistics;
+	target->GetStatistics(&statistics);
+	// The background rectangle, then glyphs of both colors and all underlines
+	// and strikethroughs in a single draw
+	CHECK(statistics.drawsIssued == 2);
+	bool red = false, black = false;
+	for (Color &pixel : pixels)
+	{
+		red |= pixel == Color(Color::Red);
+		black |= pixel == Color(Color::Black);
+	}
+	CHECK(red && black);
+	target->Unref();
+	device->Unref();
+}
+BENCHMARK(TypingLatencyOnLargeText)
+{
+	static const uint32 lineCount = 32 * 1024, keystrokes = 512;
+	GpuDevice *device;
+	if (!AcquireGpuDevice(&device)) SKIP("no Vulkan device");
+	// 8 MB of code points in wrapped log lines
+	std::u32string text;
+	for (uint32 i = 0; i < lineCount; i++)
+		text += U"12:00:00 INFO request served in 12 ms by worker thread number 7\n";
+	TextLayout layout;
+	layout.SetWidth(300.0f);
+	layout.InsertText(0, &text[0], (uint32)text.size(), (wchar *)L"Segoe UI", 12.0f);
+	if (layout.GetTextLength() == 0)
+	{
+		device->Unref();
+		SKIP("font unavailable");
+	}
+	uint32 lines = layout.GetLineCount();
+	float32 textHeight = layout.GetTextHeight();
+	Vector2f size = layout.MeasureText(FLT_MAX);
+
+	// Each keystroke is followed by the queries a text field makes for the caret
+	uint32 caret = 100;
+	TextPositionMetrics tpm;
+	int64 start = Time::Now();
+	for (uint32 i = 0; i < keystrokes; i++)
+	{
+		char32 code = i % 6 == 5 ? U' ' : (char32)(U'a' + i % 26);
+		layout.InsertText(caret++, &code, 1, (wchar *)L"Segoe UI", 12.0f);
+		layout.GetPositionMetrics(caret, &tpm);
+		layout.GetTextHeight();
+	}
+	int64 insertTime = Time::Now() - start;
+	start = Time::Now();
+	for (uint32 i = 0; i < keystrokes; i++)
+	{
+		layout.DeleteText(caret - 1, caret);
+		caret--;
+		layout.GetPositionMetrics(caret, &tpm);
+		layout.GetTextHeight();
+	}
+	int64 deleteTime = Time::Now() - start;
+	start = Time::Now();
+	Vector2f measured = layout.MeasureText(FLT_MAX);
+	int64 measureTime = Time::Now() - start;
+	start = Time::Now();
+	layout.MeasureText(FLT_MAX);
+	int64 cachedMeasureTime = Time::Now() - start;
+	ReportValue("insert latency", insertTime / 1e3 / keystrokes, "us/keystroke");
+	ReportValue("delete latency", deleteTime / 1e3 / keystrokes, "us/keystroke");
+	ReportValue("measure", measureTime / 1e6, "ms");
+	ReportValue("cached measure", cachedMeasureTime / 1e3, "us");
+
+	// The edits cancel out, so does their effect on the layout
+	CHECK(layout.GetTextLength() == (uint32)text.size());
+	CHECK(layout.GetLineCount() == lines);
+	CHECK(layout.GetTextHeight() == textHeight);
+	CHECK(measured.x == size.x && measured.y == size.y);
+	device->Unref();
+}
+BENCHMARK(InsertTextLookups)
+{
+	static const uint32 wordCount = 128 * 1024;
+	GpuDevice *device;
+	if (!AcquireGpuDevice(&device)) SKIP("no Vulkan device");
+	// Basic Latin and Cyrillic words, so both glyph table paths are taken
+	const char32 *words[4] = { U"latin ", U"words ", U"\u0442\u0435\u043A\u0441\u0442 ", U"\u0441\u043B\u043E\u0432\u043E\n" };
+	std::u32string text;
+	for (uint32 i = 0; i < wordCount; i++)
+		text += words[i % 4];
+	TextLayout layout;
+	layout.SetWidth(400.0f);
+	// One call per word, with the font alternating between two sizes as in
+	// text restyled in short runs
+	int64 start = Time::Now();
+	for (uint32 i = 0, idx = 0; i < wordCount; i++)
+	{
+		uint32 length = (uint32)std::char_traits<char32>::length(words[i % 4]);
+		layout.InsertText(idx, &text[idx], length, (wchar *)L"Segoe UI", i % 8 < 4 ? 12.0f : 14.0f);
+		idx += length;
+	}
+	int64 insertTime = Time::Now() - start;
+	if (layout.GetTextLength() != (uint32)text.size())
+	{
+		device->Unref();
+		SKIP("font unavailable");
+	}
+	// The first layout loads the glyphs, the second one only looks them up
+	start = Time::Now();
+	layout.GetTextHeight();
+	int64 firstLayoutTime = Time::Now() - start;
+	layout.SetWidth(300.0f);
+	start = Time::Now();
+	layout.GetTextHeight();
+	int64 layoutTime = Time::Now() - start;
+	ReportValue("insert", (float64)insertTime / wordCount, "ns/call");
+	ReportValue("first layout", (float64)firstLayoutTime / text.size(), "ns/char");
+	ReportValue("layout", (float64)layoutTime / text.size(), "ns/char");
+	CHECK(layout.GetLineCount() >= wordCount / 4);
+	device->Unref();
+}
+TEST(RunsStayMinimalUnderEdits)
+{
+	GpuDevice *device;
+	if (!AcquireGpuDevice(&device)) SKIP("no Vulkan device");
+	// Every character's style is tracked separately and compared with the
+	// runs, which must stay sorted, cover the text and never repeat a style
+	struct CharStyle
+	{
+		float32 fontSize;
+		bool isItalic;
+		bool underlined;
+		bool strikedthrough;
+		// Index into colors
+		uint32 color;
+	};
+	const Color colors[3] = { Color(Color::Black), Color(Color::Red), Color(Color::Blue) };
+	RunProbe layout;
+	std::vector<CharStyle> reference;
+	std::mt19937 random(24);
+	uint32 brokenRuns = 0, wrongStyles = 0;
+	for (uint32 step = 0; step < 3000; step++)
+	{
+		uint32 length = (uint32)reference.size(), op = random() % 8,
+			begin = length == 0 ? 0 : random() % length,
+			end = Min(length, begin + 1 + random() % 12);
+		if (op < 2 || length == 0)
+		{
+			char32 text[8];
+			uint32 count = 1 + random() % 8;
+			for (uint32 i = 0; i < count; i++)
+				text[i] = (char32)(U'a' + random() % 26);
+			CharStyle style = {
+				random() % 2 == 0 ? 12.0f : 16.0f,
+				random() % 4 == 0,
+				random() % 4 == 0,
+				random() % 4 == 0,
+				random() % 3 };
+			uint32 idx = length == 0 ? 0 : random() % (length + 1);
+			layout.InsertText(
+				idx,
+				text,
+				count,
+				(wchar *)L"Segoe UI",
+				style.fontSize,
+				style.isItalic,
+				400,
+				style.underlined,
+				style.strikedthrough,
+				colors[style.color]);
+			if (layout.GetTextLength() == length)
+			{
+				device->Unref();
+				SKIP("font unavailable");
+			}
+			reference.insert(reference.begin() + idx, count, style);
+		}
+		else if (op == 2)
+		{
+			layout.DeleteText(begin, end);
+			reference.erase(reference.begin() + begin, reference.begin() + end);
+		}
+		else if (op == 3)
+		{
+			uint32 color = random() % 3;
+			layout.SetColor(begin, end, colors[color]);
+			for (uint32 i = begin; i < end; i++) reference[i].color = color;
+		}
+		else if (op == 4)
+		{
+			bool value = random() % 2 == 0;
+			layout.SetUnderline(begin, end, value);
+			for (uint32 i = begin; i < end; i++) reference[i].underlined = value;
+		}
+		else if (op == 5)
+		{
+			bool value = random() % 2 == 0;
+			layout.SetStrikethrough(begin, end, value);
+			for (uint32 i = begin; i < end; i++) reference[i].strikedthrough = value;
+		}
+		else if (op == 6)
+		{
+			bool value = random() % 2 == 0;
+			layout.SetItalic(begin, end, value);
+			for (uint32 i = begin; i < end; i++) reference[i].isItalic = value;
+		}
+		else
+		{
+			float32 value = random() % 2 == 0 ? 12.0f : 16.0f;
+			layout.SetFontSize(begin, end, value);
+			for (uint32 i = begin; i < end; i++) reference[i].fontSize = value;
+		}
+		brokenRuns += !layout.CheckRuns();
+		for (uint32 i = 0; i < reference.size(); i++)
+		{
+			CharStyle &style = reference[i];
+			if (layout.GetFontSize(i) != style.fontSize
+				|| layout.IsItalic(i) != style.isItalic
+				|| layout.IsUnderlined(i) != style.underlined
+				|| layout.IsStrikedthrough(i) != style.strikedthrough
+				|| layout.GetColor(i).code != colors[style.color].code)
+				wrongStyles++;
+		}
+	}
+	CHECK(layout.GetTextLength() == (uint32)reference.size());
+	CHECK(brokenRuns == 0);
+	CHECK(wrongStyles == 0);
+	device->Unref();
+}